@@ -34,14 +34,18 @@ typedef int _Atomic_word;
 // Define these two macros using the appropriate memory barrier for the target.
 // The commented out versions below are the defaults.
 // See ia64/atomic_word.h for an alternative approach.
+// The Cortex-A9 cores of PSP2 are weakly ordered, so both need a DMB over
+// the inner shareable domain.
 
 // This one prevents loads from being hoisted across the barrier;
 // in other words, this is a Load-Load acquire barrier.
 // This is necessary iff TARGET_RELAXED_ORDERING is defined in tm.h.  
 // #define _GLIBCXX_READ_MEM_BARRIER __asm __volatile ("":::"memory")
+#define _GLIBCXX_READ_MEM_BARRIER __asm __volatile ("dmb ish":::"memory")
 
 // This one prevents stores from being sunk across the barrier; in other
 // words, a Store-Store release barrier.
 // #define _GLIBCXX_WRITE_MEM_BARRIER __asm __volatile ("":::"memory")
+#define _GLIBCXX_WRITE_MEM_BARRIER __asm __volatile ("dmb ishst":::"memory")
 
 #endif 
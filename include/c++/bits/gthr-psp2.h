@@ -0,0 +1,471 @@
+/* Threads compatibility routines for libstdc++ on PSP2.  */
+/*
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef _GLIBCXX_GCC_GTHR_PSP2_H
+#define _GLIBCXX_GCC_GTHR_PSP2_H
+
+/* Mutexes keep their state in a user-space word and only fall back to the
+   kernel when a thread has to sleep.  The kernel semaphore used to sleep is
+   created on the first contention, so mutexes can be initialized statically
+   and an uncontended lock or unlock is a single LDREX/STREX sequence.
+
+   Keys are mapped onto the thread local storage slots returned by
+   sceKernelGetTLSAddr.  PSP2 threads have no exit hook, so key destructors
+   are never called, and a reused key may still hold the value a thread
+   stored under the deleted one.
+
+   The C++11 thread interface (__GTHREADS_CXX0X) is not provided: the
+   out-of-line parts of std::thread live in the prebuilt SceLibstdc++.
+
+   This port changes the libstdc++ ABI.  __gthread_mutex_t grows from an
+   int to 8 bytes, and __gthread_active_p() turns the reference counts of
+   strings, locales and shared_ptr atomic.  The prebuilt SceLibstdc++ was
+   built with gthr-single.h, so gthr-default.h only selects this port when
+   __GTHREAD_PSP2_THREADS is defined, for a libstdc++ built with it too.
+   Mixing the two would let header code lock a 4-byte library mutex as an
+   8-byte one, and update the library's reference counts without the
+   atomics the library itself skips.
+
+   The bitmap of keys in use must be defined once per program: define
+   __GTHREAD_PSP2_DEFINE_KEYS before including this header in exactly one
+   translation unit.  */
+
+#define __GTHREADS 1
+#define __GTHREAD_HAS_COND 1
+
+#include <psp2/kernel/threadmgr.h>
+#include <psp2/kernel/atomic.h>
+
+/* First sceKernelGetTLSAddr slot used for keys and the number of keys.  */
+#ifndef __GTHREAD_PSP2_TLS_BASE
+#define __GTHREAD_PSP2_TLS_BASE 0x80
+#endif
+#ifndef __GTHREAD_PSP2_KEYS_MAX
+#define __GTHREAD_PSP2_KEYS_MAX 16
+#endif
+
+/* Maximum count of the semaphores, never reached in practice.  */
+#define __GTHREAD_PSP2_SEMA_MAX 0x7FFFFFFF
+
+typedef int __gthread_key_t;
+typedef volatile int32_t __gthread_once_t;
+
+typedef struct {
+  /* 0 when unlocked, 1 when locked, 2 when locked and maybe contended.  */
+  volatile int32_t __state;
+  /* Semaphore the contending threads sleep on, 0 until first needed.  */
+  volatile int32_t __sema;
+} __gthread_mutex_t;
+
+typedef struct {
+  __gthread_mutex_t __mutex;
+  volatile SceUID __owner;
+  int __count;
+} __gthread_recursive_mutex_t;
+
+/* Each waiter takes a ticket, and signals release the waiters in ticket
+   order.  A woken thread whose ticket was not released took the token of
+   an older waiter that had not started to sleep yet: it gives the token
+   back and sleeps on __retry until a released waiter has taken one or
+   another signal comes, so that a thread that starts waiting after a
+   signal never takes the wakeup of a thread that was waiting before it.  */
+typedef struct {
+  /* Guards the counters.  */
+  __gthread_mutex_t __lock;
+  /* Tickets handed out so far.  */
+  uint32_t __tickets;
+  /* Waiters whose ticket is lower have been signaled.  */
+  uint32_t __signaled;
+  /* Woken threads that gave their token back.  */
+  int32_t __deferred;
+  /* Semaphore the waiters sleep on, 0 until first needed.  */
+  volatile int32_t __sema;
+  /* Semaphore the threads that gave their token back sleep on.  */
+  volatile int32_t __retry;
+} __gthread_cond_t;
+
+#define __GTHREAD_ONCE_INIT 0
+#define __GTHREAD_MUTEX_INIT { 0, 0 }
+#define __GTHREAD_MUTEX_INIT_FUNCTION __gthread_mutex_init_function
+#define __GTHREAD_RECURSIVE_MUTEX_INIT { __GTHREAD_MUTEX_INIT, 0, 0 }
+#define __GTHREAD_RECURSIVE_MUTEX_INIT_FUNCTION __gthread_recursive_mutex_init_function
+#define __GTHREAD_COND_INIT { __GTHREAD_MUTEX_INIT, 0, 0, 0, 0, 0 }
+#define __GTHREAD_COND_INIT_FUNCTION __gthread_cond_init_function
+
+/* Bitmap of the keys in use, shared by every translation unit.  */
+extern volatile int32_t __gthread_psp2_keys;
+#ifdef __GTHREAD_PSP2_DEFINE_KEYS
+volatile int32_t __gthread_psp2_keys = 0;
+#endif
+
+/* Return the semaphore stored at __uid, creating it first if needed.  */
+static inline SceUID
+__gthread_psp2_get_sema (volatile int32_t *__uid)
+{
+  SceUID __sema = psp2AtomicLoad32 (__uid);
+  SceUID __old;
+
+  if (__sema > 0)
+    return __sema;
+
+  __sema = sceKernelCreateSema ("gthr", 0, 0, __GTHREAD_PSP2_SEMA_MAX, NULL);
+  if (__sema < 0)
+    return __sema;
+
+  /* Another thread may have raced us; keep the first semaphore.  */
+  __old = psp2AtomicCompareAndSet32 (__uid, 0, __sema);
+  if (__old != 0)
+    {
+      sceKernelDeleteSema (__sema);
+      return __old;
+    }
+
+  return __sema;
+}
+
+static inline int
+__gthread_active_p (void)
+{
+  return 1;
+}
+
+static inline int
+__gthread_once (__gthread_once_t *__once, void (*__func) (void))
+{
+  /* 0 when not run yet, 1 while running, 2 when done.  */
+  if (psp2AtomicLoad32 (__once) == 2)
+    return 0;
+
+  if (psp2AtomicCompareAndSet32 (__once, 0, 1) == 0)
+    {
+      __func ();
+      psp2AtomicStore32 (__once, 2);
+      return 0;
+    }
+
+  /* Initialization is rare; let the running thread finish.  */
+  while (psp2AtomicLoad32 (__once) != 2)
+    sceKernelDelayThread (100);
+
+  return 0;
+}
+
+/* __DTOR is never run, neither when a thread exits nor when the key is
+   deleted, so a thread must free what it stored under a key itself.  */
+static inline int
+__gthread_key_create (__gthread_key_t *__key,
+		      void (*__dtor) (void *) __attribute__((unused)))
+{
+  int32_t __keys;
+  int __i;
+
+  for (__i = 0; __i < __GTHREAD_PSP2_KEYS_MAX; __i++)
+    {
+      __keys = psp2AtomicGetAndOr32 (&__gthread_psp2_keys, 1 << __i);
+      if (!(__keys & (1 << __i)))
+	{
+	  *__key = __i;
+	  *(void **) sceKernelGetTLSAddr (__GTHREAD_PSP2_TLS_BASE + __i) = 0;
+	  return 0;
+	}
+    }
+
+  return -1;
+}
+
+static inline int
+__gthread_key_delete (__gthread_key_t __key)
+{
+  psp2AtomicGetAndAnd32 (&__gthread_psp2_keys, ~(1 << __key));
+  return 0;
+}
+
+static inline void *
+__gthread_getspecific (__gthread_key_t __key)
+{
+  return *(void **) sceKernelGetTLSAddr (__GTHREAD_PSP2_TLS_BASE + __key);
+}
+
+static inline int
+__gthread_setspecific (__gthread_key_t __key, const void *__ptr)
+{
+  *(const void **) sceKernelGetTLSAddr (__GTHREAD_PSP2_TLS_BASE + __key) = __ptr;
+  return 0;
+}
+
+static inline void
+__gthread_mutex_init_function (__gthread_mutex_t *__mutex)
+{
+  __mutex->__state = 0;
+  __mutex->__sema = 0;
+}
+
+static inline int
+__gthread_mutex_destroy (__gthread_mutex_t *__mutex)
+{
+  if (__mutex->__sema > 0)
+    sceKernelDeleteSema (__mutex->__sema);
+
+  return 0;
+}
+
+static inline int
+__gthread_mutex_lock (__gthread_mutex_t *__mutex)
+{
+  SceUID __sema;
+  int32_t __state;
+  int __ret;
+
+  __state = psp2AtomicCompareAndSet32 (&__mutex->__state, 0, 1);
+  if (__state == 0)
+    return 0;
+
+  /* The semaphore must exist before the state says there are sleepers.  */
+  __sema = __gthread_psp2_get_sema (&__mutex->__sema);
+  if (__sema < 0)
+    return __sema;
+
+  if (__state != 2)
+    __state = psp2AtomicGetAndSet32 (&__mutex->__state, 2);
+
+  /* On an error, leaving the state at 2 only costs the owner a signal.  */
+  while (__state != 0)
+    {
+      __ret = sceKernelWaitSema (__sema, 1, NULL);
+      if (__ret < 0)
+	return __ret;
+      __state = psp2AtomicGetAndSet32 (&__mutex->__state, 2);
+    }
+
+  return 0;
+}
+
+static inline int
+__gthread_mutex_trylock (__gthread_mutex_t *__mutex)
+{
+  return psp2AtomicCompareAndSet32 (&__mutex->__state, 0, 1) != 0;
+}
+
+static inline int
+__gthread_mutex_unlock (__gthread_mutex_t *__mutex)
+{
+  if (psp2AtomicGetAndSet32 (&__mutex->__state, 0) == 2)
+    sceKernelSignalSema (__mutex->__sema, 1);
+
+  return 0;
+}
+
+static inline void
+__gthread_recursive_mutex_init_function (__gthread_recursive_mutex_t *__mutex)
+{
+  __gthread_mutex_init_function (&__mutex->__mutex);
+  __mutex->__owner = 0;
+  __mutex->__count = 0;
+}
+
+static inline int
+__gthread_recursive_mutex_lock (__gthread_recursive_mutex_t *__mutex)
+{
+  SceUID __self = sceKernelGetThreadId ();
+  int __ret;
+
+  if (__mutex->__owner != __self)
+    {
+      __ret = __gthread_mutex_lock (&__mutex->__mutex);
+      if (__ret)
+	return __ret;
+
+      __mutex->__owner = __self;
+    }
+
+  __mutex->__count++;
+  return 0;
+}
+
+static inline int
+__gthread_recursive_mutex_trylock (__gthread_recursive_mutex_t *__mutex)
+{
+  SceUID __self = sceKernelGetThreadId ();
+
+  if (__mutex->__owner != __self)
+    {
+      if (__gthread_mutex_trylock (&__mutex->__mutex))
+	return 1;
+
+      __mutex->__owner = __self;
+    }
+
+  __mutex->__count++;
+  return 0;
+}
+
+static inline int
+__gthread_recursive_mutex_unlock (__gthread_recursive_mutex_t *__mutex)
+{
+  if (--__mutex->__count == 0)
+    {
+      __mutex->__owner = 0;
+      return __gthread_mutex_unlock (&__mutex->__mutex);
+    }
+
+  return 0;
+}
+
+static inline int
+__gthread_recursive_mutex_destroy (__gthread_recursive_mutex_t *__mutex)
+{
+  return __gthread_mutex_destroy (&__mutex->__mutex);
+}
+
+static inline void
+__gthread_cond_init_function (__gthread_cond_t *__cond)
+{
+  __gthread_mutex_init_function (&__cond->__lock);
+  __cond->__tickets = 0;
+  __cond->__signaled = 0;
+  __cond->__deferred = 0;
+  __cond->__sema = 0;
+  __cond->__retry = 0;
+}
+
+static inline int
+__gthread_cond_destroy (__gthread_cond_t *__cond)
+{
+  if (__cond->__sema > 0)
+    sceKernelDeleteSema (__cond->__sema);
+  if (__cond->__retry > 0)
+    sceKernelDeleteSema (__cond->__retry);
+
+  return __gthread_mutex_destroy (&__cond->__lock);
+}
+
+/* Release the waiters with the next __count tickets, or all of them if
+   __count is 0.  */
+static inline int
+__gthread_psp2_cond_release (__gthread_cond_t *__cond, int32_t __count)
+{
+  uint32_t __waiting;
+  int __ret;
+
+  __ret = __gthread_mutex_lock (&__cond->__lock);
+  if (__ret)
+    return __ret;
+
+  /* The semaphore exists as soon as a ticket has been handed out.  */
+  __waiting = __cond->__tickets - __cond->__signaled;
+  if (__count == 0 || (uint32_t) __count > __waiting)
+    __count = __waiting;
+  if (__count > 0)
+    {
+      __cond->__signaled += __count;
+      __ret = sceKernelSignalSema (__cond->__sema, __count) < 0;
+
+      /* A thread that gave a token back may hold a released ticket now.  */
+      if (__cond->__deferred > 0)
+	{
+	  sceKernelSignalSema (__cond->__retry, __cond->__deferred);
+	  __cond->__deferred = 0;
+	}
+    }
+
+  __gthread_mutex_unlock (&__cond->__lock);
+  return __ret;
+}
+
+static inline int
+__gthread_cond_signal (__gthread_cond_t *__cond)
+{
+  return __gthread_psp2_cond_release (__cond, 1);
+}
+
+static inline int
+__gthread_cond_broadcast (__gthread_cond_t *__cond)
+{
+  return __gthread_psp2_cond_release (__cond, 0);
+}
+
+static inline int
+__gthread_cond_wait (__gthread_cond_t *__cond, __gthread_mutex_t *__mutex)
+{
+  SceUID __sema, __retry;
+  uint32_t __ticket;
+  int __ret, __lock_ret;
+
+  __sema = __gthread_psp2_get_sema (&__cond->__sema);
+  if (__sema < 0)
+    return __sema;
+  __retry = __gthread_psp2_get_sema (&__cond->__retry);
+  if (__retry < 0)
+    return __retry;
+
+  /* Take a ticket while still holding the mutex, so that a signal sent
+     after the unlock below always releases us or an older waiter.  */
+  __ret = __gthread_mutex_lock (&__cond->__lock);
+  if (__ret)
+    return __ret;
+  __ticket = __cond->__tickets++;
+  __gthread_mutex_unlock (&__cond->__lock);
+
+  __gthread_mutex_unlock (__mutex);
+
+  for (;;)
+    {
+      __ret = sceKernelWaitSema (__sema, 1, NULL);
+      if (__ret < 0)
+	break;
+
+      __ret = __gthread_mutex_lock (&__cond->__lock);
+      if (__ret)
+	break;
+
+      if ((int32_t) (__ticket - __cond->__signaled) < 0)
+	{
+	  /* Our token: the threads that gave one back may try again.  */
+	  if (__cond->__deferred > 0)
+	    {
+	      sceKernelSignalSema (__retry, __cond->__deferred);
+	      __cond->__deferred = 0;
+	    }
+	  __gthread_mutex_unlock (&__cond->__lock);
+	  break;
+	}
+
+      /* The token of an older waiter that has not slept yet.  */
+      __cond->__deferred++;
+      sceKernelSignalSema (__sema, 1);
+      __gthread_mutex_unlock (&__cond->__lock);
+
+      __ret = sceKernelWaitSema (__retry, 1, NULL);
+      if (__ret < 0)
+	break;
+    }
+
+  __lock_ret = __gthread_mutex_lock (__mutex);
+
+  return __ret ? __ret : __lock_ret;
+}
+
+static inline int
+__gthread_cond_wait_recursive (__gthread_cond_t *__cond,
+			       __gthread_recursive_mutex_t *__mutex)
+{
+  SceUID __owner = __mutex->__owner;
+  int __count = __mutex->__count;
+  int __ret;
+
+  __mutex->__owner = 0;
+  __mutex->__count = 0;
+  __ret = __gthread_cond_wait (__cond, &__mutex->__mutex);
+  __mutex->__owner = __owner;
+  __mutex->__count = __count;
+
+  return __ret;
+}
+
+#endif /* ! _GLIBCXX_GCC_GTHR_PSP2_H */
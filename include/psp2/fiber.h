@@ -0,0 +1,293 @@
+/**
+ * \file fiber.h
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+
+#ifndef _PSP2_FIBER_H_
+#define _PSP2_FIBER_H_
+
+/**
+ * @file
+ *
+ * The fiber library, SceFiber.
+ *
+ * A fiber is a context of execution with its own stack, the context, which
+ * is switched to cooperatively.  A thread runs a fiber with #sceFiberRun(),
+ * the fiber switches to other fibers with #sceFiberSwitch(), and the fiber
+ * running returns to the thread with #sceFiberReturnToThread().  A fiber
+ * that returned to the thread, or that was switched from, is suspended, and
+ * resumes where it left when it is run or switched to again, on any thread.
+ *
+ * The entry of a fiber must not return: a fiber ends by returning to the
+ * thread for the last time.
+ */
+#include <psp2/types.h>
+
+#ifdef	__cplusplus
+extern "C" {
+#endif	// def __cplusplus
+
+/** The library is not initialized, or a pointer is NULL */
+#define SCE_FIBER_ERROR_NULL		0x80590001
+/** An address is not aligned */
+#define SCE_FIBER_ERROR_ALIGNMENT	0x80590002
+/** A value is out of range */
+#define SCE_FIBER_ERROR_RANGE		0x80590003
+/** An argument is not valid */
+#define SCE_FIBER_ERROR_INVALID		0x80590004
+/** The operation is not permitted from the caller */
+#define SCE_FIBER_ERROR_PERMISSION	0x80590005
+/** The fiber is not in a state the operation permits */
+#define SCE_FIBER_ERROR_STATE		0x80590006
+/** The fiber is running */
+#define SCE_FIBER_ERROR_BUSY		0x80590007
+/** The operation failed temporarily */
+#define SCE_FIBER_ERROR_AGAIN		0x80590008
+/** A fatal error, such as the return from the entry of a fiber */
+#define SCE_FIBER_ERROR_FATAL		0x80590009
+
+/** The alignment of #SceFiber and #SceFiberOptParam */
+#define SCE_FIBER_ALIGNMENT				8
+/** The alignment of the address and of the size of a context */
+#define SCE_FIBER_CONTEXT_ALIGNMENT		8
+/** The minimum size of a context */
+#define SCE_FIBER_CONTEXT_MINIMUM_SIZE	512
+/** The maximum length of the name of a fiber, the terminator excluded */
+#define SCE_FIBER_MAX_NAME_LENGTH		31
+
+/** Enables the check of the size of the contexts used by the fibers */
+#define SCE_FIBER_CONTEXT_SIZE_CHECK_ENABLE		0x00000001
+
+/**
+ * The entry of a fiber.  It must not return.
+ *
+ * @param[in]	argOnInitialize	The argument given to #sceFiberInitialize().
+ * @param[in]	argOnRun		The argument given to #sceFiberRun() or
+ * 								#sceFiberSwitch() when the fiber first runs.
+ */
+typedef void (SceFiberEntry)(SceUInt32 argOnInitialize, SceUInt32 argOnRun);
+
+/**
+ * A fiber.  Its content is private to the library.
+ */
+typedef struct SceFiber {
+	char reserved[128];
+} __attribute__((aligned(SCE_FIBER_ALIGNMENT))) SceFiber;
+
+/**
+ * The options of #sceFiberInitialize().  Its content is private to the
+ * library.
+ */
+typedef struct SceFiberOptParam {
+	char reserved[128];
+} __attribute__((aligned(SCE_FIBER_ALIGNMENT))) SceFiberOptParam;
+
+/**
+ * The information on a fiber.
+ */
+typedef struct SceFiberInfo {
+	SceFiberEntry *entry;				//!< The entry of the fiber.
+	SceUInt32 argOnInitialize;			//!< The argument of the entry given on initialization.
+	void *addrContext;					//!< The address of the context.
+	SceSize sizeContext;				//!< The size of the context.
+	char name[SCE_FIBER_MAX_NAME_LENGTH + 1];	//!< The name of the fiber.
+	SceSize sizeContextMargin;			//!< The size of the context never used, when the check is enabled.
+	char reserved[76];
+} __attribute__((aligned(SCE_FIBER_ALIGNMENT))) SceFiberInfo;
+
+SceInt32 _sceFiberInitializeImpl(SceFiber *fiber, const char *name,
+	SceFiberEntry *entry, SceUInt32 argOnInitialize,
+	void *addrContext, SceSize sizeContext, const SceFiberOptParam *optParam);
+
+/**
+ * Initializes the options of #sceFiberInitialize() to their defaults.
+ *
+ * @param[out]	optParam	The options.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_FIBER_ERROR_NULL	The pointer is NULL.
+ * @retval
+ * SCE_FIBER_ERROR_ALIGNMENT	The options are not aligned.
+ */
+SceInt32 sceFiberOptParamInitialize(SceFiberOptParam *optParam);
+
+/**
+ * Initializes a fiber.  The fiber first runs at its entry.
+ *
+ * @param[out]	fiber			The fiber.  It must be aligned to
+ * 								#SCE_FIBER_ALIGNMENT.
+ * @param[in]	name			The name of the fiber, at most
+ * 								#SCE_FIBER_MAX_NAME_LENGTH characters.
+ * @param[in]	entry			The entry of the fiber.
+ * @param[in]	argOnInitialize	The first argument of the entry.
+ * @param[in]	addrContext		The context of the fiber, its stack.  Its
+ * 								address and size must be aligned to
+ * 								#SCE_FIBER_CONTEXT_ALIGNMENT.  It must persist
+ * 								until the fiber is finalized.
+ * @param[in]	sizeContext		The size of the context, at least
+ * 								#SCE_FIBER_CONTEXT_MINIMUM_SIZE.
+ * @param[in]	optParam		The options, or NULL.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_FIBER_ERROR_NULL	A pointer is NULL.
+ * @retval
+ * SCE_FIBER_ERROR_ALIGNMENT	The fiber or its context is not aligned.
+ * @retval
+ * SCE_FIBER_ERROR_RANGE	The context is too small.
+ * @retval
+ * SCE_FIBER_ERROR_INVALID	The name is too long.
+ */
+static inline SceInt32 sceFiberInitialize(SceFiber *fiber, const char *name,
+	SceFiberEntry *entry, SceUInt32 argOnInitialize,
+	void *addrContext, SceSize sizeContext, const SceFiberOptParam *optParam)
+{
+	return _sceFiberInitializeImpl(fiber, name, entry, argOnInitialize,
+		addrContext, sizeContext, optParam);
+}
+
+/**
+ * Finalizes a fiber.  The fiber must not run.
+ *
+ * @param[in,out]	fiber	The fiber.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_FIBER_ERROR_NULL	The pointer is NULL.
+ * @retval
+ * SCE_FIBER_ERROR_INVALID	The fiber is not initialized.
+ * @retval
+ * SCE_FIBER_ERROR_STATE	The fiber runs.
+ */
+SceInt32 sceFiberFinalize(SceFiber *fiber);
+
+/**
+ * Runs a fiber from the thread until a fiber returns to the thread.
+ *
+ * @param[in,out]	fiber		The fiber.  It must not run.
+ * @param[in]		argOnRunTo	The second argument of the entry if the
+ * 								fiber first runs, or else what the fiber
+ * 								gets from the call that suspended it.
+ * @param[out]		argOnReturn	What the fiber gives to
+ * 								#sceFiberReturnToThread(), or NULL.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_FIBER_ERROR_NULL	The fiber is NULL.
+ * @retval
+ * SCE_FIBER_ERROR_INVALID	The fiber is not initialized.
+ * @retval
+ * SCE_FIBER_ERROR_PERMISSION	The caller is a fiber.
+ * @retval
+ * SCE_FIBER_ERROR_STATE	The fiber runs.
+ */
+SceInt32 sceFiberRun(SceFiber *fiber, SceUInt32 argOnRunTo,
+	SceUInt32 *argOnReturn);
+
+/**
+ * Switches from the calling fiber to another, and suspends the calling fiber
+ * until it is run or switched to again.
+ *
+ * @param[in,out]	fiber		The fiber to switch to.  It must not run.
+ * @param[in]		argOnRunTo	The second argument of the entry if the
+ * 								fiber first runs, or else what the fiber
+ * 								gets from the call that suspended it.
+ * @param[out]		argOnRun	What the calling fiber gets when it resumes,
+ * 								or NULL.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_FIBER_ERROR_NULL	The fiber is NULL.
+ * @retval
+ * SCE_FIBER_ERROR_INVALID	The fiber is not initialized.
+ * @retval
+ * SCE_FIBER_ERROR_PERMISSION	The caller is not a fiber.
+ * @retval
+ * SCE_FIBER_ERROR_STATE	The fiber runs.
+ */
+SceInt32 sceFiberSwitch(SceFiber *fiber, SceUInt32 argOnRunTo,
+	SceUInt32 *argOnRun);
+
+/**
+ * Gets the fiber running.
+ *
+ * @param[out]	fiber	The fiber.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_FIBER_ERROR_NULL	The pointer is NULL.
+ * @retval
+ * SCE_FIBER_ERROR_PERMISSION	The caller is not a fiber.
+ */
+SceInt32 sceFiberGetSelf(SceFiber **fiber);
+
+/**
+ * Returns from the calling fiber to the thread that ran it, and suspends the
+ * calling fiber until it is run or switched to again.
+ *
+ * @param[in]	argOnReturn	What #sceFiberRun() gives to the thread.
+ * @param[out]	argOnRun	What the calling fiber gets when it resumes, or
+ * 							NULL.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_FIBER_ERROR_PERMISSION	The caller is not a fiber.
+ */
+SceInt32 sceFiberReturnToThread(SceUInt32 argOnReturn, SceUInt32 *argOnRun);
+
+/**
+ * Gets the information on a fiber.
+ *
+ * @param[in]	fiber		The fiber.
+ * @param[out]	fiberInfo	The information.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_FIBER_ERROR_NULL	A pointer is NULL.
+ * @retval
+ * SCE_FIBER_ERROR_INVALID	The fiber is not initialized.
+ */
+SceInt32 sceFiberGetInfo(SceFiber *fiber, SceFiberInfo *fiberInfo);
+
+/**
+ * Starts the check of the size of the contexts of the fibers initialized
+ * later: their contexts are filled with a pattern, and the size never used
+ * is then reported by #sceFiberGetInfo().
+ *
+ * @param[in]	flags	#SCE_FIBER_CONTEXT_SIZE_CHECK_ENABLE.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_FIBER_ERROR_INVALID	The flags are not valid.
+ */
+SceInt32 sceFiberStartContextSizeCheck(SceUInt32 flags);
+
+/**
+ * Stops the check of the size of the contexts.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ */
+SceInt32 sceFiberStopContextSizeCheck(void);
+
+#ifdef	__cplusplus
+}
+#endif	// def __cplusplus
+
+#endif /* _PSP2_FIBER_H_ */
@@ -0,0 +1,561 @@
+/**
+ * \file fiber_jobs.h
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+
+#ifndef _PSP2_FIBER_JOBS_H_
+#define _PSP2_FIBER_JOBS_H_
+
+/**
+ * @file
+ *
+ * A job scheduler whose jobs run on fibers.
+ *
+ * Unlike the jobs of psp2/jobs.h, a job that waits for a counter does not
+ * keep the thread that runs it: its fiber is parked on the counter and the
+ * thread goes on with other jobs, and the fiber is resumed, on any worker,
+ * once the counter reaches zero.  A deep graph of dependent jobs thus never
+ * blocks a thread in the kernel while there is work to do.
+ *
+ * The scheduler has a worker for the calling thread and a worker thread for
+ * each other worker, and a pool of fibers whose contexts are given by the
+ * caller.  The workers share a queue of jobs and a queue of the fibers that
+ * are ready to resume, under a spin lock held for a few instructions.  A
+ * worker resumes the ready fibers first, then starts the jobs on free
+ * fibers:
+ *
+ * @code
+ * 	static void update(Psp2FiberJobScheduler *scheduler, void *arg)
+ * 	{
+ * 		Psp2FiberJobCounter counter = PSP2_FIBER_JOB_COUNTER_INIT;
+ * 		Psp2FiberJob children[2] = { { animate, arg }, { simulate, arg } };
+ *
+ * 		psp2FiberJobRun(scheduler, &children[0], &counter);
+ * 		psp2FiberJobRun(scheduler, &children[1], &counter);
+ * 		psp2FiberJobWait(scheduler, &counter);	// Parks the fiber.
+ * 	}
+ *
+ * 	Psp2FiberJobCounter counter = PSP2_FIBER_JOB_COUNTER_INIT;
+ * 	Psp2FiberJob job = { update, world };
+ *
+ * 	psp2FiberJobRun(&scheduler, &job, &counter);
+ * 	psp2FiberJobWait(&scheduler, &counter);	// Runs jobs until done.
+ * @endcode
+ *
+ * Each job waiting for a counter holds a fiber, so the pool must have more
+ * fibers than the jobs that may wait at once, plus one per worker.  A worker
+ * that finds no job, or no free fiber for it, spins for a while, then sleeps
+ * on an event flag until a job is pushed, a fiber is ready, or the counter it
+ * waits for reaches zero.  The counters, and the worker threads and their
+ * event flag, are those of psp2/jobs.h.
+ *
+ * #psp2FiberJobWait() must be called by a job, or by the thread that called
+ * #psp2FiberJobSchedulerInit() outside of any fiber.
+ */
+#include <psp2/fiber.h>
+#include <psp2/jobs.h>
+
+#ifdef	__cplusplus
+extern "C" {
+#endif	// def __cplusplus
+
+/** The maximum number of workers, the calling thread included */
+#define PSP2_FIBER_JOB_MAX_WORKERS			PSP2_JOB_MAX_WORKERS
+
+/** The maximum number of fibers */
+#define PSP2_FIBER_JOB_MAX_FIBERS			128
+
+/** The default number of times an idle worker looks for work before it sleeps */
+#define PSP2_FIBER_JOB_DEFAULT_SPIN_COUNT	64
+
+/** The maximum number of jobs a counter counts */
+#define PSP2_FIBER_JOB_COUNTER_MAX			PSP2_JOB_COUNTER_MAX
+
+/** The initializer of a #Psp2FiberJobCounter */
+#define PSP2_FIBER_JOB_COUNTER_INIT			PSP2_JOB_COUNTER_INIT
+
+struct Psp2FiberJobScheduler;
+
+/**
+ * The function of a job.
+ *
+ * @param[in,out]	scheduler	The scheduler running the job.
+ * @param[in]		arg			The argument of the job.
+ */
+typedef void (*Psp2FiberJobFunc)(struct Psp2FiberJobScheduler *scheduler,
+	void *arg);
+
+/**
+ * A counter of the jobs that are not done.  At most one job or thread may
+ * wait for a counter at a time.  Its waiter is a fiber index plus one, or
+ * #PSP2_FIBER_JOB_MAX_FIBERS plus one plus a worker index.
+ */
+typedef Psp2JobCounter Psp2FiberJobCounter;
+
+/**
+ * A job.  It must persist until it is done.
+ */
+typedef struct Psp2FiberJob {
+	Psp2FiberJobFunc func;				//!< The function of the job.
+	void *arg;							//!< The argument of the function.
+	Psp2FiberJobCounter *counter;		//!< Set by #psp2FiberJobRun().
+	struct Psp2FiberJob *next;			//!< Set by #psp2FiberJobRun().
+} Psp2FiberJob;
+
+/**
+ * A fiber of the pool.
+ */
+typedef struct Psp2FiberJobFiber {
+	SceFiber fiber;						//!< Must be the first member.
+	struct Psp2FiberJobScheduler *scheduler;
+	uint32_t index;
+	Psp2FiberJob *job;					//!< The job to start, or NULL.
+	Psp2FiberJobCounter *counter;		//!< The counter the fiber waits for, or NULL.
+	struct Psp2FiberJobFiber *next;
+} Psp2FiberJobFiber;
+
+/**
+ * A worker.
+ */
+typedef struct Psp2FiberJobWorker {
+	struct Psp2FiberJobScheduler *scheduler;
+	uint32_t index;
+	uint32_t startCount;				//!< The number of jobs the worker started.
+	uint32_t resumeCount;				//!< The number of parked fibers the worker resumed.
+	uint32_t sleepCount;				//!< The number of times the worker slept.
+} Psp2FiberJobWorker;
+
+/**
+ * The parameters of #psp2FiberJobSchedulerInit().
+ */
+typedef struct Psp2FiberJobSchedulerParams {
+	uint32_t workerCount;				//!< The number of workers, the calling thread included.
+	int priority;						//!< The priority of the worker threads.
+	int stackSize;						//!< The stack size of the worker threads.
+	int cpuAffinityMask[PSP2_FIBER_JOB_MAX_WORKERS];	//!< The CPU affinity mask of each worker thread, or 0 to put worker i on user core i modulo 3.  The first mask is not used.
+	uint32_t spinCount;					//!< The number of times an idle worker looks for work before it sleeps, or 0 for the default.
+	uint32_t fiberCount;				//!< The number of fibers.
+	void *contexts;						//!< The contexts of the fibers, one after the other.  They must persist until the scheduler is terminated.
+	SceSize contextSize;				//!< The size of the context of a fiber.
+} Psp2FiberJobSchedulerParams;
+
+/**
+ * A fiber job scheduler.
+ */
+typedef struct Psp2FiberJobScheduler {
+	Psp2JobThreads threads;
+	SceUID thread;						//!< The thread that initialized the scheduler.
+	volatile int32_t lock;				//!< Guards the queues.
+	volatile int32_t jobCount;			//!< The number of jobs queued.
+	volatile int32_t readyCount;		//!< The number of fibers ready to resume.
+	volatile int32_t freeCount;			//!< The number of free fibers.
+	Psp2FiberJob *jobHead;
+	Psp2FiberJob *jobTail;
+	Psp2FiberJobFiber *readyHead;
+	Psp2FiberJobFiber *readyTail;
+	Psp2FiberJobFiber *freeFibers;
+	uint32_t fiberCount;				//!< The number of fibers initialized.
+	Psp2FiberJobWorker workers[PSP2_FIBER_JOB_MAX_WORKERS];
+	Psp2FiberJobFiber fibers[PSP2_FIBER_JOB_MAX_FIBERS];
+} Psp2FiberJobScheduler;
+
+static inline void psp2FiberJobLock(Psp2FiberJobScheduler *scheduler)
+{
+	while (psp2AtomicCompareAndSet32(&scheduler->lock, 0, 1) != 0)
+		while (psp2AtomicLoad32(&scheduler->lock) != 0)
+			;
+}
+
+static inline void psp2FiberJobUnlock(Psp2FiberJobScheduler *scheduler)
+{
+	psp2AtomicStore32(&scheduler->lock, 0);
+}
+
+/* Queue a parked fiber to resume */
+static inline void psp2FiberJobReady(Psp2FiberJobScheduler *scheduler,
+	Psp2FiberJobFiber *fiber)
+{
+	fiber->next = NULL;
+
+	psp2FiberJobLock(scheduler);
+	if (scheduler->readyTail != NULL)
+		scheduler->readyTail->next = fiber;
+	else
+		scheduler->readyHead = fiber;
+	scheduler->readyTail = fiber;
+	psp2AtomicStore32(&scheduler->readyCount, scheduler->readyCount + 1);
+	psp2FiberJobUnlock(scheduler);
+
+	if (psp2AtomicLoad32(&scheduler->threads.sleepMask) != 0)
+		psp2JobThreadsWakeOne(&scheduler->threads);
+}
+
+/* Count a counter down and wake its waiter once it reaches zero */
+static inline void psp2FiberJobCounterDone(Psp2FiberJobScheduler *scheduler,
+	Psp2FiberJobCounter *counter)
+{
+	int32_t waiter;
+
+	waiter = psp2JobCounterDone(counter);
+	if (waiter > PSP2_FIBER_JOB_MAX_FIBERS)
+		psp2JobThreadsWake(&scheduler->threads,
+			waiter - PSP2_FIBER_JOB_MAX_FIBERS - 1);
+	else if (waiter != 0)
+		psp2FiberJobReady(scheduler, scheduler->fibers + waiter - 1);
+}
+
+/*
+ * The entry of the fibers: start the job given by the worker, return to the
+ * worker once it is done, and start the next one when run again.
+ */
+static inline void psp2FiberJobEntry(SceUInt32 argOnInitialize,
+	SceUInt32 argOnRun)
+{
+	Psp2FiberJobFiber *fiber;
+	Psp2FiberJob *job;
+	SceFiber *self;
+
+	(void)argOnInitialize;
+	(void)argOnRun;
+	sceFiberGetSelf(&self);
+	fiber = (Psp2FiberJobFiber *)self;
+
+	for (;;) {
+		job = fiber->job;
+		fiber->job = NULL;
+
+		job->func(fiber->scheduler, job->arg);
+		if (job->counter != NULL)
+			psp2FiberJobCounterDone(fiber->scheduler, job->counter);
+
+		sceFiberReturnToThread(0, NULL);
+	}
+}
+
+/*
+ * Resume a ready fiber, or start a job on a free fiber, until the fiber
+ * returns to the worker: because its job is done, or because it waits for a
+ * counter, in which case it is parked on the counter.  The fiber is parked by
+ * the worker once it is suspended, so that it is never resumed while still
+ * running.  If the fiber cannot be run, the job or the fiber is queued back.
+ */
+static inline int psp2FiberJobStep(Psp2FiberJobWorker *worker)
+{
+	Psp2FiberJobScheduler *scheduler;
+	Psp2FiberJobFiber *fiber;
+	Psp2FiberJob *job;
+	int ret;
+
+	scheduler = worker->scheduler;
+	if (psp2AtomicLoad32(&scheduler->readyCount) == 0
+		&& (psp2AtomicLoad32(&scheduler->jobCount) == 0
+			|| psp2AtomicLoad32(&scheduler->freeCount) == 0))
+		return 0;
+
+	psp2FiberJobLock(scheduler);
+
+	job = NULL;
+	fiber = scheduler->readyHead;
+	if (fiber != NULL) {
+		scheduler->readyHead = fiber->next;
+		if (scheduler->readyHead == NULL)
+			scheduler->readyTail = NULL;
+		psp2AtomicStore32(&scheduler->readyCount, scheduler->readyCount - 1);
+		worker->resumeCount++;
+	} else if (scheduler->jobHead != NULL && scheduler->freeFibers != NULL) {
+		job = scheduler->jobHead;
+		scheduler->jobHead = job->next;
+		if (scheduler->jobHead == NULL)
+			scheduler->jobTail = NULL;
+		psp2AtomicStore32(&scheduler->jobCount, scheduler->jobCount - 1);
+
+		fiber = scheduler->freeFibers;
+		scheduler->freeFibers = fiber->next;
+		psp2AtomicStore32(&scheduler->freeCount, scheduler->freeCount - 1);
+
+		fiber->job = job;
+		worker->startCount++;
+	}
+
+	psp2FiberJobUnlock(scheduler);
+
+	if (fiber == NULL)
+		return 0;
+
+	ret = sceFiberRun(&fiber->fiber, 0, NULL);
+	if (ret < 0) {
+		if (job == NULL) {
+			psp2FiberJobReady(scheduler, fiber);
+			return 0;
+		}
+
+		fiber->job = NULL;
+
+		psp2FiberJobLock(scheduler);
+		job->next = scheduler->jobHead;
+		scheduler->jobHead = job;
+		if (scheduler->jobTail == NULL)
+			scheduler->jobTail = job;
+		psp2AtomicStore32(&scheduler->jobCount, scheduler->jobCount + 1);
+		fiber->next = scheduler->freeFibers;
+		scheduler->freeFibers = fiber;
+		psp2AtomicStore32(&scheduler->freeCount, scheduler->freeCount + 1);
+		psp2FiberJobUnlock(scheduler);
+
+		return 0;
+	}
+
+	if (fiber->counter != NULL) {
+		if (psp2JobCounterPark(fiber->counter, fiber->index + 1) < 0)
+			psp2FiberJobReady(scheduler, fiber);
+	} else {
+		psp2FiberJobLock(scheduler);
+		fiber->next = scheduler->freeFibers;
+		scheduler->freeFibers = fiber;
+		psp2AtomicStore32(&scheduler->freeCount, scheduler->freeCount + 1);
+		psp2FiberJobUnlock(scheduler);
+	}
+
+	return 1;
+}
+
+/* Sleep until there is work, the scheduler quits, or the counter reaches zero */
+static inline void psp2FiberJobSleep(Psp2FiberJobWorker *worker,
+	Psp2FiberJobCounter *counter)
+{
+	Psp2FiberJobScheduler *scheduler;
+	int idle;
+
+	scheduler = worker->scheduler;
+	psp2JobThreadsBeginSleep(&scheduler->threads, worker->index);
+
+	idle = psp2AtomicLoad32(&scheduler->readyCount) == 0
+		&& (psp2AtomicLoad32(&scheduler->jobCount) == 0
+			|| psp2AtomicLoad32(&scheduler->freeCount) == 0)
+		&& !psp2AtomicLoad32(&scheduler->threads.quit)
+		&& (counter == NULL || psp2JobCounterPark(counter,
+			PSP2_FIBER_JOB_MAX_FIBERS + 1 + worker->index) == 0);
+	if (idle)
+		worker->sleepCount++;
+
+	psp2JobThreadsEndSleep(&scheduler->threads, worker->index, idle);
+}
+
+/**
+ * Runs a job on any worker.
+ *
+ * @param[in,out]	scheduler	The scheduler.
+ * @param[in,out]	job			The job.  It must persist until it is done.
+ * @param[in,out]	counter		The counter to count the job down when it is
+ * 								done, or NULL.  It counts at most
+ * 								#PSP2_FIBER_JOB_COUNTER_MAX jobs.
+ */
+static inline void psp2FiberJobRun(Psp2FiberJobScheduler *scheduler,
+	Psp2FiberJob *job, Psp2FiberJobCounter *counter)
+{
+	job->counter = counter;
+	job->next = NULL;
+	if (counter != NULL)
+		psp2AtomicGetAndAdd32(&counter->value, 1);
+
+	psp2FiberJobLock(scheduler);
+	if (scheduler->jobTail != NULL)
+		scheduler->jobTail->next = job;
+	else
+		scheduler->jobHead = job;
+	scheduler->jobTail = job;
+	psp2AtomicStore32(&scheduler->jobCount, scheduler->jobCount + 1);
+	psp2FiberJobUnlock(scheduler);
+
+	if (psp2AtomicLoad32(&scheduler->threads.sleepMask) != 0)
+		psp2JobThreadsWakeOne(&scheduler->threads);
+}
+
+/**
+ * Waits until a counter reaches zero.  A job parks its fiber on the counter
+ * and lets its worker run other jobs; the thread that initialized the
+ * scheduler runs jobs until then, which it cannot do from a fiber.
+ *
+ * @param[in,out]	scheduler	The scheduler.
+ * @param[in,out]	counter		The counter.
+ *
+ * @retval
+ * 0	The counter reached zero.
+ * @retval
+ * SCE_KERNEL_ERROR_ILLEGAL_CONTEXT The caller is neither a job nor the thread
+ * that initialized the scheduler outside of any fiber.  The counter is left
+ * as is.
+ */
+static inline int psp2FiberJobWait(Psp2FiberJobScheduler *scheduler,
+	Psp2FiberJobCounter *counter)
+{
+	Psp2FiberJobFiber *fiber;
+	Psp2FiberJobWorker *worker;
+	SceFiber *self;
+	uint32_t spin;
+
+	if ((psp2AtomicLoad32(&counter->value) & PSP2_FIBER_JOB_COUNTER_MAX) == 0)
+		return 0;
+
+	fiber = NULL;
+	if (sceFiberGetSelf(&self) == 0) {
+		fiber = (Psp2FiberJobFiber *)self;
+		// sceFiberRun() fails on a fiber, so only a job may wait on one.
+		if (fiber < scheduler->fibers
+			|| fiber >= scheduler->fibers + scheduler->fiberCount)
+			return SCE_KERNEL_ERROR_ILLEGAL_CONTEXT;
+	}
+
+	if (fiber != NULL) {
+		fiber->counter = counter;
+		sceFiberReturnToThread(0, NULL);
+		fiber->counter = NULL;
+	} else if (sceKernelGetThreadId() == scheduler->thread) {
+		worker = scheduler->workers;
+		spin = 0;
+		while ((psp2AtomicLoad32(&counter->value)
+			& PSP2_FIBER_JOB_COUNTER_MAX) != 0) {
+			if (psp2FiberJobStep(worker)) {
+				spin = 0;
+			} else if (++spin >= scheduler->threads.spinCount) {
+				psp2FiberJobSleep(worker, counter);
+				spin = 0;
+			}
+		}
+	} else
+		return SCE_KERNEL_ERROR_ILLEGAL_CONTEXT;
+
+	// Only the waiter is left to touch the counter.
+	psp2AtomicStore32(&counter->value, 0);
+
+	return 0;
+}
+
+static inline int psp2FiberJobThread(SceSize args, void *argp)
+{
+	Psp2FiberJobScheduler *scheduler;
+	Psp2FiberJobWorker *worker;
+	uint32_t spin;
+
+	(void)args;
+	worker = *(Psp2FiberJobWorker **)argp;
+	scheduler = worker->scheduler;
+
+	spin = 0;
+	while (!psp2AtomicLoad32(&scheduler->threads.quit)) {
+		if (psp2FiberJobStep(worker)) {
+			spin = 0;
+		} else if (++spin >= scheduler->threads.spinCount) {
+			psp2FiberJobSleep(worker, NULL);
+			spin = 0;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * Terminates a scheduler: stops the worker threads once they are idle and
+ * finalizes the fibers.  The jobs must be done.
+ *
+ * @param[in,out]	scheduler	The scheduler.
+ */
+static inline void psp2FiberJobSchedulerTerm(Psp2FiberJobScheduler *scheduler)
+{
+	uint32_t i;
+
+	psp2JobThreadsTerm(&scheduler->threads);
+
+	for (i = 0; i < scheduler->fiberCount; i++)
+		sceFiberFinalize(&scheduler->fibers[i].fiber);
+	scheduler->fiberCount = 0;
+}
+
+/**
+ * Initializes a scheduler, its fibers, and starts its worker threads.
+ *
+ * @param[out]	scheduler	The scheduler.
+ * @param[in]	params		The parameters.  This structure does not need to
+ * 							persist after the call.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_KERNEL_ERROR_INVALID_ARGUMENT The number of workers or of fibers is not
+ * valid.
+ * @retval
+ * <0 The error returned by the initialization of a fiber, or by the creation
+ * of the event flag or of a thread.
+ */
+static inline int psp2FiberJobSchedulerInit(Psp2FiberJobScheduler *scheduler,
+	const Psp2FiberJobSchedulerParams *params)
+{
+	Psp2FiberJobFiber *fiber;
+	uint32_t i;
+	int ret;
+
+	__builtin_memset(scheduler, 0, sizeof(*scheduler));
+
+	if (params->workerCount == 0
+		|| params->workerCount > PSP2_FIBER_JOB_MAX_WORKERS
+		|| params->fiberCount < params->workerCount
+		|| params->fiberCount > PSP2_FIBER_JOB_MAX_FIBERS)
+		return SCE_KERNEL_ERROR_INVALID_ARGUMENT;
+
+	scheduler->thread = sceKernelGetThreadId();
+	for (i = 0; i < PSP2_FIBER_JOB_MAX_WORKERS; i++) {
+		scheduler->workers[i].scheduler = scheduler;
+		scheduler->workers[i].index = i;
+	}
+
+	ret = psp2JobThreadsInit(&scheduler->threads, "psp2FiberJobScheduler",
+		params->workerCount, params->spinCount != 0 ?
+			params->spinCount : PSP2_FIBER_JOB_DEFAULT_SPIN_COUNT);
+	if (ret < 0)
+		return ret;
+
+	for (i = 0; i < params->fiberCount; i++) {
+		fiber = scheduler->fibers + i;
+		fiber->scheduler = scheduler;
+		fiber->index = i;
+
+		ret = sceFiberInitialize(&fiber->fiber, "psp2FiberJob",
+			psp2FiberJobEntry, 0,
+			(char *)params->contexts + i * params->contextSize,
+			params->contextSize, NULL);
+		if (ret < 0)
+			goto fail;
+		scheduler->fiberCount = i + 1;
+
+		fiber->next = scheduler->freeFibers;
+		scheduler->freeFibers = fiber;
+	}
+	scheduler->freeCount = params->fiberCount;
+
+	for (i = 1; i < params->workerCount; i++) {
+		ret = psp2JobThreadsStart(&scheduler->threads, i,
+			"psp2FiberJobWorker", psp2FiberJobThread, params->priority,
+			params->stackSize, params->cpuAffinityMask[i],
+			scheduler->workers + i);
+		if (ret < 0)
+			goto fail;
+	}
+
+	return 0;
+
+fail:
+	psp2FiberJobSchedulerTerm(scheduler);
+	return ret;
+}
+
+#ifdef	__cplusplus
+}
+#endif	// def __cplusplus
+
+#endif /* _PSP2_FIBER_JOBS_H_ */
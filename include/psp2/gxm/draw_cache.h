@@ -0,0 +1,427 @@
+/**
+ * \file draw_cache.h
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+
+#ifndef _PSP2_GXM_DRAW_CACHE_H_
+#define _PSP2_GXM_DRAW_CACHE_H_
+
+/**
+ * @file
+ *
+ * A cache of precomputed draws and states, built from mesh and material
+ * descriptors.
+ *
+ * The cache builds a #SceGxmPrecomputedDraw, #SceGxmPrecomputedVertexState
+ * and #SceGxmPrecomputedFragmentState the first time a mesh is drawn with a
+ * material, in memory allocated from a heap of <c>psp2/gxm/heap.h</c>, and
+ * draws with #sceGxmDrawPrecomputed() afterwards, which skips the validation
+ * of the state at each draw call.
+ *
+ * A descriptor that changes must have its revision incremented.  The cache
+ * then patches the textures, uniform buffers, vertex streams and draw
+ * parameters of the precomputed objects in place, and builds them again if
+ * a program changed.  As for the functions of
+ * <c>psp2/gxm/precomputation.h</c>, it is the responsibility of the caller to
+ * ensure that the GPU no longer uses the objects of a descriptor when it is
+ * changed.
+ *
+ * A cache is not thread-safe.
+ */
+#include <psp2/gxm/context.h>
+#include <psp2/gxm/heap.h>
+#include <psp2/gxm/precomputation.h>
+
+#ifdef	__cplusplus
+extern "C" {
+#endif	// def __cplusplus
+
+/**
+ * A mesh: the vertex streams and parameters of a draw call.
+ *
+ * @ingroup render
+ */
+typedef struct Psp2GxmMesh {
+	const void *vertexStreams[SCE_GXM_MAX_VERTEX_STREAMS];	//!< The vertex streams.
+	SceGxmPrimitiveType primType;		//!< The type of primitive.
+	SceGxmIndexFormat indexType;		//!< The type of the indices.
+	const void *indexData;				//!< The indices.
+	uint32_t indexCount;				//!< The number of indices.
+	uint32_t indexWrap;					//!< The number of indices of an instance, or 0 if the mesh is not instanced.
+	uint32_t revision;					//!< Incremented when the mesh changes.
+} Psp2GxmMesh;
+
+/**
+ * A material: the programs and the resources they use.
+ *
+ * @ingroup render
+ */
+typedef struct Psp2GxmMaterial {
+	const SceGxmVertexProgram *vertexProgram;
+	const SceGxmFragmentProgram *fragmentProgram;
+	SceGxmTexture vertexTextures[SCE_GXM_MAX_TEXTURE_UNITS];
+	SceGxmTexture fragmentTextures[SCE_GXM_MAX_TEXTURE_UNITS];
+	const void *vertexUniformBuffers[SCE_GXM_MAX_UNIFORM_BUFFERS];
+	const void *fragmentUniformBuffers[SCE_GXM_MAX_UNIFORM_BUFFERS];
+	const void *vertexDefaultUniformBuffer;		//!< The vertex default uniform buffer, or <c>NULL</c>.
+	const void *fragmentDefaultUniformBuffer;	//!< The fragment default uniform buffer, or <c>NULL</c>.
+	uint32_t revision;					//!< Incremented when the material changes.
+} Psp2GxmMaterial;
+
+/**
+ * An entry of a draw cache.
+ *
+ * @ingroup render
+ */
+typedef struct Psp2GxmDrawCacheEntry {
+	const Psp2GxmMesh *mesh;			//!< The mesh, or <c>NULL</c> if the entry is empty.
+	const Psp2GxmMaterial *material;
+	const SceGxmVertexProgram *vertexProgram;		//!< The vertex program the objects were built for.
+	const SceGxmFragmentProgram *fragmentProgram;	//!< The fragment program the objects were built for.
+	uint32_t meshRevision;
+	uint32_t materialRevision;
+	void *mem;							//!< The memory of the objects, or <c>NULL</c> if they are not built.
+	SceGxmPrecomputedDraw draw;
+	SceGxmPrecomputedVertexState vertexState;
+	SceGxmPrecomputedFragmentState fragmentState;
+} Psp2GxmDrawCacheEntry;
+
+/**
+ * A cache of precomputed draws and states, an open addressing hash table.
+ *
+ * @ingroup render
+ */
+typedef struct Psp2GxmDrawCache {
+	Psp2GxmHeap *heap;
+	Psp2GxmDrawCacheEntry *entries;
+	uint32_t mask;
+	uint32_t count;
+	uint32_t hits;						//!< The number of draws with up-to-date objects.
+	uint32_t builds;					//!< The number of times objects were built.
+	uint32_t patches;					//!< The number of times objects were patched.
+} Psp2GxmDrawCache;
+
+/**
+ * Initializes a draw cache.
+ *
+ * @param[out]	cache		The cache.
+ * @param[in]	heap		The heap to allocate the objects from, mapped for reading.
+ * @param[in]	entries		The storage for the entries.
+ * @param[in]	capacity	The number of entries, a power of two.  The cache holds up
+ * 							to three quarters of this number of mesh and material pairs.
+ *
+ * @retval
+ * SCE_OK	The operation was completed successfully.
+ * @retval
+ * SCE_GXM_ERROR_INVALID_VALUE The capacity is not a power of two.
+ *
+ * @ingroup render
+ */
+static inline SceGxmErrorCode psp2GxmDrawCacheInit(Psp2GxmDrawCache *cache,
+	Psp2GxmHeap *heap, Psp2GxmDrawCacheEntry *entries, uint32_t capacity)
+{
+	uint32_t i;
+
+	if (capacity < 4 || (capacity & (capacity - 1)))
+		return SCE_GXM_ERROR_INVALID_VALUE;
+
+	cache->heap = heap;
+	cache->entries = entries;
+	cache->mask = capacity - 1;
+	cache->count = 0;
+	cache->hits = 0;
+	cache->builds = 0;
+	cache->patches = 0;
+	for (i = 0; i < capacity; i++)
+		entries[i].mesh = NULL;
+
+	return SCE_OK;
+}
+
+static inline int psp2GxmDrawCachePatchMesh(Psp2GxmDrawCacheEntry *entry,
+	const Psp2GxmMesh *mesh)
+{
+	int ret;
+
+	ret = sceGxmPrecomputedDrawSetAllVertexStreams(&entry->draw,
+		mesh->vertexStreams);
+	if (ret < 0)
+		return ret;
+
+	if (mesh->indexWrap != 0)
+		ret = sceGxmPrecomputedDrawSetParamsInstanced(&entry->draw,
+			mesh->primType, mesh->indexType, mesh->indexData,
+			mesh->indexCount, mesh->indexWrap);
+	else
+		ret = sceGxmPrecomputedDrawSetParams(&entry->draw,
+			mesh->primType, mesh->indexType, mesh->indexData,
+			mesh->indexCount);
+	if (ret < 0)
+		return ret;
+
+	entry->meshRevision = mesh->revision;
+	return SCE_OK;
+}
+
+static inline int psp2GxmDrawCachePatchMaterial(Psp2GxmDrawCacheEntry *entry,
+	const Psp2GxmMaterial *material)
+{
+	int ret;
+
+	ret = sceGxmPrecomputedVertexStateSetAllTextures(&entry->vertexState,
+		material->vertexTextures);
+	if (ret < 0)
+		return ret;
+
+	ret = sceGxmPrecomputedVertexStateSetAllUniformBuffers(
+		&entry->vertexState, material->vertexUniformBuffers);
+	if (ret < 0)
+		return ret;
+
+	if (material->vertexDefaultUniformBuffer != NULL) {
+		ret = sceGxmPrecomputedVertexStateSetDefaultUniformBuffer(
+			&entry->vertexState, material->vertexDefaultUniformBuffer);
+		if (ret < 0)
+			return ret;
+	}
+
+	ret = sceGxmPrecomputedFragmentStateSetAllTextures(&entry->fragmentState,
+		material->fragmentTextures);
+	if (ret < 0)
+		return ret;
+
+	ret = sceGxmPrecomputedFragmentStateSetAllUniformBuffers(
+		&entry->fragmentState, material->fragmentUniformBuffers);
+	if (ret < 0)
+		return ret;
+
+	if (material->fragmentDefaultUniformBuffer != NULL) {
+		ret = sceGxmPrecomputedFragmentStateSetDefaultUniformBuffer(
+			&entry->fragmentState, material->fragmentDefaultUniformBuffer);
+		if (ret < 0)
+			return ret;
+	}
+
+	entry->materialRevision = material->revision;
+	return SCE_OK;
+}
+
+static inline int psp2GxmDrawCacheBuild(Psp2GxmDrawCache *cache,
+	Psp2GxmDrawCacheEntry *entry)
+{
+	const Psp2GxmMaterial *material;
+	uint32_t drawSize, vertexStateSize, fragmentStateSize;
+	char *mem;
+	int ret;
+
+	material = entry->material;
+
+	if (entry->mem != NULL) {
+		psp2GxmHeapFree(cache->heap, entry->mem);
+		entry->mem = NULL;
+	}
+
+	drawSize = sceGxmGetPrecomputedDrawSize(material->vertexProgram);
+	drawSize = (drawSize + SCE_GXM_PRECOMPUTED_ALIGNMENT - 1)
+		& ~(SCE_GXM_PRECOMPUTED_ALIGNMENT - 1);
+	vertexStateSize = sceGxmGetPrecomputedVertexStateSize(
+		material->vertexProgram);
+	vertexStateSize = (vertexStateSize + SCE_GXM_PRECOMPUTED_ALIGNMENT - 1)
+		& ~(SCE_GXM_PRECOMPUTED_ALIGNMENT - 1);
+	fragmentStateSize = sceGxmGetPrecomputedFragmentStateSize(
+		material->fragmentProgram);
+
+	mem = (char *)psp2GxmHeapAlloc(cache->heap,
+		drawSize + vertexStateSize + fragmentStateSize,
+		SCE_GXM_PRECOMPUTED_ALIGNMENT);
+	if (mem == NULL)
+		return SCE_GXM_ERROR_OUT_OF_MEMORY;
+
+	ret = sceGxmPrecomputedDrawInit(&entry->draw,
+		material->vertexProgram, mem);
+	if (ret < 0)
+		goto fail;
+
+	ret = sceGxmPrecomputedVertexStateInit(&entry->vertexState,
+		material->vertexProgram, mem + drawSize);
+	if (ret < 0)
+		goto fail;
+
+	ret = sceGxmPrecomputedFragmentStateInit(&entry->fragmentState,
+		material->fragmentProgram, mem + drawSize + vertexStateSize);
+	if (ret < 0)
+		goto fail;
+
+	ret = psp2GxmDrawCachePatchMesh(entry, entry->mesh);
+	if (ret < 0)
+		goto fail;
+
+	ret = psp2GxmDrawCachePatchMaterial(entry, material);
+	if (ret < 0)
+		goto fail;
+
+	entry->mem = mem;
+	entry->vertexProgram = material->vertexProgram;
+	entry->fragmentProgram = material->fragmentProgram;
+	cache->builds++;
+
+	return SCE_OK;
+
+fail:
+	psp2GxmHeapFree(cache->heap, mem);
+	return ret;
+}
+
+/**
+ * Finds the precomputed objects of a mesh drawn with a material in a cache,
+ * or builds them and adds them.  Objects whose mesh or material changed
+ * revision are patched or built again.
+ *
+ * @param[in,out]	cache		The cache.
+ * @param[in]		mesh		The mesh.  It must persist until the cache is cleared.
+ * @param[in]		material	The material.  It must persist until the cache is cleared.
+ * @param[out]		entry		Receives the entry of the objects.
+ *
+ * @retval
+ * SCE_OK	The operation was completed successfully.
+ * @retval
+ * SCE_GXM_ERROR_OUT_OF_HOST_MEMORY The cache is full.
+ * @retval
+ * SCE_GXM_ERROR_OUT_OF_MEMORY The heap could not allocate the objects.
+ * @retval
+ * <0 The error returned by the initialization or the patching of an object.
+ *
+ * @ingroup render
+ */
+static inline SceGxmErrorCode psp2GxmDrawCacheGet(Psp2GxmDrawCache *cache,
+	const Psp2GxmMesh *mesh, const Psp2GxmMaterial *material,
+	Psp2GxmDrawCacheEntry **entry)
+{
+	Psp2GxmDrawCacheEntry *e;
+	uint32_t hash;
+	int ret;
+
+	hash = (uintptr_t)mesh * 0x9E3779B1U ^ (uintptr_t)material * 0x85EBCA77U;
+	hash ^= hash >> 15;
+
+	for (;; hash++) {
+		e = cache->entries + (hash & cache->mask);
+		if (e->mesh == NULL || (e->mesh == mesh && e->material == material))
+			break;
+	}
+
+	if (e->mesh == NULL) {
+		if (cache->count >= cache->mask - (cache->mask >> 2))
+			return SCE_GXM_ERROR_OUT_OF_HOST_MEMORY;
+
+		e->mesh = mesh;
+		e->material = material;
+		e->mem = NULL;
+		ret = psp2GxmDrawCacheBuild(cache, e);
+		if (ret < 0) {
+			e->mesh = NULL;
+			return ret;
+		}
+
+		cache->count++;
+	} else if (e->mem == NULL
+		|| e->vertexProgram != material->vertexProgram
+		|| e->fragmentProgram != material->fragmentProgram) {
+		ret = psp2GxmDrawCacheBuild(cache, e);
+		if (ret < 0)
+			return ret;
+	} else if (e->meshRevision != mesh->revision
+		|| e->materialRevision != material->revision) {
+		if (e->meshRevision != mesh->revision) {
+			ret = psp2GxmDrawCachePatchMesh(e, mesh);
+			if (ret < 0)
+				return ret;
+		}
+
+		if (e->materialRevision != material->revision) {
+			ret = psp2GxmDrawCachePatchMaterial(e, material);
+			if (ret < 0)
+				return ret;
+		}
+
+		cache->patches++;
+	} else
+		cache->hits++;
+
+	*entry = e;
+	return SCE_OK;
+}
+
+/**
+ * Draws a mesh with a material through a cache: sets the programs and the
+ * precomputed states of the material on the context, and draws with
+ * #sceGxmDrawPrecomputed().
+ *
+ * The precomputed states stay set on the context.  They must be unset with
+ * #sceGxmSetPrecomputedVertexState() and #sceGxmSetPrecomputedFragmentState()
+ * before drawing with #sceGxmDraw().
+ *
+ * @param[in,out]	cache		The cache.
+ * @param[in,out]	context		The context.
+ * @param[in]		mesh		The mesh.
+ * @param[in]		material	The material.
+ *
+ * @retval
+ * SCE_OK	The operation was completed successfully.
+ * @retval
+ * <0 The error returned by #psp2GxmDrawCacheGet() or #sceGxmDrawPrecomputed().
+ *
+ * @ingroup render
+ */
+static inline SceGxmErrorCode psp2GxmDrawCacheDraw(Psp2GxmDrawCache *cache,
+	SceGxmContext *context, const Psp2GxmMesh *mesh,
+	const Psp2GxmMaterial *material)
+{
+	Psp2GxmDrawCacheEntry *entry;
+	int ret;
+
+	ret = psp2GxmDrawCacheGet(cache, mesh, material, &entry);
+	if (ret < 0)
+		return ret;
+
+	sceGxmSetVertexProgram(context, entry->vertexProgram);
+	sceGxmSetFragmentProgram(context, entry->fragmentProgram);
+	sceGxmSetPrecomputedVertexState(context, &entry->vertexState);
+	sceGxmSetPrecomputedFragmentState(context, &entry->fragmentState);
+
+	return sceGxmDrawPrecomputed(context, &entry->draw);
+}
+
+/**
+ * Frees all the objects of a cache and empties it.  It is the responsibility
+ * of the caller to ensure that the GPU no longer uses the objects.
+ *
+ * @param[in,out]	cache	The cache.
+ *
+ * @ingroup render
+ */
+static inline void psp2GxmDrawCacheClear(Psp2GxmDrawCache *cache)
+{
+	uint32_t i;
+
+	for (i = 0; i <= cache->mask; i++)
+		if (cache->entries[i].mesh != NULL) {
+			if (cache->entries[i].mem != NULL)
+				psp2GxmHeapFree(cache->heap, cache->entries[i].mem);
+			cache->entries[i].mesh = NULL;
+		}
+
+	cache->count = 0;
+}
+
+#ifdef	__cplusplus
+}
+#endif	// def __cplusplus
+
+#endif /* _PSP2_GXM_DRAW_CACHE_H_ */
@@ -0,0 +1,829 @@
+/**
+ * \file heap.h
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+
+#ifndef _PSP2_GXM_HEAP_H_
+#define _PSP2_GXM_HEAP_H_
+
+/**
+ * @file
+ *
+ * GPU memory heap.
+ *
+ * The heap allocates memory blocks with #sceKernelAllocMemBlock(), maps them
+ * with #sceGxmMapMemory(), or as USSE code, and suballocates them, so that
+ * resources do not each take a memory block of their own. It grows by one
+ * memory block at a time when it runs out of space.
+ *
+ * The allocator is a two-level segregated fit (TLSF) allocator: free blocks
+ * are kept in size classes, 16 per power of two, and bitmaps of the
+ * non-empty classes find a fitting block in constant time. Freed blocks are
+ * merged with their free neighbours at once. The block descriptors live in
+ * a workspace in CPU memory supplied by the caller, never in the GPU memory
+ * itself, which is uncached or in CDRAM.
+ *
+ * A heap is not thread-safe.
+ */
+#include <psp2/gxm/memory.h>
+
+#ifdef	__cplusplus
+extern "C" {
+#endif	// def __cplusplus
+
+/**
+ * The allocation granularity of the heap in bytes, and the default alignment.
+ *
+ * @ingroup render
+ */
+#define PSP2_GXM_HEAP_GRANULE				16U
+
+/**
+ * The maximum number of memory blocks that a heap allocates.
+ *
+ * @ingroup render
+ */
+#define PSP2_GXM_HEAP_MAX_REGIONS			16
+
+#define PSP2_GXM_HEAP_GRANULE_LOG2			4
+#define PSP2_GXM_HEAP_SL_LOG2				4
+#define PSP2_GXM_HEAP_SL_COUNT				(1 << PSP2_GXM_HEAP_SL_LOG2)
+#define PSP2_GXM_HEAP_SMALL_SIZE			\
+	(1U << (PSP2_GXM_HEAP_SL_LOG2 + PSP2_GXM_HEAP_GRANULE_LOG2))
+#define PSP2_GXM_HEAP_FL_COUNT				\
+	(32 - PSP2_GXM_HEAP_SL_LOG2 - PSP2_GXM_HEAP_GRANULE_LOG2 + 1)
+
+/**
+ * The descriptor of a block of the heap.
+ *
+ * @ingroup render
+ */
+typedef struct Psp2GxmHeapBlock {
+	char *base;							//!< The address of the block.
+	uint32_t size;						//!< The size of the block in bytes.
+	uint32_t isFree;					//!< Nonzero if the block is free.
+	struct Psp2GxmHeapBlock *prevPhys;	//!< The block before in memory, or <c>NULL</c>.
+	struct Psp2GxmHeapBlock *nextPhys;	//!< The block after in memory, or <c>NULL</c>.
+	struct Psp2GxmHeapBlock *prevFree;	//!< The previous block of the free list.
+	struct Psp2GxmHeapBlock *next;		//!< The next block of the free list, hash chain or descriptor pool.
+} Psp2GxmHeapBlock;
+
+/**
+ * How a heap maps its memory blocks for the GPU.
+ *
+ * @ingroup render
+ */
+typedef enum Psp2GxmHeapMapping {
+	PSP2_GXM_HEAP_MAPPING_MEMORY		= 0,	//!< Map with #sceGxmMapMemory().
+	PSP2_GXM_HEAP_MAPPING_VERTEX_USSE	= 1,	//!< Map with #sceGxmMapVertexUsseMemory().
+	PSP2_GXM_HEAP_MAPPING_FRAGMENT_USSE	= 2,	//!< Map with #sceGxmMapFragmentUsseMemory().
+	PSP2_GXM_HEAP_MAPPING_USSE			= 3		//!< Map as both vertex and fragment USSE code.
+} Psp2GxmHeapMapping;
+
+/**
+ * The size in bytes of a workspace for a heap with up to <c><i>blocks</i></c>
+ * blocks, free or allocated, at a time.
+ *
+ * @ingroup render
+ */
+#define PSP2_GXM_HEAP_WORKSPACE_SIZE(blocks)	\
+	((blocks) * (sizeof(Psp2GxmHeapBlock) + 2 * sizeof(Psp2GxmHeapBlock *)))
+
+/**
+ * The parameters of #psp2GxmHeapInit().
+ *
+ * @ingroup render
+ */
+typedef struct Psp2GxmHeapParams {
+	const char *name;				//!< The name of the memory blocks.
+	SceKernelMemBlockType type;		//!< The memory block type, such as #SCE_KERNEL_MEMBLOCK_TYPE_USER_CDRAM_RW.
+	uint32_t attribs;				//!< The #SceGxmMemoryAttribFlags to map the memory with, for #PSP2_GXM_HEAP_MAPPING_MEMORY.
+	uint32_t regionSize;			//!< The size of each memory block the heap allocates.
+	uint32_t maxSize;				//!< The maximum total size of the memory blocks, or 0 for no limit.
+	void *workspace;				//!< The workspace for the block descriptors, 4-byte aligned.
+	uint32_t workspaceSize;			//!< The size of the workspace in bytes.
+	uint32_t mapping;				//!< How to map the memory, from #Psp2GxmHeapMapping.
+} Psp2GxmHeapParams;
+
+/**
+ * A memory block of the heap.
+ *
+ * @ingroup render
+ */
+typedef struct Psp2GxmHeapRegion {
+	SceUID uid;
+	char *base;
+	uint32_t size;
+	uint32_t vertexUsseOffset;
+	uint32_t fragmentUsseOffset;
+} Psp2GxmHeapRegion;
+
+/**
+ * Statistics of a heap.
+ *
+ * @ingroup render
+ */
+typedef struct Psp2GxmHeapStats {
+	uint32_t regionCount;			//!< The number of memory blocks.
+	uint32_t totalSize;				//!< The total size of the memory blocks.
+	uint32_t usedSize;				//!< The size of the allocated blocks.
+	uint32_t peakUsedSize;			//!< The highest <c>usedSize</c> so far.
+	uint32_t freeSize;				//!< The size of the free blocks.
+	uint32_t largestFreeSize;		//!< The size of the largest free block.
+	uint32_t allocCount;			//!< The number of allocated blocks.
+	uint32_t freeCount;				//!< The number of free blocks.
+	uint32_t fragmentation;			//!< The percentage of free memory outside of the largest free block.
+} Psp2GxmHeapStats;
+
+/**
+ * A GPU memory heap.
+ *
+ * @ingroup render
+ */
+typedef struct Psp2GxmHeap {
+	Psp2GxmHeapParams params;
+	uint32_t flBitmap;
+	uint32_t slBitmap[PSP2_GXM_HEAP_FL_COUNT];
+	Psp2GxmHeapBlock *freeLists[PSP2_GXM_HEAP_FL_COUNT][PSP2_GXM_HEAP_SL_COUNT];
+	Psp2GxmHeapBlock *pool;
+	Psp2GxmHeapBlock **buckets;
+	uint32_t bucketShift;
+	uint32_t regionCount;
+	Psp2GxmHeapRegion regions[PSP2_GXM_HEAP_MAX_REGIONS];
+	uint32_t totalSize;
+	uint32_t usedSize;
+	uint32_t peakUsedSize;
+	uint32_t allocCount;
+	uint32_t freeCount;
+} Psp2GxmHeap;
+
+static inline uint32_t psp2GxmHeapFls(uint32_t x)
+{
+	return 31 - __builtin_clz(x);
+}
+
+/* Return the size class of a free block of the given size */
+static inline void psp2GxmHeapMapping(uint32_t size, uint32_t *fl, uint32_t *sl)
+{
+	uint32_t bit;
+
+	if (size < PSP2_GXM_HEAP_SMALL_SIZE) {
+		*fl = 0;
+		*sl = size >> PSP2_GXM_HEAP_GRANULE_LOG2;
+	} else {
+		bit = psp2GxmHeapFls(size);
+		*fl = bit - (PSP2_GXM_HEAP_SL_LOG2 + PSP2_GXM_HEAP_GRANULE_LOG2) + 1;
+		*sl = (size >> (bit - PSP2_GXM_HEAP_SL_LOG2)) ^ PSP2_GXM_HEAP_SL_COUNT;
+	}
+}
+
+static inline void psp2GxmHeapInsertFree(Psp2GxmHeap *heap,
+	Psp2GxmHeapBlock *block)
+{
+	Psp2GxmHeapBlock **head;
+	uint32_t fl, sl;
+
+	psp2GxmHeapMapping(block->size, &fl, &sl);
+	head = &heap->freeLists[fl][sl];
+
+	block->isFree = 1;
+	block->prevFree = NULL;
+	block->next = *head;
+	if (*head != NULL)
+		(*head)->prevFree = block;
+	*head = block;
+
+	heap->flBitmap |= 1U << fl;
+	heap->slBitmap[fl] |= 1U << sl;
+	heap->freeCount++;
+}
+
+static inline void psp2GxmHeapRemoveFree(Psp2GxmHeap *heap,
+	Psp2GxmHeapBlock *block)
+{
+	uint32_t fl, sl;
+
+	psp2GxmHeapMapping(block->size, &fl, &sl);
+
+	if (block->prevFree != NULL)
+		block->prevFree->next = block->next;
+	else
+		heap->freeLists[fl][sl] = block->next;
+	if (block->next != NULL)
+		block->next->prevFree = block->prevFree;
+
+	if (heap->freeLists[fl][sl] == NULL) {
+		heap->slBitmap[fl] &= ~(1U << sl);
+		if (heap->slBitmap[fl] == 0)
+			heap->flBitmap &= ~(1U << fl);
+	}
+
+	block->isFree = 0;
+	heap->freeCount--;
+}
+
+/* Round a size up to the next size class, so that any block of the class
+   fits.  Return 0 on overflow. */
+static inline uint32_t psp2GxmHeapRoundUp(uint32_t size)
+{
+	if (size >= PSP2_GXM_HEAP_SMALL_SIZE) {
+		if (size > 0xFFFFFFFFU - (1U << (psp2GxmHeapFls(size)
+				- PSP2_GXM_HEAP_SL_LOG2)))
+			return 0;
+		size += (1U << (psp2GxmHeapFls(size) - PSP2_GXM_HEAP_SL_LOG2)) - 1;
+	}
+
+	return size;
+}
+
+/* Return a free block of at least the given size, or NULL */
+static inline Psp2GxmHeapBlock *psp2GxmHeapFindFree(Psp2GxmHeap *heap,
+	uint32_t size)
+{
+	uint32_t fl, sl, map;
+
+	size = psp2GxmHeapRoundUp(size);
+	if (size == 0)
+		return NULL;
+	psp2GxmHeapMapping(size, &fl, &sl);
+
+	map = heap->slBitmap[fl] & (~0U << sl);
+	if (map == 0) {
+		if (fl + 1 >= PSP2_GXM_HEAP_FL_COUNT)
+			return NULL;
+		map = heap->flBitmap & (~0U << (fl + 1));
+		if (map == 0)
+			return NULL;
+		fl = __builtin_ctz(map);
+		map = heap->slBitmap[fl];
+	}
+
+	return heap->freeLists[fl][__builtin_ctz(map)];
+}
+
+static inline Psp2GxmHeapBlock *psp2GxmHeapNewBlock(Psp2GxmHeap *heap)
+{
+	Psp2GxmHeapBlock *block;
+
+	block = heap->pool;
+	if (block != NULL)
+		heap->pool = block->next;
+
+	return block;
+}
+
+static inline void psp2GxmHeapDeleteBlock(Psp2GxmHeap *heap,
+	Psp2GxmHeapBlock *block)
+{
+	block->next = heap->pool;
+	heap->pool = block;
+}
+
+/* Split the block at offset and return the block of the end */
+static inline Psp2GxmHeapBlock *psp2GxmHeapSplit(Psp2GxmHeap *heap,
+	Psp2GxmHeapBlock *block, uint32_t offset)
+{
+	Psp2GxmHeapBlock *end;
+
+	end = psp2GxmHeapNewBlock(heap);
+	end->base = block->base + offset;
+	end->size = block->size - offset;
+	end->isFree = 0;
+	end->prevPhys = block;
+	end->nextPhys = block->nextPhys;
+	if (end->nextPhys != NULL)
+		end->nextPhys->prevPhys = end;
+
+	block->size = offset;
+	block->nextPhys = end;
+
+	return end;
+}
+
+/* Merge the block after the given one into it */
+static inline void psp2GxmHeapMerge(Psp2GxmHeap *heap,
+	Psp2GxmHeapBlock *block)
+{
+	Psp2GxmHeapBlock *next;
+
+	next = block->nextPhys;
+	block->size += next->size;
+	block->nextPhys = next->nextPhys;
+	if (block->nextPhys != NULL)
+		block->nextPhys->prevPhys = block;
+
+	psp2GxmHeapDeleteBlock(heap, next);
+}
+
+static inline Psp2GxmHeapBlock **psp2GxmHeapBucket(Psp2GxmHeap *heap,
+	const void *ptr)
+{
+	uint32_t hash;
+
+	hash = ((uintptr_t)ptr >> PSP2_GXM_HEAP_GRANULE_LOG2) * 0x9E3779B1U;
+
+	return &heap->buckets[hash >> heap->bucketShift];
+}
+
+static inline SceGxmErrorCode psp2GxmHeapMap(Psp2GxmHeap *heap,
+	Psp2GxmHeapRegion *region)
+{
+	int ret;
+
+	if (heap->params.mapping == PSP2_GXM_HEAP_MAPPING_MEMORY)
+		return sceGxmMapMemory(region->base, region->size,
+			heap->params.attribs);
+
+	if (heap->params.mapping & PSP2_GXM_HEAP_MAPPING_VERTEX_USSE) {
+		ret = sceGxmMapVertexUsseMemory(region->base, region->size,
+			&region->vertexUsseOffset);
+		if (ret < 0)
+			return ret;
+	}
+
+	if (heap->params.mapping & PSP2_GXM_HEAP_MAPPING_FRAGMENT_USSE) {
+		ret = sceGxmMapFragmentUsseMemory(region->base, region->size,
+			&region->fragmentUsseOffset);
+		if (ret < 0) {
+			if (heap->params.mapping & PSP2_GXM_HEAP_MAPPING_VERTEX_USSE)
+				sceGxmUnmapVertexUsseMemory(region->base);
+			return ret;
+		}
+	}
+
+	return SCE_OK;
+}
+
+static inline void psp2GxmHeapUnmap(Psp2GxmHeap *heap,
+	Psp2GxmHeapRegion *region)
+{
+	if (heap->params.mapping == PSP2_GXM_HEAP_MAPPING_MEMORY)
+		sceGxmUnmapMemory(region->base);
+	if (heap->params.mapping & PSP2_GXM_HEAP_MAPPING_VERTEX_USSE)
+		sceGxmUnmapVertexUsseMemory(region->base);
+	if (heap->params.mapping & PSP2_GXM_HEAP_MAPPING_FRAGMENT_USSE)
+		sceGxmUnmapFragmentUsseMemory(region->base);
+
+	sceKernelFreeMemBlock(region->uid);
+}
+
+/* Allocate, map and add a memory block of at least the given size */
+static inline SceGxmErrorCode psp2GxmHeapGrow(Psp2GxmHeap *heap,
+	uint32_t size)
+{
+	Psp2GxmHeapRegion *region;
+	Psp2GxmHeapBlock *block;
+	uint32_t granularity;
+	void *base;
+	SceUID uid;
+	int ret;
+
+	if (heap->regionCount >= PSP2_GXM_HEAP_MAX_REGIONS)
+		return SCE_GXM_ERROR_OUT_OF_MEMORY;
+
+	/* CDRAM is allocated by 256 KiB, the main memory by 4 KiB */
+	granularity = heap->params.type == SCE_KERNEL_MEMBLOCK_TYPE_USER_CDRAM_RW ?
+		0x40000 : 0x1000;
+	if (size < heap->params.regionSize)
+		size = heap->params.regionSize;
+	if (size > 0xFFFFFFFFU - (granularity - 1))
+		return SCE_GXM_ERROR_OUT_OF_MEMORY;
+	size = (size + granularity - 1) & ~(granularity - 1);
+	if (heap->params.maxSize != 0
+		&& size > heap->params.maxSize - heap->totalSize)
+		return SCE_GXM_ERROR_OUT_OF_MEMORY;
+
+	block = psp2GxmHeapNewBlock(heap);
+	if (block == NULL)
+		return SCE_GXM_ERROR_OUT_OF_MEMORY;
+
+	uid = sceKernelAllocMemBlock(heap->params.name, heap->params.type,
+		size, NULL);
+	if (uid < 0) {
+		psp2GxmHeapDeleteBlock(heap, block);
+		return uid;
+	}
+
+	region = heap->regions + heap->regionCount;
+	ret = sceKernelGetMemBlockBase(uid, &base);
+	if (ret >= 0) {
+		region->base = (char *)base;
+		region->size = size;
+		ret = psp2GxmHeapMap(heap, region);
+	}
+	if (ret < 0) {
+		sceKernelFreeMemBlock(uid);
+		psp2GxmHeapDeleteBlock(heap, block);
+		return ret;
+	}
+
+	region->uid = uid;
+	heap->regionCount++;
+	heap->totalSize += size;
+
+	block->base = (char *)base;
+	block->size = size;
+	block->prevPhys = NULL;
+	block->nextPhys = NULL;
+	psp2GxmHeapInsertFree(heap, block);
+
+	return SCE_OK;
+}
+
+/**
+ * Initializes a heap and allocates its first memory block of
+ * <c><i>params->regionSize</i></c> bytes.
+ *
+ * @param[out]	heap	The heap.
+ * @param[in]	params	The parameters of the heap.
+ *
+ * @retval
+ * SCE_OK	The operation was completed successfully.
+ * @retval
+ * SCE_GXM_ERROR_INVALID_VALUE The workspace has room for fewer than 4 block descriptors.
+ * @retval
+ * SCE_GXM_ERROR_INVALID_ALIGNMENT The workspace is not aligned to 4 bytes.
+ * @retval
+ * <0 The error returned by #sceKernelAllocMemBlock() or the mapping function.
+ *
+ * @ingroup render
+ */
+static inline SceGxmErrorCode psp2GxmHeapInit(Psp2GxmHeap *heap,
+	const Psp2GxmHeapParams *params)
+{
+	Psp2GxmHeapBlock *blocks;
+	uint32_t count, bucketLog2, i;
+
+	if ((uintptr_t)params->workspace & 3)
+		return SCE_GXM_ERROR_INVALID_ALIGNMENT;
+
+	count = params->workspaceSize / PSP2_GXM_HEAP_WORKSPACE_SIZE(1);
+	if (count < 4)
+		return SCE_GXM_ERROR_INVALID_VALUE;
+
+	__builtin_memset(heap, 0, sizeof(*heap));
+	heap->params = *params;
+
+	/* Up to 2 buckets per descriptor, a power of two of them */
+	bucketLog2 = psp2GxmHeapFls(count) + 1;
+	blocks = (Psp2GxmHeapBlock *)params->workspace;
+	heap->buckets = (Psp2GxmHeapBlock **)(blocks + count);
+	heap->bucketShift = 32 - bucketLog2;
+	for (i = 0; i < 1U << bucketLog2; i++)
+		heap->buckets[i] = NULL;
+
+	for (i = count; i > 0; i--)
+		psp2GxmHeapDeleteBlock(heap, blocks + i - 1);
+
+	return psp2GxmHeapGrow(heap, params->regionSize);
+}
+
+/**
+ * Allocates memory from a heap, allocating a new memory block if no free
+ * block fits.
+ *
+ * @param[in,out]	heap		The heap.
+ * @param[in]		size		The size in bytes of the memory to allocate.
+ * @param[in]		alignment	The alignment of the memory, a power of two.  Alignments
+ * 							below #PSP2_GXM_HEAP_GRANULE are raised to it.
+ *
+ * @return
+ * A pointer to the allocated memory, or <c>NULL</c> if none can be allocated.
+ *
+ * @ingroup render
+ */
+static inline void *psp2GxmHeapAlloc(Psp2GxmHeap *heap, uint32_t size,
+	uint32_t alignment)
+{
+	Psp2GxmHeapBlock *block, **bucket;
+	uint32_t gap, search;
+
+	if (size == 0 || size > 0x80000000U
+		|| alignment > 0x80000000U || (alignment & (alignment - 1)))
+		return NULL;
+	if (alignment < PSP2_GXM_HEAP_GRANULE)
+		alignment = PSP2_GXM_HEAP_GRANULE;
+	size = (size + PSP2_GXM_HEAP_GRANULE - 1) & ~(PSP2_GXM_HEAP_GRANULE - 1);
+
+	/* A split takes up to 2 descriptors */
+	if (heap->pool == NULL || heap->pool->next == NULL)
+		return NULL;
+
+	/* Leave room to move the start to the alignment */
+	search = size + alignment - PSP2_GXM_HEAP_GRANULE;
+	if (search < size)
+		return NULL;
+
+	block = psp2GxmHeapFindFree(heap, search);
+	if (block == NULL) {
+		/* Grow by the size class searched for, or the new block may be
+		   too small to be found */
+		if (psp2GxmHeapRoundUp(search) == 0
+			|| psp2GxmHeapGrow(heap, psp2GxmHeapRoundUp(search)) < 0
+			|| heap->pool == NULL || heap->pool->next == NULL)
+			return NULL;
+		block = psp2GxmHeapFindFree(heap, search);
+		if (block == NULL)
+			return NULL;
+	}
+
+	psp2GxmHeapRemoveFree(heap, block);
+
+	gap = -(uintptr_t)block->base & (alignment - 1);
+	if (gap > 0) {
+		/* The block before is allocated, so the gap stays on its own */
+		block = psp2GxmHeapSplit(heap, block, gap);
+		psp2GxmHeapInsertFree(heap, block->prevPhys);
+	}
+
+	if (block->size > size)
+		psp2GxmHeapInsertFree(heap, psp2GxmHeapSplit(heap, block, size));
+
+	bucket = psp2GxmHeapBucket(heap, block->base);
+	block->next = *bucket;
+	*bucket = block;
+
+	heap->usedSize += block->size;
+	if (heap->peakUsedSize < heap->usedSize)
+		heap->peakUsedSize = heap->usedSize;
+	heap->allocCount++;
+
+	return block->base;
+}
+
+/**
+ * Frees memory allocated from a heap.  It is the responsibility of the caller
+ * to ensure that the GPU no longer uses the memory.
+ *
+ * @param[in,out]	heap	The heap.
+ * @param[in]		ptr		A pointer returned by #psp2GxmHeapAlloc(), or <c>NULL</c>.
+ *
+ * @retval
+ * SCE_OK	The operation was completed successfully.
+ * @retval
+ * SCE_GXM_ERROR_INVALID_POINTER The pointer was not allocated from the heap.
+ *
+ * @ingroup render
+ */
+static inline SceGxmErrorCode psp2GxmHeapFree(Psp2GxmHeap *heap, void *ptr)
+{
+	Psp2GxmHeapBlock *block, **link;
+
+	if (ptr == NULL)
+		return SCE_OK;
+
+	for (link = psp2GxmHeapBucket(heap, ptr); *link != NULL;
+		link = &(*link)->next)
+		if ((*link)->base == ptr)
+			break;
+	block = *link;
+	if (block == NULL)
+		return SCE_GXM_ERROR_INVALID_POINTER;
+	*link = block->next;
+
+	heap->usedSize -= block->size;
+	heap->allocCount--;
+
+	if (block->prevPhys != NULL && block->prevPhys->isFree) {
+		block = block->prevPhys;
+		psp2GxmHeapRemoveFree(heap, block);
+		psp2GxmHeapMerge(heap, block);
+	}
+	if (block->nextPhys != NULL && block->nextPhys->isFree) {
+		psp2GxmHeapRemoveFree(heap, block->nextPhys);
+		psp2GxmHeapMerge(heap, block);
+	}
+	psp2GxmHeapInsertFree(heap, block);
+
+	return SCE_OK;
+}
+
+/**
+ * Returns the size of an allocation, which is its requested size rounded up
+ * to #PSP2_GXM_HEAP_GRANULE.
+ *
+ * @param[in]	heap	The heap.
+ * @param[in]	ptr		A pointer returned by #psp2GxmHeapAlloc().
+ *
+ * @return
+ * The size in bytes, or 0 if the pointer was not allocated from the heap.
+ *
+ * @ingroup render
+ */
+static inline uint32_t psp2GxmHeapGetSize(Psp2GxmHeap *heap, const void *ptr)
+{
+	const Psp2GxmHeapBlock *block;
+
+	for (block = *psp2GxmHeapBucket(heap, ptr); block != NULL;
+		block = block->next)
+		if (block->base == ptr)
+			return block->size;
+
+	return 0;
+}
+
+/**
+ * Returns the memory block of a heap that contains a pointer.
+ *
+ * @param[in]	heap	The heap.
+ * @param[in]	ptr		A pointer into the heap.
+ *
+ * @return
+ * The memory block, or <c>NULL</c> if the pointer is not in the heap.
+ *
+ * @ingroup render
+ */
+static inline const Psp2GxmHeapRegion *psp2GxmHeapGetRegion(
+	const Psp2GxmHeap *heap, const void *ptr)
+{
+	uint32_t i;
+
+	for (i = 0; i < heap->regionCount; i++)
+		if ((uintptr_t)ptr - (uintptr_t)heap->regions[i].base
+				< heap->regions[i].size)
+			return heap->regions + i;
+
+	return NULL;
+}
+
+/**
+ * Gets the vertex USSE offset of a pointer into a heap mapped with
+ * #PSP2_GXM_HEAP_MAPPING_VERTEX_USSE or #PSP2_GXM_HEAP_MAPPING_USSE.
+ *
+ * @param[in]	heap		The heap.
+ * @param[in]	ptr			A pointer into the heap.
+ * @param[out]	usseOffset	The USSE offset.
+ *
+ * @retval
+ * SCE_OK	The operation was completed successfully.
+ * @retval
+ * SCE_GXM_ERROR_INVALID_VALUE	The heap is not mapped as vertex USSE code.
+ * @retval
+ * SCE_GXM_ERROR_INVALID_POINTER	The pointer is not in the heap.
+ *
+ * @ingroup render
+ */
+static inline SceGxmErrorCode psp2GxmHeapGetVertexUsseOffset(
+	const Psp2GxmHeap *heap, const void *ptr, uint32_t *usseOffset)
+{
+	const Psp2GxmHeapRegion *region;
+
+	if (!(heap->params.mapping & PSP2_GXM_HEAP_MAPPING_VERTEX_USSE))
+		return SCE_GXM_ERROR_INVALID_VALUE;
+
+	region = psp2GxmHeapGetRegion(heap, ptr);
+	if (region == NULL)
+		return SCE_GXM_ERROR_INVALID_POINTER;
+
+	*usseOffset = region->vertexUsseOffset
+		+ ((const char *)ptr - region->base);
+	return SCE_OK;
+}
+
+/**
+ * Gets the fragment USSE offset of a pointer into a heap mapped with
+ * #PSP2_GXM_HEAP_MAPPING_FRAGMENT_USSE or #PSP2_GXM_HEAP_MAPPING_USSE.
+ *
+ * @param[in]	heap		The heap.
+ * @param[in]	ptr			A pointer into the heap.
+ * @param[out]	usseOffset	The USSE offset.
+ *
+ * @retval
+ * SCE_OK	The operation was completed successfully.
+ * @retval
+ * SCE_GXM_ERROR_INVALID_VALUE	The heap is not mapped as fragment USSE code.
+ * @retval
+ * SCE_GXM_ERROR_INVALID_POINTER	The pointer is not in the heap.
+ *
+ * @ingroup render
+ */
+static inline SceGxmErrorCode psp2GxmHeapGetFragmentUsseOffset(
+	const Psp2GxmHeap *heap, const void *ptr, uint32_t *usseOffset)
+{
+	const Psp2GxmHeapRegion *region;
+
+	if (!(heap->params.mapping & PSP2_GXM_HEAP_MAPPING_FRAGMENT_USSE))
+		return SCE_GXM_ERROR_INVALID_VALUE;
+
+	region = psp2GxmHeapGetRegion(heap, ptr);
+	if (region == NULL)
+		return SCE_GXM_ERROR_INVALID_POINTER;
+
+	*usseOffset = region->fragmentUsseOffset
+		+ ((const char *)ptr - region->base);
+	return SCE_OK;
+}
+
+/**
+ * Unmaps and frees the memory blocks of a heap that have no allocations left,
+ * except the first one.  It is the responsibility of the caller to ensure
+ * that the GPU no longer uses them.
+ *
+ * @param[in,out]	heap	The heap.
+ *
+ * @return
+ * The number of memory blocks freed.
+ *
+ * @ingroup render
+ */
+static inline uint32_t psp2GxmHeapTrim(Psp2GxmHeap *heap)
+{
+	Psp2GxmHeapRegion *region;
+	Psp2GxmHeapBlock *block;
+	uint32_t fl, sl, i, freed;
+
+	freed = 0;
+	for (i = heap->regionCount; i > 1; i--) {
+		region = heap->regions + i - 1;
+
+		/* An unused memory block is a single free block, the largest
+		   free block of its size class */
+		psp2GxmHeapMapping(region->size, &fl, &sl);
+		for (block = heap->freeLists[fl][sl]; block != NULL;
+			block = block->next)
+			if (block->base == region->base && block->size == region->size)
+				break;
+		if (block == NULL)
+			continue;
+
+		psp2GxmHeapRemoveFree(heap, block);
+		psp2GxmHeapDeleteBlock(heap, block);
+		psp2GxmHeapUnmap(heap, region);
+
+		heap->totalSize -= region->size;
+		heap->regionCount--;
+		*region = heap->regions[heap->regionCount];
+		freed++;
+	}
+
+	return freed;
+}
+
+/**
+ * Unmaps and frees all the memory blocks of a heap.  It is the responsibility
+ * of the caller to ensure that the GPU no longer uses them.
+ *
+ * @param[in,out]	heap	The heap.
+ *
+ * @ingroup render
+ */
+static inline void psp2GxmHeapTerm(Psp2GxmHeap *heap)
+{
+	uint32_t i;
+
+	for (i = 0; i < heap->regionCount; i++)
+		psp2GxmHeapUnmap(heap, heap->regions + i);
+
+	heap->regionCount = 0;
+	heap->totalSize = 0;
+}
+
+/**
+ * Gets the statistics of a heap.  This walks the largest size class, and
+ * should not be called for every allocation.
+ *
+ * @param[in]	heap	The heap.
+ * @param[out]	stats	The statistics.
+ *
+ * @ingroup render
+ */
+static inline void psp2GxmHeapGetStats(const Psp2GxmHeap *heap,
+	Psp2GxmHeapStats *stats)
+{
+	const Psp2GxmHeapBlock *block;
+	uint32_t fl, sl;
+
+	stats->regionCount = heap->regionCount;
+	stats->totalSize = heap->totalSize;
+	stats->usedSize = heap->usedSize;
+	stats->peakUsedSize = heap->peakUsedSize;
+	stats->freeSize = heap->totalSize - heap->usedSize;
+	stats->allocCount = heap->allocCount;
+	stats->freeCount = heap->freeCount;
+
+	stats->largestFreeSize = 0;
+	if (heap->flBitmap != 0) {
+		fl = psp2GxmHeapFls(heap->flBitmap);
+		sl = psp2GxmHeapFls(heap->slBitmap[fl]);
+		for (block = heap->freeLists[fl][sl]; block != NULL;
+			block = block->next)
+			if (stats->largestFreeSize < block->size)
+				stats->largestFreeSize = block->size;
+	}
+
+	stats->fragmentation = stats->freeSize == 0 ? 0 :
+		100 - (uint32_t)((uint64_t)stats->largestFreeSize * 100
+			/ stats->freeSize);
+}
+
+#ifdef	__cplusplus
+}
+#endif	// def __cplusplus
+
+#endif /* _PSP2_GXM_HEAP_H_ */
@@ -0,0 +1,322 @@
+/**
+ * \file patcher.h
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+
+#ifndef _PSP2_GXM_PATCHER_H_
+#define _PSP2_GXM_PATCHER_H_
+
+/**
+ * @file
+ *
+ * Memory callbacks for the shader patcher, and a cache of fragment programs.
+ *
+ * The callbacks allocate buffers and USSE code from heaps of
+ * <c>psp2/gxm/heap.h</c>, which map their memory blocks and report the USSE
+ * offsets of the allocations.  Host memory comes from libc malloc.
+ */
+#include <stdlib.h>
+#include <psp2/gxm/heap.h>
+#include <psp2/gxm/shader_patcher.h>
+
+#ifdef	__cplusplus
+extern "C" {
+#endif	// def __cplusplus
+
+/**
+ * The heaps the shader patcher allocates from, passed to the callbacks as
+ * user data.
+ *
+ * The vertex and fragment USSE heaps may be the same heap mapped with
+ * #PSP2_GXM_HEAP_MAPPING_USSE, so that vertex and fragment code share a
+ * memory budget.
+ *
+ * @ingroup shaderpatcher
+ */
+typedef struct Psp2GxmPatcherMemory {
+	Psp2GxmHeap *buffer;		//!< The heap for buffers, mapped for reading and writing.
+	Psp2GxmHeap *vertexUsse;	//!< The heap for vertex USSE code.
+	Psp2GxmHeap *fragmentUsse;	//!< The heap for fragment USSE code.
+} Psp2GxmPatcherMemory;
+
+static inline void *psp2GxmPatcherHostAlloc(void *userData, uint32_t size)
+{
+	(void)userData;
+	return malloc(size);
+}
+
+static inline void psp2GxmPatcherHostFree(void *userData, void *mem)
+{
+	(void)userData;
+	free(mem);
+}
+
+static inline void *psp2GxmPatcherBufferAlloc(void *userData, uint32_t size)
+{
+	return psp2GxmHeapAlloc(((Psp2GxmPatcherMemory *)userData)->buffer,
+		size, PSP2_GXM_HEAP_GRANULE);
+}
+
+static inline void psp2GxmPatcherBufferFree(void *userData, void *mem)
+{
+	psp2GxmHeapFree(((Psp2GxmPatcherMemory *)userData)->buffer, mem);
+}
+
+static inline void *psp2GxmPatcherVertexUsseAlloc(void *userData,
+	uint32_t size, uint32_t *usseOffset)
+{
+	Psp2GxmHeap *heap;
+	void *mem;
+
+	heap = ((Psp2GxmPatcherMemory *)userData)->vertexUsse;
+	mem = psp2GxmHeapAlloc(heap, size, SCE_GXM_USSE_ALIGNMENT);
+	if (mem != NULL
+		&& psp2GxmHeapGetVertexUsseOffset(heap, mem, usseOffset) < 0) {
+		psp2GxmHeapFree(heap, mem);
+		mem = NULL;
+	}
+
+	return mem;
+}
+
+static inline void psp2GxmPatcherVertexUsseFree(void *userData, void *mem)
+{
+	psp2GxmHeapFree(((Psp2GxmPatcherMemory *)userData)->vertexUsse, mem);
+}
+
+static inline void *psp2GxmPatcherFragmentUsseAlloc(void *userData,
+	uint32_t size, uint32_t *usseOffset)
+{
+	Psp2GxmHeap *heap;
+	void *mem;
+
+	heap = ((Psp2GxmPatcherMemory *)userData)->fragmentUsse;
+	mem = psp2GxmHeapAlloc(heap, size, SCE_GXM_USSE_ALIGNMENT);
+	if (mem != NULL
+		&& psp2GxmHeapGetFragmentUsseOffset(heap, mem, usseOffset) < 0) {
+		psp2GxmHeapFree(heap, mem);
+		mem = NULL;
+	}
+
+	return mem;
+}
+
+static inline void psp2GxmPatcherFragmentUsseFree(void *userData, void *mem)
+{
+	psp2GxmHeapFree(((Psp2GxmPatcherMemory *)userData)->fragmentUsse, mem);
+}
+
+/**
+ * Fills shader patcher parameters with the callbacks of this file.  The
+ * memory structure must persist until the shader patcher is destroyed, and
+ * the user data of the shader patcher must not be changed.
+ *
+ * @param[in]	memory	The heaps to allocate from.
+ * @param[out]	params	The shader patcher parameters to pass to #sceGxmShaderPatcherCreate().
+ *
+ * @ingroup shaderpatcher
+ */
+static inline void psp2GxmPatcherInitParams(Psp2GxmPatcherMemory *memory,
+	SceGxmShaderPatcherParams *params)
+{
+	__builtin_memset(params, 0, sizeof(*params));
+	params->userData = memory;
+	params->hostAllocCallback = psp2GxmPatcherHostAlloc;
+	params->hostFreeCallback = psp2GxmPatcherHostFree;
+	params->bufferAllocCallback = psp2GxmPatcherBufferAlloc;
+	params->bufferFreeCallback = psp2GxmPatcherBufferFree;
+	params->vertexUsseAllocCallback = psp2GxmPatcherVertexUsseAlloc;
+	params->vertexUsseFreeCallback = psp2GxmPatcherVertexUsseFree;
+	params->fragmentUsseAllocCallback = psp2GxmPatcherFragmentUsseAlloc;
+	params->fragmentUsseFreeCallback = psp2GxmPatcherFragmentUsseFree;
+}
+
+/**
+ * The key of a fragment program: the arguments of
+ * #sceGxmShaderPatcherCreateFragmentProgram().
+ *
+ * @ingroup shaderpatcher
+ */
+typedef struct Psp2GxmFragmentProgramKey {
+	SceGxmShaderPatcherId programId;
+	const SceGxmProgram *vertexProgram;
+	uint32_t blend;				//!< The packed #SceGxmBlendInfo.
+	uint32_t mode;				//!< The output format, multisample mode and whether blendInfo is given.
+} Psp2GxmFragmentProgramKey;
+
+/**
+ * An entry of a fragment program cache.
+ *
+ * @ingroup shaderpatcher
+ */
+typedef struct Psp2GxmFragmentProgramCacheEntry {
+	Psp2GxmFragmentProgramKey key;
+	SceGxmFragmentProgram *program;	//!< The program, or <c>NULL</c> if the entry is empty.
+} Psp2GxmFragmentProgramCacheEntry;
+
+/**
+ * A cache of fragment programs, an open addressing hash table.
+ *
+ * @ingroup shaderpatcher
+ */
+typedef struct Psp2GxmFragmentProgramCache {
+	SceGxmShaderPatcher *shaderPatcher;
+	Psp2GxmFragmentProgramCacheEntry *entries;
+	uint32_t mask;
+	uint32_t count;
+	uint32_t hits;				//!< The number of programs found in the cache.
+	uint32_t misses;			//!< The number of programs created.
+} Psp2GxmFragmentProgramCache;
+
+/**
+ * Initializes a fragment program cache.
+ *
+ * @param[out]	cache			The cache.
+ * @param[in]	shaderPatcher	The shader patcher to create the programs with.
+ * @param[in]	entries			The storage for the entries.
+ * @param[in]	capacity		The number of entries, a power of two.  The cache holds up
+ * 							to three quarters of this number of programs.
+ *
+ * @retval
+ * SCE_OK	The operation was completed successfully.
+ * @retval
+ * SCE_GXM_ERROR_INVALID_VALUE The capacity is not a power of two.
+ *
+ * @ingroup shaderpatcher
+ */
+static inline SceGxmErrorCode psp2GxmFragmentProgramCacheInit(
+	Psp2GxmFragmentProgramCache *cache, SceGxmShaderPatcher *shaderPatcher,
+	Psp2GxmFragmentProgramCacheEntry *entries, uint32_t capacity)
+{
+	uint32_t i;
+
+	if (capacity < 4 || (capacity & (capacity - 1)))
+		return SCE_GXM_ERROR_INVALID_VALUE;
+
+	cache->shaderPatcher = shaderPatcher;
+	cache->entries = entries;
+	cache->mask = capacity - 1;
+	cache->count = 0;
+	cache->hits = 0;
+	cache->misses = 0;
+	for (i = 0; i < capacity; i++)
+		entries[i].program = NULL;
+
+	return SCE_OK;
+}
+
+/**
+ * Finds a fragment program in a cache, or creates it with
+ * #sceGxmShaderPatcherCreateFragmentProgram() and adds it.  The cache holds
+ * the reference to the program, which stays valid until
+ * #psp2GxmFragmentProgramCacheClear().
+ *
+ * The parameters are those of #sceGxmShaderPatcherCreateFragmentProgram().
+ *
+ * @retval
+ * SCE_OK	The operation was completed successfully.
+ * @retval
+ * SCE_GXM_ERROR_OUT_OF_HOST_MEMORY The cache is full.
+ * @retval
+ * <0 The error returned by #sceGxmShaderPatcherCreateFragmentProgram().
+ *
+ * @ingroup shaderpatcher
+ */
+static inline SceGxmErrorCode psp2GxmFragmentProgramCacheGet(
+	Psp2GxmFragmentProgramCache *cache, SceGxmShaderPatcherId programId,
+	SceGxmOutputRegisterFormat outputFormat,
+	SceGxmMultisampleMode multisampleMode, const SceGxmBlendInfo *blendInfo,
+	const SceGxmProgram *vertexProgram,
+	SceGxmFragmentProgram **fragmentProgram)
+{
+	Psp2GxmFragmentProgramCacheEntry *entry;
+	Psp2GxmFragmentProgramKey key;
+	uint32_t hash;
+	int ret;
+
+	key.programId = programId;
+	key.vertexProgram = vertexProgram;
+	key.mode = outputFormat | (multisampleMode << 8);
+	key.blend = 0;
+	if (blendInfo != NULL) {
+		key.mode |= 1 << 16;
+		key.blend = blendInfo->colorMask
+			| (blendInfo->colorFunc << 8) | (blendInfo->alphaFunc << 12)
+			| (blendInfo->colorSrc << 16) | (blendInfo->colorDst << 20)
+			| ((uint32_t)blendInfo->alphaSrc << 24)
+			| ((uint32_t)blendInfo->alphaDst << 28);
+	}
+
+	hash = (uintptr_t)programId * 0x9E3779B1U
+		^ (uintptr_t)vertexProgram * 0x85EBCA77U
+		^ key.blend * 0xC2B2AE3DU ^ key.mode * 0x27D4EB2FU;
+	hash ^= hash >> 15;
+
+	for (;; hash++) {
+		entry = cache->entries + (hash & cache->mask);
+		if (entry->program == NULL)
+			break;
+		if (entry->key.programId == key.programId
+			&& entry->key.vertexProgram == key.vertexProgram
+			&& entry->key.blend == key.blend
+			&& entry->key.mode == key.mode) {
+			cache->hits++;
+			*fragmentProgram = entry->program;
+			return SCE_OK;
+		}
+	}
+
+	if (cache->count >= cache->mask - (cache->mask >> 2))
+		return SCE_GXM_ERROR_OUT_OF_HOST_MEMORY;
+
+	ret = sceGxmShaderPatcherCreateFragmentProgram(cache->shaderPatcher,
+		programId, outputFormat, multisampleMode, blendInfo, vertexProgram,
+		&entry->program);
+	if (ret < 0) {
+		entry->program = NULL;
+		return ret;
+	}
+
+	entry->key = key;
+	cache->count++;
+	cache->misses++;
+	*fragmentProgram = entry->program;
+
+	return SCE_OK;
+}
+
+/**
+ * Releases all the programs of a fragment program cache and empties it.  It
+ * is the responsibility of the caller to ensure that the GPU no longer uses
+ * the programs.
+ *
+ * @param[in,out]	cache	The cache.
+ *
+ * @ingroup shaderpatcher
+ */
+static inline void psp2GxmFragmentProgramCacheClear(
+	Psp2GxmFragmentProgramCache *cache)
+{
+	uint32_t i;
+
+	for (i = 0; i <= cache->mask; i++)
+		if (cache->entries[i].program != NULL) {
+			sceGxmShaderPatcherReleaseFragmentProgram(cache->shaderPatcher,
+				cache->entries[i].program);
+			cache->entries[i].program = NULL;
+		}
+
+	cache->count = 0;
+}
+
+#ifdef	__cplusplus
+}
+#endif	// def __cplusplus
+
+#endif /* _PSP2_GXM_PATCHER_H_ */
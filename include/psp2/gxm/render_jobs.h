@@ -0,0 +1,460 @@
+/**
+ * \file render_jobs.h
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+
+#ifndef _PSP2_GXM_RENDER_JOBS_H_
+#define _PSP2_GXM_RENDER_JOBS_H_
+
+/**
+ * @file
+ *
+ * Recording of command lists on worker threads.
+ *
+ * Each worker thread owns a deferred context and a ring allocator of
+ * <c>psp2/gxm/ring.h</c>, from which the buffer callbacks of the deferred
+ * context take their VDM, vertex and fragment memory.  A render job is a
+ * function that records draw calls into a deferred context; the workers
+ * take the jobs of a batch in turn, each into a command list, while the
+ * calling thread executes the command lists on the immediate context in the
+ * order of the jobs as soon as they are recorded.
+ *
+ * @code
+ * 	SceGxmNotification notification;
+ *
+ * 	sceGxmBeginScene(context, ...);
+ * 	psp2GxmRenderJobsExecute(&renderJobs, context, jobs, jobCount);
+ * 	psp2GxmRenderJobsEndScene(&renderJobs, &notification);
+ * 	sceGxmEndScene(context, NULL, &notification);
+ * @endcode
+ *
+ * Region clip and viewport are not set on a deferred context when a command
+ * list begins, so a job should set them, for example with
+ * #sceGxmSetDefaultRegionClipAndViewport().
+ *
+ * The functions of this file must be called from a single thread.
+ */
+#include <psp2/gxm/context.h>
+#include <psp2/gxm/ring.h>
+#include <psp2/kernel/atomic.h>
+#include <psp2/kernel/threadmgr.h>
+
+#ifdef	__cplusplus
+extern "C" {
+#endif	// def __cplusplus
+
+/**
+ * The maximum number of worker threads.
+ *
+ * @ingroup render
+ */
+#define PSP2_GXM_RENDER_JOBS_MAX_WORKERS	4
+
+/**
+ * The default size in bytes of the memory given to a deferred context at a
+ * time.
+ *
+ * @ingroup render
+ */
+#define PSP2_GXM_RENDER_JOBS_DEFAULT_CHUNK_SIZE	(16 * 1024)
+
+/**
+ * A function that records draw calls into a deferred context.  It is called
+ * between #sceGxmBeginCommandList() and #sceGxmEndCommandList().
+ *
+ * @param[in,out]	deferredContext	The deferred context of the worker thread.
+ * @param[in]		arg				The argument of the job.
+ *
+ * @return
+ * SCE_OK, or a negative error code.
+ *
+ * @ingroup render
+ */
+typedef int (*Psp2GxmRenderJobFunc)(SceGxmContext *deferredContext, void *arg);
+
+/**
+ * A render job.
+ *
+ * @ingroup render
+ */
+typedef struct Psp2GxmRenderJob {
+	Psp2GxmRenderJobFunc func;			//!< The function of the job.
+	void *arg;							//!< The argument of the function.
+	SceGxmCommandList commandList;		//!< The command list recorded by the job.
+	int result;							//!< The result of the function.
+	volatile int32_t done;				//!< 1 once the command list is recorded, or the error of the deferred context.
+} Psp2GxmRenderJob;
+
+/**
+ * A worker thread.
+ *
+ * @ingroup render
+ */
+typedef struct Psp2GxmRenderWorker {
+	struct Psp2GxmRenderJobs *renderJobs;
+	SceGxmContext *context;				//!< The deferred context.
+	SceUID thread;
+	SceUID startSema;
+	Psp2GxmRing ring;					//!< The memory of the deferred context.
+	uint32_t reserveFailCount;			//!< The number of buffer callbacks that failed.
+	uint32_t hostMem[SCE_GXM_MINIMUM_CONTEXT_HOST_MEM_SIZE / sizeof(uint32_t)];
+} Psp2GxmRenderWorker;
+
+/**
+ * The parameters of #psp2GxmRenderJobsInit().
+ *
+ * @ingroup render
+ */
+typedef struct Psp2GxmRenderJobsParams {
+	uint32_t workerCount;				//!< The number of worker threads.
+	int priority;						//!< The priority of the worker threads.
+	int stackSize;						//!< The stack size of the worker threads.
+	int cpuAffinityMask[PSP2_GXM_RENDER_JOBS_MAX_WORKERS];	//!< The CPU affinity mask of each worker thread, or 0.
+	void *bufferMem;					//!< GPU memory mapped for reading, shared evenly by the workers.
+	uint32_t bufferMemSize;				//!< The size of the GPU memory in bytes.
+	uint32_t chunkSize;					//!< The memory given to a deferred context at a time, or 0 for the default.
+	volatile uint32_t *notificationAddress;	//!< A 32-bit value of the notification region for the rings of the workers.
+} Psp2GxmRenderJobsParams;
+
+/**
+ * A set of worker threads recording render jobs.
+ *
+ * @ingroup render
+ */
+typedef struct Psp2GxmRenderJobs {
+	Psp2GxmRenderJob *jobs;
+	int32_t jobCount;
+	volatile int32_t nextJob;
+	volatile int32_t quit;
+	SceUID doneSema;					//!< Signalled when a job is done.
+	SceUID idleSema;					//!< Signalled when a worker runs out of jobs.
+	uint32_t chunkSize;
+	uint32_t workerCount;
+	Psp2GxmRenderWorker workers[PSP2_GXM_RENDER_JOBS_MAX_WORKERS];
+} Psp2GxmRenderJobs;
+
+static inline void *psp2GxmRenderJobsBufferCallback(void *userData,
+	uint32_t minSize, uint32_t *size)
+{
+	Psp2GxmRenderWorker *worker;
+	uint32_t chunkSize;
+	void *mem;
+
+	worker = (Psp2GxmRenderWorker *)userData;
+	chunkSize = worker->renderJobs->chunkSize;
+	if (chunkSize < minSize)
+		chunkSize = (minSize + 3) & ~3U;
+
+	mem = psp2GxmRingAlloc(&worker->ring, chunkSize, SCE_GXM_USSE_ALIGNMENT);
+	if (mem == NULL) {
+		worker->reserveFailCount++;
+		chunkSize = 0;
+	}
+
+	*size = chunkSize;
+	return mem;
+}
+
+static inline int psp2GxmRenderJobsThread(SceSize args, void *argp)
+{
+	Psp2GxmRenderWorker *worker;
+	Psp2GxmRenderJobs *renderJobs;
+	Psp2GxmRenderJob *job;
+	int32_t i;
+	int ret;
+
+	(void)args;
+	worker = *(Psp2GxmRenderWorker **)argp;
+	renderJobs = worker->renderJobs;
+
+	for (;;) {
+		sceKernelWaitSema(worker->startSema, 1, NULL);
+		if (psp2AtomicLoad32(&renderJobs->quit))
+			return 0;
+
+		while ((i = psp2AtomicGetAndAdd32(&renderJobs->nextJob, 1))
+			< renderJobs->jobCount) {
+			job = renderJobs->jobs + i;
+
+			ret = sceGxmBeginCommandList(worker->context);
+			if (ret == SCE_OK) {
+				job->result = job->func(worker->context, job->arg);
+				ret = sceGxmEndCommandList(worker->context,
+					&job->commandList);
+			}
+
+			psp2AtomicStore32(&job->done, ret < 0 ? ret : 1);
+			sceKernelSignalSema(renderJobs->doneSema, 1);
+		}
+
+		sceKernelSignalSema(renderJobs->idleSema, 1);
+	}
+}
+
+/**
+ * Terminates render jobs: stops the worker threads, waits until the GPU no
+ * longer uses the memory of the deferred contexts and destroys them.
+ *
+ * @param[in,out]	renderJobs	The render jobs.
+ *
+ * @ingroup render
+ */
+static inline void psp2GxmRenderJobsTerm(Psp2GxmRenderJobs *renderJobs)
+{
+	Psp2GxmRenderWorker *worker;
+	uint32_t i;
+
+	psp2AtomicStore32(&renderJobs->quit, 1);
+
+	for (i = 0; i < PSP2_GXM_RENDER_JOBS_MAX_WORKERS; i++) {
+		worker = renderJobs->workers + i;
+
+		if (worker->thread > 0) {
+			sceKernelSignalSema(worker->startSema, 1);
+			sceKernelWaitThreadEnd(worker->thread, NULL, NULL);
+			sceKernelDeleteThread(worker->thread);
+			worker->thread = 0;
+		}
+
+		if (worker->startSema > 0) {
+			sceKernelDeleteSema(worker->startSema);
+			worker->startSema = 0;
+		}
+
+		if (worker->context != NULL) {
+			psp2GxmRingFinish(&worker->ring);
+			sceGxmDestroyDeferredContext(worker->context);
+			worker->context = NULL;
+		}
+	}
+
+	if (renderJobs->idleSema > 0) {
+		sceKernelDeleteSema(renderJobs->idleSema);
+		renderJobs->idleSema = 0;
+	}
+
+	if (renderJobs->doneSema > 0) {
+		sceKernelDeleteSema(renderJobs->doneSema);
+		renderJobs->doneSema = 0;
+	}
+}
+
+/**
+ * Initializes render jobs: creates the deferred contexts and starts the
+ * worker threads.
+ *
+ * @param[out]	renderJobs	The render jobs.
+ * @param[in]	params		The parameters.  This structure does not need to
+ * 							persist after the call.
+ *
+ * @retval
+ * SCE_OK	The operation was completed successfully.
+ * @retval
+ * SCE_GXM_ERROR_INVALID_VALUE The number of workers or the size of the memory is not valid.
+ * @retval
+ * <0 The error returned by the creation of a deferred context, a thread or a
+ * semaphore.
+ *
+ * @ingroup render
+ */
+static inline int psp2GxmRenderJobsInit(Psp2GxmRenderJobs *renderJobs,
+	const Psp2GxmRenderJobsParams *params)
+{
+	SceGxmDeferredContextParams contextParams;
+	Psp2GxmRenderWorker *worker;
+	uint32_t i, share;
+	int ret;
+
+	__builtin_memset(renderJobs, 0, sizeof(*renderJobs));
+
+	if (params->workerCount == 0
+		|| params->workerCount > PSP2_GXM_RENDER_JOBS_MAX_WORKERS)
+		return SCE_GXM_ERROR_INVALID_VALUE;
+
+	renderJobs->workerCount = params->workerCount;
+	renderJobs->chunkSize = params->chunkSize != 0 ?
+		params->chunkSize : PSP2_GXM_RENDER_JOBS_DEFAULT_CHUNK_SIZE;
+	if (renderJobs->chunkSize < SCE_GXM_MINIMUM_DEFERRED_CONTEXT_BUFFER_SIZE)
+		renderJobs->chunkSize = SCE_GXM_MINIMUM_DEFERRED_CONTEXT_BUFFER_SIZE;
+
+	share = params->bufferMemSize / params->workerCount
+		& ~(SCE_GXM_USSE_ALIGNMENT - 1);
+	if (share < renderJobs->chunkSize)
+		return SCE_GXM_ERROR_INVALID_VALUE;
+
+	ret = sceKernelCreateSema("psp2GxmRenderJobsDone", 0, 0, 0x7FFFFFFF, NULL);
+	if (ret < 0)
+		goto fail;
+	renderJobs->doneSema = ret;
+
+	ret = sceKernelCreateSema("psp2GxmRenderJobsIdle", 0, 0,
+		PSP2_GXM_RENDER_JOBS_MAX_WORKERS, NULL);
+	if (ret < 0)
+		goto fail;
+	renderJobs->idleSema = ret;
+
+	for (i = 0; i < params->workerCount; i++) {
+		worker = renderJobs->workers + i;
+		worker->renderJobs = renderJobs;
+
+		ret = psp2GxmRingInit(&worker->ring,
+			(char *)params->bufferMem + i * share, share,
+			params->notificationAddress);
+		if (ret < 0)
+			goto fail;
+
+		__builtin_memset(&contextParams, 0, sizeof(contextParams));
+		contextParams.hostMem = worker->hostMem;
+		contextParams.hostMemSize = sizeof(worker->hostMem);
+		contextParams.vdmCallback = psp2GxmRenderJobsBufferCallback;
+		contextParams.vertexCallback = psp2GxmRenderJobsBufferCallback;
+		contextParams.fragmentCallback = psp2GxmRenderJobsBufferCallback;
+		contextParams.userData = worker;
+
+		ret = sceGxmCreateDeferredContext(&contextParams, &worker->context);
+		if (ret < 0) {
+			worker->context = NULL;
+			goto fail;
+		}
+
+		ret = sceKernelCreateSema("psp2GxmRenderJobsStart", 0, 0, 1, NULL);
+		if (ret < 0)
+			goto fail;
+		worker->startSema = ret;
+
+		ret = sceKernelCreateThread("psp2GxmRenderJobs",
+			psp2GxmRenderJobsThread, params->priority, params->stackSize,
+			0, params->cpuAffinityMask[i], NULL);
+		if (ret < 0)
+			goto fail;
+		worker->thread = ret;
+
+		ret = sceKernelStartThread(worker->thread, sizeof(worker), &worker);
+		if (ret < 0) {
+			sceKernelDeleteThread(worker->thread);
+			worker->thread = 0;
+			goto fail;
+		}
+	}
+
+	return SCE_OK;
+
+fail:
+	psp2GxmRenderJobsTerm(renderJobs);
+	return ret;
+}
+
+/**
+ * Records render jobs on the worker threads, and executes their command
+ * lists on the immediate context in order.  This function must be called
+ * within a scene, and returns when all the command lists are executed.
+ *
+ * A job whose command list could not be begun or ended is skipped.  The
+ * command list of a job whose function failed is executed: it contains the
+ * draw calls that succeeded.
+ *
+ * @param[in,out]	renderJobs			The render jobs.
+ * @param[in,out]	immediateContext	The immediate context.
+ * @param[in,out]	jobs				The jobs.  They must persist until the
+ * 										GPU has completed the scene.
+ * @param[in]		jobCount			The number of jobs.
+ *
+ * @retval
+ * SCE_OK	The operation was completed successfully.
+ * @retval
+ * <0 The first error of a job, of its command list or of
+ * #sceGxmExecuteCommandList().  The other jobs are still executed.
+ *
+ * @ingroup render
+ */
+static inline int psp2GxmRenderJobsExecute(Psp2GxmRenderJobs *renderJobs,
+	SceGxmContext *immediateContext, Psp2GxmRenderJob *jobs,
+	uint32_t jobCount)
+{
+	uint32_t i, waitCount;
+	int32_t done;
+	int ret, err;
+
+	for (i = 0; i < jobCount; i++) {
+		jobs[i].result = SCE_OK;
+		jobs[i].done = 0;
+	}
+
+	renderJobs->jobs = jobs;
+	renderJobs->jobCount = jobCount;
+	psp2AtomicStore32(&renderJobs->nextJob, 0);
+
+	for (i = 0; i < renderJobs->workerCount; i++)
+		sceKernelSignalSema(renderJobs->workers[i].startSema, 1);
+
+	err = SCE_OK;
+	waitCount = 0;
+	for (i = 0; i < jobCount; i++) {
+		while ((done = psp2AtomicLoad32(&jobs[i].done)) == 0) {
+			sceKernelWaitSema(renderJobs->doneSema, 1, NULL);
+			waitCount++;
+		}
+
+		if (done < 0)
+			ret = done;
+		else {
+			ret = sceGxmExecuteCommandList(immediateContext,
+				&jobs[i].commandList);
+			if (ret == SCE_OK)
+				ret = jobs[i].result;
+		}
+
+		if (ret < 0 && err == SCE_OK)
+			err = ret;
+	}
+
+	// Consume the signals of the jobs that were done before they were
+	// waited for, and wait for the workers to leave the batch.
+	if (waitCount < jobCount)
+		sceKernelWaitSema(renderJobs->doneSema, jobCount - waitCount, NULL);
+	sceKernelWaitSema(renderJobs->idleSema, renderJobs->workerCount, NULL);
+
+	return err;
+}
+
+/**
+ * Ends the current scene of the rings of the workers, and starts the
+ * deferred contexts on new memory for the next scene.
+ *
+ * @param[in,out]	renderJobs		The render jobs.
+ * @param[out]		notification	The notification to pass as the fragment
+ * 								notification to #sceGxmEndScene().
+ *
+ * @ingroup render
+ */
+static inline void psp2GxmRenderJobsEndScene(Psp2GxmRenderJobs *renderJobs,
+	SceGxmNotification *notification)
+{
+	Psp2GxmRenderWorker *worker;
+	uint32_t i;
+
+	for (i = 0; i < renderJobs->workerCount; i++) {
+		worker = renderJobs->workers + i;
+
+		// The rest of the current buffers belongs to the ended scene.
+		sceGxmSetDeferredContextVdmBuffer(worker->context, NULL, 0);
+		sceGxmSetDeferredContextVertexBuffer(worker->context, NULL, 0);
+		sceGxmSetDeferredContextFragmentBuffer(worker->context, NULL, 0);
+
+		// The rings share the notification address and end every scene
+		// together, so they give the same notification.
+		psp2GxmRingEndScene(&worker->ring, notification);
+	}
+}
+
+#ifdef	__cplusplus
+}
+#endif	// def __cplusplus
+
+#endif /* _PSP2_GXM_RENDER_JOBS_H_ */
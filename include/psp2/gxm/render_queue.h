@@ -0,0 +1,429 @@
+/**
+ * \file render_queue.h
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+
+#ifndef _PSP2_GXM_RENDER_QUEUE_H_
+#define _PSP2_GXM_RENDER_QUEUE_H_
+
+/**
+ * @file
+ *
+ * A queue of draw packets, sorted by key before they are submitted.
+ *
+ * Draws are pushed in any order with a 64-bit key built by
+ * #psp2GxmRenderQueueKey() from the render target, program, blend mode,
+ * texture and depth of the draw.  #psp2GxmRenderQueueSort() radix sorts the
+ * keys once per frame, and #psp2GxmRenderQueueSubmit() submits the draws of
+ * a render target in key order through the shadow state of
+ * <c>psp2/gxm/state.h</c>, so that each program and texture is set once per
+ * run of draws that use it.
+ *
+ * Consecutive instanced draws that only differ by their instance stream, and
+ * whose instance data are adjacent in memory, are merged into a single call
+ * to #sceGxmDrawInstanced().
+ *
+ * @code
+ * 	Psp2GxmDrawPacket *packet;
+ *
+ * 	psp2GxmRenderQueueReset(&queue);
+ * 	packet = psp2GxmRenderQueuePush(&queue, psp2GxmRenderQueueKey(0,
+ * 		programId, blendId, textureId, psp2GxmRenderQueueDepth(z)));
+ * 	packet->vertexProgram = ...;
+ * 	psp2GxmRenderQueueSort(&queue);
+ *
+ * 	sceGxmBeginScene(context, ...);
+ * 	psp2GxmStateBeginScene(&state);
+ * 	psp2GxmRenderQueueSubmit(&queue, &state, 0);
+ * 	sceGxmEndScene(context, ...);
+ * @endcode
+ *
+ * A queue is not thread-safe.
+ */
+#include <psp2/gxm/context.h>
+#include <psp2/gxm/state.h>
+#include <psp2/types.h>
+
+#ifdef	__cplusplus
+extern "C" {
+#endif	// def __cplusplus
+
+/**
+ * The maximum number of instances merged into a draw call, the limit of the
+ * streams indexed with #SCE_GXM_INDEX_SOURCE_INSTANCE_16BIT.
+ *
+ * @ingroup render
+ */
+#define PSP2_GXM_RENDER_QUEUE_MAX_INSTANCES		0x10000
+
+/**
+ * A draw packet.
+ *
+ * @ingroup render
+ */
+typedef struct Psp2GxmDrawPacket {
+	const SceGxmVertexProgram *vertexProgram;
+	const SceGxmFragmentProgram *fragmentProgram;
+	const SceGxmTexture *fragmentTexture;		//!< The texture of unit 0, or <c>NULL</c>.
+	const void *vertexDefaultUniformBuffer;		//!< The vertex default uniform buffer, or <c>NULL</c>.
+	const void *fragmentDefaultUniformBuffer;	//!< The fragment default uniform buffer, or <c>NULL</c>.
+	const void *vertexStream;			//!< The vertex stream 0.
+	const void *instanceStream;			//!< The vertex stream 1 indexed by instance, or <c>NULL</c> if the draw is not instanced.
+	uint32_t instanceStride;			//!< The size of the data of an instance in the instance stream.
+	uint32_t instanceCount;				//!< The number of instances, ignored if the draw is not instanced.
+	SceGxmPrimitiveType primType;		//!< The type of primitive.
+	SceGxmIndexFormat indexType;		//!< The type of the indices.
+	const void *indexData;				//!< The indices.
+	uint32_t indexCount;				//!< The number of indices of an instance.
+} Psp2GxmDrawPacket;
+
+/**
+ * A sort item of a render queue.
+ *
+ * @ingroup render
+ */
+typedef struct Psp2GxmRenderQueueItem {
+	uint64_t key;
+	uint32_t packet;					//!< The index of the packet.
+} Psp2GxmRenderQueueItem;
+
+/**
+ * A render queue.
+ *
+ * @ingroup render
+ */
+typedef struct Psp2GxmRenderQueue {
+	Psp2GxmDrawPacket *packets;
+	Psp2GxmRenderQueueItem *items;
+	Psp2GxmRenderQueueItem *scratch;
+	uint32_t capacity;
+	uint32_t count;
+	uint32_t histograms[8][256];		//!< The histograms of the bytes of the keys.
+	uint32_t drawCount;					//!< The number of draw calls submitted.
+	uint32_t mergeCount;				//!< The number of packets merged into the draw call of a previous one.
+} Psp2GxmRenderQueue;
+
+/**
+ * Builds a sort key.  The fields are compared in the order of the parameters;
+ * the value of each is truncated to its number of bits.
+ *
+ * @param[in]	target	The render target, 4 bits, as passed to #psp2GxmRenderQueueSubmit().
+ * @param[in]	program	The programs, 12 bits.
+ * @param[in]	blend	The blend mode, 4 bits.
+ * @param[in]	texture	The texture, 12 bits.
+ * @param[in]	depth	The depth, 32 bits, such as returned by #psp2GxmRenderQueueDepth()
+ * 						for drawing front to back, or its complement for back to front.
+ *
+ * @return
+ * The key.
+ *
+ * @ingroup render
+ */
+static inline uint64_t psp2GxmRenderQueueKey(uint32_t target,
+	uint32_t program, uint32_t blend, uint32_t texture, uint32_t depth)
+{
+	return ((uint64_t)((target & 0xF) << 28 | (program & 0xFFF) << 16
+			| (blend & 0xF) << 12 | (texture & 0xFFF)) << 32)
+		| depth;
+}
+
+/**
+ * Converts a depth to an integer of the same order, for the depth of a sort
+ * key.
+ *
+ * @param[in]	depth	The depth.
+ *
+ * @return
+ * The integer.
+ *
+ * @ingroup render
+ */
+static inline uint32_t psp2GxmRenderQueueDepth(float depth)
+{
+	union {
+		float f;
+		uint32_t u;
+	} value;
+
+	value.f = depth;
+
+	// Flip all the bits of negative values, and the sign of the others.
+	return value.u ^ ((uint32_t)((int32_t)value.u >> 31) | 0x80000000U);
+}
+
+/**
+ * Initializes a render queue.
+ *
+ * @param[out]	queue		The queue.
+ * @param[in]	packets		The storage for the packets.
+ * @param[in]	items		The storage for the sort items.
+ * @param[in]	scratch		The storage for the sort, of the same size as items.
+ * @param[in]	capacity	The number of packets and of items of each array.
+ *
+ * @retval
+ * SCE_OK	The operation was completed successfully.
+ * @retval
+ * SCE_GXM_ERROR_INVALID_POINTER The operation failed because a parameter was unexpectedly <c>NULL</c>.
+ *
+ * @ingroup render
+ */
+static inline SceGxmErrorCode psp2GxmRenderQueueInit(
+	Psp2GxmRenderQueue *queue, Psp2GxmDrawPacket *packets,
+	Psp2GxmRenderQueueItem *items, Psp2GxmRenderQueueItem *scratch,
+	uint32_t capacity)
+{
+	if (queue == NULL || packets == NULL || items == NULL || scratch == NULL)
+		return SCE_GXM_ERROR_INVALID_POINTER;
+
+	queue->packets = packets;
+	queue->items = items;
+	queue->scratch = scratch;
+	queue->capacity = capacity;
+	queue->count = 0;
+	queue->drawCount = 0;
+	queue->mergeCount = 0;
+
+	return SCE_OK;
+}
+
+/**
+ * Removes all the packets of a render queue.
+ *
+ * @param[in,out]	queue	The queue.
+ *
+ * @ingroup render
+ */
+static inline void psp2GxmRenderQueueReset(Psp2GxmRenderQueue *queue)
+{
+	queue->count = 0;
+}
+
+/**
+ * Adds a packet to a render queue.  The packet is cleared, and must be
+ * filled before the queue is submitted.
+ *
+ * @param[in,out]	queue	The queue.
+ * @param[in]		key		The sort key, built with #psp2GxmRenderQueueKey().
+ *
+ * @return
+ * The packet to fill, or <c>NULL</c> if the queue is full.
+ *
+ * @ingroup render
+ */
+static inline Psp2GxmDrawPacket *psp2GxmRenderQueuePush(
+	Psp2GxmRenderQueue *queue, uint64_t key)
+{
+	Psp2GxmDrawPacket *packet;
+
+	if (queue->count >= queue->capacity)
+		return NULL;
+
+	packet = queue->packets + queue->count;
+	__builtin_memset(packet, 0, sizeof(*packet));
+	queue->items[queue->count].key = key;
+	queue->items[queue->count].packet = queue->count;
+	queue->count++;
+
+	return packet;
+}
+
+/**
+ * Sorts the packets of a render queue by key.  The sort is stable, so that
+ * packets of the same key are submitted in the order they were pushed.
+ *
+ * The keys are sorted with a radix sort of one pass per byte.  The passes
+ * of the bytes that are the same in all the keys are skipped.
+ *
+ * @param[in,out]	queue	The queue.
+ *
+ * @ingroup render
+ */
+static inline void psp2GxmRenderQueueSort(Psp2GxmRenderQueue *queue)
+{
+	Psp2GxmRenderQueueItem *src, *dst, *tmp;
+	uint32_t *histogram;
+	uint32_t i, pass, offset, n;
+	uint64_t key;
+
+	if (queue->count < 2)
+		return;
+
+	__builtin_memset(queue->histograms, 0, sizeof(queue->histograms));
+	for (i = 0; i < queue->count; i++) {
+		key = queue->items[i].key;
+		for (pass = 0; pass < 8; pass++)
+			queue->histograms[pass][(key >> (pass * 8)) & 0xFF]++;
+	}
+
+	src = queue->items;
+	dst = queue->scratch;
+	for (pass = 0; pass < 8; pass++) {
+		histogram = queue->histograms[pass];
+		if (histogram[(src[0].key >> (pass * 8)) & 0xFF] == queue->count)
+			continue;
+
+		offset = 0;
+		for (i = 0; i < 256; i++) {
+			n = histogram[i];
+			histogram[i] = offset;
+			offset += n;
+		}
+
+		for (i = 0; i < queue->count; i++)
+			dst[histogram[(src[i].key >> (pass * 8)) & 0xFF]++] = src[i];
+
+		tmp = src;
+		src = dst;
+		dst = tmp;
+	}
+
+	queue->items = src;
+	queue->scratch = dst;
+}
+
+static inline int psp2GxmRenderQueueCanMerge(const Psp2GxmDrawPacket *first,
+	const Psp2GxmDrawPacket *packet, uint32_t instanceCount)
+{
+	return packet->instanceStream != NULL
+		&& packet->instanceStride == first->instanceStride
+		&& (const char *)packet->instanceStream
+			== (const char *)first->instanceStream
+				+ first->instanceStride * instanceCount
+		&& packet->instanceCount <= PSP2_GXM_RENDER_QUEUE_MAX_INSTANCES
+			- instanceCount
+		&& packet->vertexProgram == first->vertexProgram
+		&& packet->fragmentProgram == first->fragmentProgram
+		&& packet->vertexDefaultUniformBuffer
+			== first->vertexDefaultUniformBuffer
+		&& packet->fragmentDefaultUniformBuffer
+			== first->fragmentDefaultUniformBuffer
+		&& packet->vertexStream == first->vertexStream
+		&& packet->primType == first->primType
+		&& packet->indexType == first->indexType
+		&& packet->indexData == first->indexData
+		&& packet->indexCount == first->indexCount
+		&& (packet->fragmentTexture == first->fragmentTexture
+			|| (packet->fragmentTexture != NULL
+				&& first->fragmentTexture != NULL
+				&& __builtin_memcmp(packet->fragmentTexture,
+					first->fragmentTexture, sizeof(SceGxmTexture)) == 0));
+}
+
+/**
+ * Submits the packets of a render target, sorted with
+ * #psp2GxmRenderQueueSort(), to the context of a shadow state.  It must be
+ * called between #sceGxmBeginScene() and #sceGxmEndScene() for the render
+ * target.
+ *
+ * The programs, the texture of unit 0 and the vertex streams 0 and 1 are set
+ * through the shadow state, which drops those that do not change.  The
+ * default uniform buffers are set with #sceGxmSetVertexDefaultUniformBuffer()
+ * and #sceGxmSetFragmentDefaultUniformBuffer() when they differ from the
+ * previous packet.
+ *
+ * @param[in,out]	queue	The queue.
+ * @param[in,out]	state	The shadow state of the context.
+ * @param[in]		target	The render target field of the keys of the packets.
+ *
+ * @retval
+ * SCE_OK	The operation was completed successfully.
+ * @retval
+ * <0 The error returned by a draw call.  The following packets are not
+ * submitted.
+ *
+ * @ingroup render
+ */
+static inline SceGxmErrorCode psp2GxmRenderQueueSubmit(
+	Psp2GxmRenderQueue *queue, Psp2GxmState *state, uint32_t target)
+{
+	const Psp2GxmDrawPacket *packet, *next;
+	const void *vertexDefaultUniformBuffer, *fragmentDefaultUniformBuffer;
+	uint32_t first, last, middle, instanceCount;
+	uint64_t begin;
+	int ret;
+
+	// Find the first packet of the render target.
+	begin = (uint64_t)(target & 0xF) << 60;
+	first = 0;
+	last = queue->count;
+	while (first < last) {
+		middle = first + (last - first) / 2;
+		if (queue->items[middle].key < begin)
+			first = middle + 1;
+		else
+			last = middle;
+	}
+
+	vertexDefaultUniformBuffer = NULL;
+	fragmentDefaultUniformBuffer = NULL;
+
+	while (first < queue->count
+		&& queue->items[first].key >> 60 == (target & 0xF)) {
+		packet = queue->packets + queue->items[first].packet;
+		first++;
+
+		psp2GxmStateSetVertexProgram(state, packet->vertexProgram);
+		psp2GxmStateSetFragmentProgram(state, packet->fragmentProgram);
+		if (packet->fragmentTexture != NULL)
+			psp2GxmStateSetFragmentTexture(state, 0, packet->fragmentTexture);
+		if (packet->vertexStream != NULL)
+			psp2GxmStateSetVertexStream(state, 0, packet->vertexStream);
+
+		if (packet->vertexDefaultUniformBuffer != NULL
+			&& packet->vertexDefaultUniformBuffer
+				!= vertexDefaultUniformBuffer) {
+			vertexDefaultUniformBuffer = packet->vertexDefaultUniformBuffer;
+			sceGxmSetVertexDefaultUniformBuffer(state->context,
+				vertexDefaultUniformBuffer);
+		}
+		if (packet->fragmentDefaultUniformBuffer != NULL
+			&& packet->fragmentDefaultUniformBuffer
+				!= fragmentDefaultUniformBuffer) {
+			fragmentDefaultUniformBuffer = packet->fragmentDefaultUniformBuffer;
+			sceGxmSetFragmentDefaultUniformBuffer(state->context,
+				fragmentDefaultUniformBuffer);
+		}
+
+		if (packet->instanceStream == NULL) {
+			ret = psp2GxmStateDraw(state, packet->primType,
+				packet->indexType, packet->indexData, packet->indexCount);
+		} else {
+			instanceCount = packet->instanceCount;
+			while (first < queue->count
+				&& queue->items[first].key >> 60 == (target & 0xF)) {
+				next = queue->packets + queue->items[first].packet;
+				if (!psp2GxmRenderQueueCanMerge(packet, next, instanceCount))
+					break;
+
+				instanceCount += next->instanceCount;
+				queue->mergeCount++;
+				first++;
+			}
+
+			psp2GxmStateSetVertexStream(state, 1, packet->instanceStream);
+			ret = psp2GxmStateFlush(state);
+			if (ret == SCE_OK)
+				ret = sceGxmDrawInstanced(state->context, packet->primType,
+					packet->indexType, packet->indexData,
+					packet->indexCount * instanceCount, packet->indexCount);
+		}
+
+		if (ret < 0)
+			return ret;
+		queue->drawCount++;
+	}
+
+	return SCE_OK;
+}
+
+#ifdef	__cplusplus
+}
+#endif	// def __cplusplus
+
+#endif /* _PSP2_GXM_RENDER_QUEUE_H_ */
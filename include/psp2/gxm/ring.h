@@ -0,0 +1,352 @@
+/**
+ * \file ring.h
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+
+#ifndef _PSP2_GXM_RING_H_
+#define _PSP2_GXM_RING_H_
+
+/**
+ * @file
+ *
+ * Ring allocator for data the GPU reads once, such as per-draw uniform
+ * buffers and dynamic vertex streams.
+ *
+ * The allocator suballocates a GPU mapped buffer, for example an allocation
+ * of a heap of <c>psp2/gxm/heap.h</c>, from start to end and wraps around.
+ * The allocations made for a scene are released together when the GPU has
+ * completed the scene: #psp2GxmRingEndScene() returns a notification to pass
+ * as the fragment notification to #sceGxmEndScene(), and the allocator only
+ * reuses the memory of a scene once the GPU has written its value. It waits
+ * for the GPU only when the ring is full, so that it is not necessary to call
+ * #sceGxmFinish() every frame.
+ *
+ * @code
+ * 	void *uniforms;
+ * 	SceGxmNotification notification;
+ *
+ * 	sceGxmBeginScene(context, ...);
+ * 	uniforms = psp2GxmRingSetVertexUniformBuffer(&ring, context, 0, size);
+ * 	memcpy(uniforms, ..., size);
+ * 	sceGxmDraw(context, ...);
+ * 	psp2GxmRingEndScene(&ring, &notification);
+ * 	sceGxmEndScene(context, NULL, &notification);
+ * @endcode
+ *
+ * A ring is not thread-safe.
+ */
+#include <psp2/gxm/context.h>
+#include <psp2/gxm/init.h>
+
+#ifdef	__cplusplus
+extern "C" {
+#endif	// def __cplusplus
+
+/**
+ * The maximum number of scenes whose allocations are in use by the GPU.
+ *
+ * @ingroup render
+ */
+#define PSP2_GXM_RING_MAX_SCENES			8
+
+/**
+ * The allocations of a scene submitted to the GPU.
+ *
+ * @ingroup render
+ */
+typedef struct Psp2GxmRingScene {
+	uint32_t size;					//!< The bytes used by the scene, including padding.
+	uint32_t value;					//!< The notification value written when the scene completes.
+} Psp2GxmRingScene;
+
+/**
+ * A ring allocator.
+ *
+ * @ingroup render
+ */
+typedef struct Psp2GxmRing {
+	char *base;						//!< The GPU mapped buffer.
+	uint32_t size;					//!< The size of the buffer in bytes.
+	uint32_t head;					//!< The offset of the next allocation.
+	uint32_t used;					//!< The bytes in use, including padding.
+	uint32_t pending;				//!< The bytes used by the current scene.
+	volatile uint32_t *address;		//!< The notification value of the ring.
+	uint32_t value;					//!< The last value given to a notification.
+	uint32_t first;					//!< The index of the oldest scene in use.
+	uint32_t count;					//!< The number of scenes in use.
+	Psp2GxmRingScene scenes[PSP2_GXM_RING_MAX_SCENES];
+	uint32_t peakUsed;				//!< The highest number of bytes in use.
+	uint32_t waitCount;				//!< The number of times the ring waited for the GPU.
+} Psp2GxmRing;
+
+/**
+ * Initializes a ring allocator.
+ *
+ * @param[out]	ring		The ring.
+ * @param[in]	base		The buffer, mapped with #sceGxmMapMemory() for reading.
+ * 							It must stay mapped until the GPU no longer uses the ring.
+ * @param[in]	size		The size of the buffer in bytes.
+ * @param[in]	address		A 32-bit value of the notification region returned by
+ * 							#sceGxmGetNotificationRegion().  Rings that end every scene
+ * 							together may share it, and give the same notifications.
+ *
+ * @retval
+ * SCE_OK	The operation was completed successfully.
+ * @retval
+ * SCE_GXM_ERROR_INVALID_POINTER The operation failed because a parameter was unexpectedly <c>NULL</c>.
+ *
+ * @ingroup render
+ */
+static inline SceGxmErrorCode psp2GxmRingInit(Psp2GxmRing *ring,
+	void *base, uint32_t size, volatile uint32_t *address)
+{
+	if (ring == NULL || base == NULL || address == NULL)
+		return SCE_GXM_ERROR_INVALID_POINTER;
+
+	ring->base = (char *)base;
+	ring->size = size;
+	ring->head = 0;
+	ring->used = 0;
+	ring->pending = 0;
+	ring->address = address;
+	ring->value = 0;
+	ring->first = 0;
+	ring->count = 0;
+	ring->peakUsed = 0;
+	ring->waitCount = 0;
+	*address = 0;
+
+	return SCE_OK;
+}
+
+static inline int psp2GxmRingSceneIsDone(const Psp2GxmRing *ring,
+	const Psp2GxmRingScene *scene)
+{
+	// The GPU writes the values in order, so a later value also completes
+	// the scene.
+	return (int32_t)(*ring->address - scene->value) >= 0;
+}
+
+static inline void psp2GxmRingRetire(Psp2GxmRing *ring)
+{
+	ring->used -= ring->scenes[ring->first].size;
+	ring->first = (ring->first + 1) % PSP2_GXM_RING_MAX_SCENES;
+	ring->count--;
+}
+
+/**
+ * Waits until the GPU has completed the oldest scene in use, and releases
+ * its allocations.
+ *
+ * The notification is polled with #sceGxmWaitEvent() between attempts
+ * instead of waited for with #sceGxmNotificationWait(), which compares the
+ * value for equality and never returns if the GPU has already written the
+ * value of a later scene.
+ */
+static inline void psp2GxmRingWaitOldest(Psp2GxmRing *ring)
+{
+	const Psp2GxmRingScene *scene;
+
+	scene = ring->scenes + ring->first;
+	if (!psp2GxmRingSceneIsDone(ring, scene)) {
+		ring->waitCount++;
+		do
+			sceGxmWaitEvent();
+		while (!psp2GxmRingSceneIsDone(ring, scene));
+	}
+
+	psp2GxmRingRetire(ring);
+}
+
+/**
+ * Releases the allocations of the scenes that the GPU has completed,
+ * without waiting.
+ *
+ * @param[in,out]	ring	The ring.
+ *
+ * @ingroup render
+ */
+static inline void psp2GxmRingPoll(Psp2GxmRing *ring)
+{
+	while (ring->count > 0
+		&& psp2GxmRingSceneIsDone(ring, ring->scenes + ring->first))
+		psp2GxmRingRetire(ring);
+}
+
+/**
+ * Allocates memory for the current scene.  The memory may be written until
+ * the scene is ended with #sceGxmEndScene(), and is released when the GPU
+ * has completed the scene.
+ *
+ * If the ring is full, this function waits for the GPU to complete the
+ * oldest scenes.
+ *
+ * @param[in,out]	ring		The ring.
+ * @param[in]		size		The size of the allocation in bytes.
+ * @param[in]		alignment	The alignment of the allocation, a power of two.
+ *
+ * @return
+ * The allocation, or <c>NULL</c> if it does not fit in the ring with the other
+ * allocations of the current scene.
+ *
+ * @ingroup render
+ */
+static inline void *psp2GxmRingAlloc(Psp2GxmRing *ring,
+	uint32_t size, uint32_t alignment)
+{
+	uint32_t offset, total;
+
+	psp2GxmRingPoll(ring);
+	for (;;) {
+		if (ring->used == 0)
+			ring->head = 0;
+
+		offset = ring->head
+			+ (-(uintptr_t)(ring->base + ring->head) & (alignment - 1));
+		if (offset > ring->size || size > ring->size - offset) {
+			// Skip the end of the buffer and start again at its beginning.
+			offset = -(uintptr_t)ring->base & (alignment - 1);
+			if (offset > ring->size || size > ring->size - offset)
+				return NULL;
+			total = ring->size - ring->head + offset + size;
+		} else
+			total = offset - ring->head + size;
+
+		if (total <= ring->size - ring->used)
+			break;
+		if (ring->count == 0)
+			return NULL;
+		psp2GxmRingWaitOldest(ring);
+	}
+
+	ring->head = offset + size;
+	ring->used += total;
+	ring->pending += total;
+	if (ring->used > ring->peakUsed)
+		ring->peakUsed = ring->used;
+
+	return ring->base + offset;
+}
+
+/**
+ * Ends the current scene of a ring.  The allocations made since the previous
+ * call belong to the scene, and are released when the GPU writes the
+ * notification.
+ *
+ * If #PSP2_GXM_RING_MAX_SCENES scenes are already in use, this function waits
+ * for the GPU to complete the oldest one.
+ *
+ * @param[in,out]	ring			The ring.
+ * @param[out]		notification	The notification to pass as the fragment
+ * 								notification to #sceGxmEndScene().
+ *
+ * @ingroup render
+ */
+static inline void psp2GxmRingEndScene(Psp2GxmRing *ring,
+	SceGxmNotification *notification)
+{
+	Psp2GxmRingScene *scene;
+
+	psp2GxmRingPoll(ring);
+	if (ring->count >= PSP2_GXM_RING_MAX_SCENES)
+		psp2GxmRingWaitOldest(ring);
+
+	scene = ring->scenes
+		+ (ring->first + ring->count) % PSP2_GXM_RING_MAX_SCENES;
+	scene->size = ring->pending;
+	scene->value = ++ring->value;
+	ring->count++;
+	ring->pending = 0;
+
+	notification->address = ring->address;
+	notification->value = ring->value;
+}
+
+/**
+ * Waits until the GPU has completed all the scenes of a ring, and releases
+ * their allocations.  The ring may then be terminated.
+ *
+ * @param[in,out]	ring	The ring.
+ *
+ * @ingroup render
+ */
+static inline void psp2GxmRingFinish(Psp2GxmRing *ring)
+{
+	while (ring->count > 0)
+		psp2GxmRingWaitOldest(ring);
+}
+
+/**
+ * Allocates a vertex stream for the current scene and sets it with
+ * #sceGxmSetVertexStream().
+ *
+ * @return
+ * The vertex stream to fill, or <c>NULL</c> if the allocation failed.
+ *
+ * @ingroup render
+ */
+static inline void *psp2GxmRingSetVertexStream(Psp2GxmRing *ring,
+	SceGxmContext *context, uint32_t streamIndex, uint32_t size)
+{
+	void *data;
+
+	data = psp2GxmRingAlloc(ring, size, sizeof(uint32_t));
+	if (data != NULL)
+		sceGxmSetVertexStream(context, streamIndex, data);
+
+	return data;
+}
+
+/**
+ * Allocates a vertex uniform buffer for the current scene and sets it with
+ * #sceGxmSetVertexUniformBuffer().
+ *
+ * @return
+ * The uniform buffer to fill, or <c>NULL</c> if the allocation failed.
+ *
+ * @ingroup render
+ */
+static inline void *psp2GxmRingSetVertexUniformBuffer(Psp2GxmRing *ring,
+	SceGxmContext *context, uint32_t bufferIndex, uint32_t size)
+{
+	void *data;
+
+	data = psp2GxmRingAlloc(ring, size, sizeof(uint32_t));
+	if (data != NULL)
+		sceGxmSetVertexUniformBuffer(context, bufferIndex, data);
+
+	return data;
+}
+
+/**
+ * Allocates a fragment uniform buffer for the current scene and sets it with
+ * #sceGxmSetFragmentUniformBuffer().
+ *
+ * @return
+ * The uniform buffer to fill, or <c>NULL</c> if the allocation failed.
+ *
+ * @ingroup render
+ */
+static inline void *psp2GxmRingSetFragmentUniformBuffer(Psp2GxmRing *ring,
+	SceGxmContext *context, uint32_t bufferIndex, uint32_t size)
+{
+	void *data;
+
+	data = psp2GxmRingAlloc(ring, size, sizeof(uint32_t));
+	if (data != NULL)
+		sceGxmSetFragmentUniformBuffer(context, bufferIndex, data);
+
+	return data;
+}
+
+#ifdef	__cplusplus
+}
+#endif	// def __cplusplus
+
+#endif /* _PSP2_GXM_RING_H_ */
@@ -0,0 +1,573 @@
+/**
+ * \file state.h
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+
+#ifndef _PSP2_GXM_STATE_H_
+#define _PSP2_GXM_STATE_H_
+
+/**
+ * @file
+ *
+ * Shadow state of a context, which drops state changes that do not change
+ * anything.
+ *
+ * The psp2GxmStateSet functions take the arguments of the sceGxmSet
+ * functions of the same names, and call them only when the value differs
+ * from the one last set.  The front and back state of two-sided rendering are
+ * tracked separately.
+ *
+ * Textures, uniform buffers and vertex streams are bound in batches: their
+ * functions only record the binding, and #psp2GxmStateFlush() or
+ * #psp2GxmStateDraw() issue the bindings that changed since the previous
+ * draw call, once per slot.
+ *
+ * The shadow state must be invalidated with #psp2GxmStateInvalidate() when
+ * the state of the context is changed without it, and
+ * #psp2GxmStateBeginScene() must be called after #sceGxmBeginScene(), which
+ * resets the region clip and the viewport.
+ */
+#include <psp2/gxm/context.h>
+
+#ifdef	__cplusplus
+extern "C" {
+#endif	// def __cplusplus
+
+/**
+ * The words of the shadow state of the render states.
+ *
+ * @ingroup render
+ */
+typedef enum Psp2GxmStateWord {
+	PSP2_GXM_STATE_FRONT_DEPTH_FUNC,
+	PSP2_GXM_STATE_BACK_DEPTH_FUNC,
+	PSP2_GXM_STATE_FRONT_FRAGMENT_PROGRAM_ENABLE,
+	PSP2_GXM_STATE_BACK_FRAGMENT_PROGRAM_ENABLE,
+	PSP2_GXM_STATE_FRONT_DEPTH_WRITE_ENABLE,
+	PSP2_GXM_STATE_BACK_DEPTH_WRITE_ENABLE,
+	PSP2_GXM_STATE_FRONT_LINE_FILL_LAST_PIXEL_ENABLE,
+	PSP2_GXM_STATE_BACK_LINE_FILL_LAST_PIXEL_ENABLE,
+	PSP2_GXM_STATE_FRONT_STENCIL_REF,
+	PSP2_GXM_STATE_BACK_STENCIL_REF,
+	PSP2_GXM_STATE_FRONT_POINT_LINE_WIDTH,
+	PSP2_GXM_STATE_BACK_POINT_LINE_WIDTH,
+	PSP2_GXM_STATE_FRONT_POLYGON_MODE,
+	PSP2_GXM_STATE_BACK_POLYGON_MODE,
+	PSP2_GXM_STATE_FRONT_STENCIL_FUNC,
+	PSP2_GXM_STATE_BACK_STENCIL_FUNC,
+	PSP2_GXM_STATE_FRONT_DEPTH_BIAS,				//!< Two words.
+	PSP2_GXM_STATE_BACK_DEPTH_BIAS			= PSP2_GXM_STATE_FRONT_DEPTH_BIAS + 2,	//!< Two words.
+	PSP2_GXM_STATE_FRONT_VISIBILITY_TEST_INDEX	= PSP2_GXM_STATE_BACK_DEPTH_BIAS + 2,
+	PSP2_GXM_STATE_BACK_VISIBILITY_TEST_INDEX,
+	PSP2_GXM_STATE_FRONT_VISIBILITY_TEST_OP,
+	PSP2_GXM_STATE_BACK_VISIBILITY_TEST_OP,
+	PSP2_GXM_STATE_FRONT_VISIBILITY_TEST_ENABLE,
+	PSP2_GXM_STATE_BACK_VISIBILITY_TEST_ENABLE,
+	PSP2_GXM_STATE_TWO_SIDED_ENABLE,
+	PSP2_GXM_STATE_CULL_MODE,
+	PSP2_GXM_STATE_VIEWPORT_ENABLE,
+	PSP2_GXM_STATE_W_BUFFER_ENABLE,
+	PSP2_GXM_STATE_W_CLAMP_ENABLE,
+	PSP2_GXM_STATE_W_CLAMP_VALUE,
+	PSP2_GXM_STATE_VIEWPORT,						//!< Six words.
+	PSP2_GXM_STATE_REGION_CLIP				= PSP2_GXM_STATE_VIEWPORT + 6,	//!< Five words.
+	PSP2_GXM_STATE_WORD_COUNT				= PSP2_GXM_STATE_REGION_CLIP + 5
+} Psp2GxmStateWord;
+
+/**
+ * The shadow state of a context.
+ *
+ * @ingroup render
+ */
+typedef struct Psp2GxmState {
+	SceGxmContext *context;
+
+	uint32_t words[PSP2_GXM_STATE_WORD_COUNT];
+	uint64_t wordsValid;				//!< The words whose value is known.
+	const SceGxmVertexProgram *vertexProgram;
+	const SceGxmFragmentProgram *fragmentProgram;
+	uint32_t programsValid;
+
+	SceGxmTexture vertexTextures[SCE_GXM_MAX_TEXTURE_UNITS];
+	SceGxmTexture fragmentTextures[SCE_GXM_MAX_TEXTURE_UNITS];
+	SceGxmTexture pendingVertexTextures[SCE_GXM_MAX_TEXTURE_UNITS];
+	SceGxmTexture pendingFragmentTextures[SCE_GXM_MAX_TEXTURE_UNITS];
+	const void *vertexUniformBuffers[SCE_GXM_MAX_UNIFORM_BUFFERS];
+	const void *fragmentUniformBuffers[SCE_GXM_MAX_UNIFORM_BUFFERS];
+	const void *pendingVertexUniformBuffers[SCE_GXM_MAX_UNIFORM_BUFFERS];
+	const void *pendingFragmentUniformBuffers[SCE_GXM_MAX_UNIFORM_BUFFERS];
+	const void *vertexStreams[SCE_GXM_MAX_VERTEX_STREAMS];
+	const void *pendingVertexStreams[SCE_GXM_MAX_VERTEX_STREAMS];
+
+	uint32_t vertexTexturesValid;		//!< The texture slots whose binding is known.
+	uint32_t fragmentTexturesValid;
+	uint32_t vertexUniformBuffersValid;
+	uint32_t fragmentUniformBuffersValid;
+	uint32_t vertexStreamsValid;
+	uint32_t vertexTexturesDirty;		//!< The texture slots with a pending binding.
+	uint32_t fragmentTexturesDirty;
+	uint32_t vertexUniformBuffersDirty;
+	uint32_t fragmentUniformBuffersDirty;
+	uint32_t vertexStreamsDirty;
+
+	uint32_t issuedCount;				//!< The number of state changes issued to the context.
+	uint32_t elidedCount;				//!< The number of state changes dropped.
+} Psp2GxmState;
+
+/**
+ * Forgets the state of the context, so that every state is issued again when
+ * it is next set.  Pending bindings are kept.
+ *
+ * @param[in,out]	state	The shadow state.
+ *
+ * @ingroup render
+ */
+static inline void psp2GxmStateInvalidate(Psp2GxmState *state)
+{
+	state->wordsValid = 0;
+	state->programsValid = 0;
+	state->vertexTexturesValid = 0;
+	state->fragmentTexturesValid = 0;
+	state->vertexUniformBuffersValid = 0;
+	state->fragmentUniformBuffersValid = 0;
+	state->vertexStreamsValid = 0;
+}
+
+/**
+ * Initializes the shadow state of a context.  The state of the context is
+ * unknown until it is set.
+ *
+ * @param[out]	state	The shadow state.
+ * @param[in]	context	The context.
+ *
+ * @ingroup render
+ */
+static inline void psp2GxmStateInit(Psp2GxmState *state, SceGxmContext *context)
+{
+	__builtin_memset(state, 0, sizeof(*state));
+	state->context = context;
+	psp2GxmStateInvalidate(state);
+}
+
+/**
+ * Forgets the region clip and the viewport, which #sceGxmBeginScene() sets.
+ *
+ * @param[in,out]	state	The shadow state.
+ *
+ * @ingroup render
+ */
+static inline void psp2GxmStateBeginScene(Psp2GxmState *state)
+{
+	state->wordsValid &= (1ULL << PSP2_GXM_STATE_VIEWPORT) - 1;
+}
+
+static inline int psp2GxmStateChangeWords(Psp2GxmState *state,
+	uint32_t word, const uint32_t *values, uint32_t count)
+{
+	const uint64_t mask = ((1ULL << count) - 1) << word;
+
+	if ((state->wordsValid & mask) == mask
+		&& __builtin_memcmp(state->words + word, values,
+			count * sizeof(uint32_t)) == 0) {
+		state->elidedCount++;
+		return 0;
+	}
+
+	__builtin_memcpy(state->words + word, values, count * sizeof(uint32_t));
+	state->wordsValid |= mask;
+	state->issuedCount++;
+	return 1;
+}
+
+static inline int psp2GxmStateChange(Psp2GxmState *state,
+	uint32_t word, uint32_t value)
+{
+	return psp2GxmStateChangeWords(state, word, &value, 1);
+}
+
+#define PSP2_GXM_STATE_SETTER(name, word, type)							\
+static inline void psp2GxmStateSet##name(Psp2GxmState *state, type value)	\
+{																		\
+	if (psp2GxmStateChange(state, word, (uint32_t)value))				\
+		sceGxmSet##name(state->context, value);							\
+}
+
+PSP2_GXM_STATE_SETTER(FrontDepthFunc,
+	PSP2_GXM_STATE_FRONT_DEPTH_FUNC, SceGxmDepthFunc)
+PSP2_GXM_STATE_SETTER(BackDepthFunc,
+	PSP2_GXM_STATE_BACK_DEPTH_FUNC, SceGxmDepthFunc)
+PSP2_GXM_STATE_SETTER(FrontFragmentProgramEnable,
+	PSP2_GXM_STATE_FRONT_FRAGMENT_PROGRAM_ENABLE, SceGxmFragmentProgramMode)
+PSP2_GXM_STATE_SETTER(BackFragmentProgramEnable,
+	PSP2_GXM_STATE_BACK_FRAGMENT_PROGRAM_ENABLE, SceGxmFragmentProgramMode)
+PSP2_GXM_STATE_SETTER(FrontDepthWriteEnable,
+	PSP2_GXM_STATE_FRONT_DEPTH_WRITE_ENABLE, SceGxmDepthWriteMode)
+PSP2_GXM_STATE_SETTER(BackDepthWriteEnable,
+	PSP2_GXM_STATE_BACK_DEPTH_WRITE_ENABLE, SceGxmDepthWriteMode)
+PSP2_GXM_STATE_SETTER(FrontLineFillLastPixelEnable,
+	PSP2_GXM_STATE_FRONT_LINE_FILL_LAST_PIXEL_ENABLE, SceGxmLineFillLastPixelMode)
+PSP2_GXM_STATE_SETTER(BackLineFillLastPixelEnable,
+	PSP2_GXM_STATE_BACK_LINE_FILL_LAST_PIXEL_ENABLE, SceGxmLineFillLastPixelMode)
+PSP2_GXM_STATE_SETTER(FrontStencilRef,
+	PSP2_GXM_STATE_FRONT_STENCIL_REF, uint8_t)
+PSP2_GXM_STATE_SETTER(BackStencilRef,
+	PSP2_GXM_STATE_BACK_STENCIL_REF, uint8_t)
+PSP2_GXM_STATE_SETTER(FrontPointLineWidth,
+	PSP2_GXM_STATE_FRONT_POINT_LINE_WIDTH, uint32_t)
+PSP2_GXM_STATE_SETTER(BackPointLineWidth,
+	PSP2_GXM_STATE_BACK_POINT_LINE_WIDTH, uint32_t)
+PSP2_GXM_STATE_SETTER(FrontPolygonMode,
+	PSP2_GXM_STATE_FRONT_POLYGON_MODE, SceGxmPolygonMode)
+PSP2_GXM_STATE_SETTER(BackPolygonMode,
+	PSP2_GXM_STATE_BACK_POLYGON_MODE, SceGxmPolygonMode)
+PSP2_GXM_STATE_SETTER(FrontVisibilityTestIndex,
+	PSP2_GXM_STATE_FRONT_VISIBILITY_TEST_INDEX, uint32_t)
+PSP2_GXM_STATE_SETTER(BackVisibilityTestIndex,
+	PSP2_GXM_STATE_BACK_VISIBILITY_TEST_INDEX, uint32_t)
+PSP2_GXM_STATE_SETTER(FrontVisibilityTestOp,
+	PSP2_GXM_STATE_FRONT_VISIBILITY_TEST_OP, SceGxmVisibilityTestOp)
+PSP2_GXM_STATE_SETTER(BackVisibilityTestOp,
+	PSP2_GXM_STATE_BACK_VISIBILITY_TEST_OP, SceGxmVisibilityTestOp)
+PSP2_GXM_STATE_SETTER(FrontVisibilityTestEnable,
+	PSP2_GXM_STATE_FRONT_VISIBILITY_TEST_ENABLE, SceGxmVisibilityTestMode)
+PSP2_GXM_STATE_SETTER(BackVisibilityTestEnable,
+	PSP2_GXM_STATE_BACK_VISIBILITY_TEST_ENABLE, SceGxmVisibilityTestMode)
+PSP2_GXM_STATE_SETTER(TwoSidedEnable,
+	PSP2_GXM_STATE_TWO_SIDED_ENABLE, SceGxmTwoSidedMode)
+PSP2_GXM_STATE_SETTER(CullMode,
+	PSP2_GXM_STATE_CULL_MODE, SceGxmCullMode)
+PSP2_GXM_STATE_SETTER(ViewportEnable,
+	PSP2_GXM_STATE_VIEWPORT_ENABLE, SceGxmViewportMode)
+PSP2_GXM_STATE_SETTER(WBufferEnable,
+	PSP2_GXM_STATE_W_BUFFER_ENABLE, SceGxmWBufferMode)
+PSP2_GXM_STATE_SETTER(WClampEnable,
+	PSP2_GXM_STATE_W_CLAMP_ENABLE, SceGxmWClampMode)
+
+#undef PSP2_GXM_STATE_SETTER
+
+static inline void psp2GxmStateSetWClampValue(Psp2GxmState *state,
+	float clampValue)
+{
+	uint32_t value;
+
+	__builtin_memcpy(&value, &clampValue, sizeof(value));
+	if (psp2GxmStateChange(state, PSP2_GXM_STATE_W_CLAMP_VALUE, value))
+		sceGxmSetWClampValue(state->context, clampValue);
+}
+
+static inline void psp2GxmStateSetFrontStencilFunc(Psp2GxmState *state,
+	SceGxmStencilFunc func, SceGxmStencilOp stencilFail,
+	SceGxmStencilOp depthFail, SceGxmStencilOp depthPass,
+	uint8_t compareMask, uint8_t writeMask)
+{
+	if (psp2GxmStateChange(state, PSP2_GXM_STATE_FRONT_STENCIL_FUNC,
+		func | stencilFail | (depthFail << 3) | (depthPass << 6)
+			| (compareMask << 9) | (writeMask << 17)))
+		sceGxmSetFrontStencilFunc(state->context, func, stencilFail,
+			depthFail, depthPass, compareMask, writeMask);
+}
+
+static inline void psp2GxmStateSetBackStencilFunc(Psp2GxmState *state,
+	SceGxmStencilFunc func, SceGxmStencilOp stencilFail,
+	SceGxmStencilOp depthFail, SceGxmStencilOp depthPass,
+	uint8_t compareMask, uint8_t writeMask)
+{
+	if (psp2GxmStateChange(state, PSP2_GXM_STATE_BACK_STENCIL_FUNC,
+		func | stencilFail | (depthFail << 3) | (depthPass << 6)
+			| (compareMask << 9) | (writeMask << 17)))
+		sceGxmSetBackStencilFunc(state->context, func, stencilFail,
+			depthFail, depthPass, compareMask, writeMask);
+}
+
+static inline void psp2GxmStateSetFrontDepthBias(Psp2GxmState *state,
+	int32_t factor, int32_t units)
+{
+	const uint32_t values[2] = { (uint32_t)factor, (uint32_t)units };
+
+	if (psp2GxmStateChangeWords(state, PSP2_GXM_STATE_FRONT_DEPTH_BIAS,
+		values, 2))
+		sceGxmSetFrontDepthBias(state->context, factor, units);
+}
+
+static inline void psp2GxmStateSetBackDepthBias(Psp2GxmState *state,
+	int32_t factor, int32_t units)
+{
+	const uint32_t values[2] = { (uint32_t)factor, (uint32_t)units };
+
+	if (psp2GxmStateChangeWords(state, PSP2_GXM_STATE_BACK_DEPTH_BIAS,
+		values, 2))
+		sceGxmSetBackDepthBias(state->context, factor, units);
+}
+
+static inline void psp2GxmStateSetViewport(Psp2GxmState *state,
+	float xOffset, float xScale, float yOffset, float yScale,
+	float zOffset, float zScale)
+{
+	const float viewport[6] = {
+		xOffset, xScale, yOffset, yScale, zOffset, zScale
+	};
+	uint32_t values[6];
+
+	__builtin_memcpy(values, viewport, sizeof(values));
+	if (psp2GxmStateChangeWords(state, PSP2_GXM_STATE_VIEWPORT, values, 6))
+		sceGxmSetViewport(state->context,
+			xOffset, xScale, yOffset, yScale, zOffset, zScale);
+}
+
+static inline void psp2GxmStateSetRegionClip(Psp2GxmState *state,
+	SceGxmRegionClipMode mode,
+	uint32_t xMin, uint32_t yMin, uint32_t xMax, uint32_t yMax)
+{
+	const uint32_t values[5] = { mode, xMin, yMin, xMax, yMax };
+
+	if (psp2GxmStateChangeWords(state, PSP2_GXM_STATE_REGION_CLIP, values, 5))
+		sceGxmSetRegionClip(state->context, mode, xMin, yMin, xMax, yMax);
+}
+
+static inline void psp2GxmStateSetVertexProgram(Psp2GxmState *state,
+	const SceGxmVertexProgram *vertexProgram)
+{
+	if ((state->programsValid & 1) && state->vertexProgram == vertexProgram) {
+		state->elidedCount++;
+		return;
+	}
+
+	state->vertexProgram = vertexProgram;
+	state->programsValid |= 1;
+	state->issuedCount++;
+	sceGxmSetVertexProgram(state->context, vertexProgram);
+}
+
+static inline void psp2GxmStateSetFragmentProgram(Psp2GxmState *state,
+	const SceGxmFragmentProgram *fragmentProgram)
+{
+	if ((state->programsValid & 2)
+		&& state->fragmentProgram == fragmentProgram) {
+		state->elidedCount++;
+		return;
+	}
+
+	state->fragmentProgram = fragmentProgram;
+	state->programsValid |= 2;
+	state->issuedCount++;
+	sceGxmSetFragmentProgram(state->context, fragmentProgram);
+}
+
+static inline void psp2GxmStateSetVertexTexture(Psp2GxmState *state,
+	uint32_t textureIndex, const SceGxmTexture *texture)
+{
+	if (state->vertexTexturesDirty & (1U << textureIndex))
+		state->elidedCount++;
+
+	state->pendingVertexTextures[textureIndex] = *texture;
+	state->vertexTexturesDirty |= 1U << textureIndex;
+}
+
+static inline void psp2GxmStateSetFragmentTexture(Psp2GxmState *state,
+	uint32_t textureIndex, const SceGxmTexture *texture)
+{
+	if (state->fragmentTexturesDirty & (1U << textureIndex))
+		state->elidedCount++;
+
+	state->pendingFragmentTextures[textureIndex] = *texture;
+	state->fragmentTexturesDirty |= 1U << textureIndex;
+}
+
+static inline void psp2GxmStateSetVertexUniformBuffer(Psp2GxmState *state,
+	uint32_t bufferIndex, const void *bufferData)
+{
+	if (state->vertexUniformBuffersDirty & (1U << bufferIndex))
+		state->elidedCount++;
+
+	state->pendingVertexUniformBuffers[bufferIndex] = bufferData;
+	state->vertexUniformBuffersDirty |= 1U << bufferIndex;
+}
+
+static inline void psp2GxmStateSetFragmentUniformBuffer(Psp2GxmState *state,
+	uint32_t bufferIndex, const void *bufferData)
+{
+	if (state->fragmentUniformBuffersDirty & (1U << bufferIndex))
+		state->elidedCount++;
+
+	state->pendingFragmentUniformBuffers[bufferIndex] = bufferData;
+	state->fragmentUniformBuffersDirty |= 1U << bufferIndex;
+}
+
+static inline void psp2GxmStateSetVertexStream(Psp2GxmState *state,
+	uint32_t streamIndex, const void *streamData)
+{
+	if (state->vertexStreamsDirty & (1U << streamIndex))
+		state->elidedCount++;
+
+	state->pendingVertexStreams[streamIndex] = streamData;
+	state->vertexStreamsDirty |= 1U << streamIndex;
+}
+
+static inline int psp2GxmStateFlushBuffers(Psp2GxmState *state,
+	const void **bound, const void *const *pending, uint32_t *valid,
+	uint32_t dirty, SceGxmErrorCode (*set)(SceGxmContext *context,
+		uint32_t index, const void *data))
+{
+	uint32_t bit, i;
+	int ret, err;
+
+	err = SCE_OK;
+	for (; dirty != 0; dirty &= ~bit) {
+		i = __builtin_ctz(dirty);
+		bit = 1U << i;
+		if ((*valid & bit) && bound[i] == pending[i]) {
+			state->elidedCount++;
+			continue;
+		}
+
+		state->issuedCount++;
+		ret = set(state->context, i, pending[i]);
+		if (ret < 0) {
+			*valid &= ~bit;
+			if (err == SCE_OK)
+				err = ret;
+			continue;
+		}
+
+		bound[i] = pending[i];
+		*valid |= bit;
+	}
+
+	return err;
+}
+
+/**
+ * Issues the pending texture, uniform buffer and vertex stream bindings that
+ * change the state of the context.
+ *
+ * @param[in,out]	state	The shadow state.
+ *
+ * @retval
+ * SCE_OK	The operation was completed successfully.
+ * @retval
+ * <0 The first error returned by a binding function.  The other bindings are
+ * still issued.
+ *
+ * @ingroup render
+ */
+static inline SceGxmErrorCode psp2GxmStateFlush(Psp2GxmState *state)
+{
+	uint32_t dirty, bit, i;
+	int ret, err;
+
+	err = SCE_OK;
+
+	for (dirty = state->vertexTexturesDirty; dirty != 0; dirty &= ~bit) {
+		i = __builtin_ctz(dirty);
+		bit = 1U << i;
+		if ((state->vertexTexturesValid & bit)
+			&& __builtin_memcmp(state->vertexTextures + i,
+				state->pendingVertexTextures + i,
+				sizeof(SceGxmTexture)) == 0) {
+			state->elidedCount++;
+			continue;
+		}
+
+		state->issuedCount++;
+		ret = sceGxmSetVertexTexture(state->context, i,
+			state->pendingVertexTextures + i);
+		if (ret < 0) {
+			state->vertexTexturesValid &= ~bit;
+			if (err == SCE_OK)
+				err = ret;
+			continue;
+		}
+
+		state->vertexTextures[i] = state->pendingVertexTextures[i];
+		state->vertexTexturesValid |= bit;
+	}
+
+	for (dirty = state->fragmentTexturesDirty; dirty != 0; dirty &= ~bit) {
+		i = __builtin_ctz(dirty);
+		bit = 1U << i;
+		if ((state->fragmentTexturesValid & bit)
+			&& __builtin_memcmp(state->fragmentTextures + i,
+				state->pendingFragmentTextures + i,
+				sizeof(SceGxmTexture)) == 0) {
+			state->elidedCount++;
+			continue;
+		}
+
+		state->issuedCount++;
+		ret = sceGxmSetFragmentTexture(state->context, i,
+			state->pendingFragmentTextures + i);
+		if (ret < 0) {
+			state->fragmentTexturesValid &= ~bit;
+			if (err == SCE_OK)
+				err = ret;
+			continue;
+		}
+
+		state->fragmentTextures[i] = state->pendingFragmentTextures[i];
+		state->fragmentTexturesValid |= bit;
+	}
+
+	ret = psp2GxmStateFlushBuffers(state, state->vertexUniformBuffers,
+		state->pendingVertexUniformBuffers, &state->vertexUniformBuffersValid,
+		state->vertexUniformBuffersDirty, sceGxmSetVertexUniformBuffer);
+	if (ret < 0 && err == SCE_OK)
+		err = ret;
+
+	ret = psp2GxmStateFlushBuffers(state, state->fragmentUniformBuffers,
+		state->pendingFragmentUniformBuffers,
+		&state->fragmentUniformBuffersValid,
+		state->fragmentUniformBuffersDirty, sceGxmSetFragmentUniformBuffer);
+	if (ret < 0 && err == SCE_OK)
+		err = ret;
+
+	ret = psp2GxmStateFlushBuffers(state, state->vertexStreams,
+		state->pendingVertexStreams, &state->vertexStreamsValid,
+		state->vertexStreamsDirty, sceGxmSetVertexStream);
+	if (ret < 0 && err == SCE_OK)
+		err = ret;
+
+	state->vertexTexturesDirty = 0;
+	state->fragmentTexturesDirty = 0;
+	state->vertexUniformBuffersDirty = 0;
+	state->fragmentUniformBuffersDirty = 0;
+	state->vertexStreamsDirty = 0;
+
+	return err;
+}
+
+/**
+ * Issues the pending bindings with #psp2GxmStateFlush() and draws with
+ * #sceGxmDraw().
+ *
+ * @retval
+ * SCE_OK	The operation was completed successfully.
+ * @retval
+ * <0 The error returned by a binding function or by #sceGxmDraw().
+ *
+ * @ingroup render
+ */
+static inline SceGxmErrorCode psp2GxmStateDraw(Psp2GxmState *state,
+	SceGxmPrimitiveType primType, SceGxmIndexFormat indexType,
+	const void *indexData, uint32_t indexCount)
+{
+	int ret;
+
+	ret = psp2GxmStateFlush(state);
+	if (ret < 0)
+		return ret;
+
+	return sceGxmDraw(state->context, primType, indexType,
+		indexData, indexCount);
+}
+
+#ifdef	__cplusplus
+}
+#endif	// def __cplusplus
+
+#endif /* _PSP2_GXM_STATE_H_ */
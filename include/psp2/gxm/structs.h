@@ -104,8 +104,6 @@ typedef struct SceGxmColorSurface {
 	SceGxmTexture backgroundTex;							//!< Precomputed background object texture control words.
 } SceGxmColorSurface;
 
-#if !defined(_LP64) && !defined(_M_X64)
-
 /** 
  * Controls how depth and stencil values are loaded from memory at the
  * start of each tile, and how they are saved to memory at the end of each tile.
@@ -137,8 +135,6 @@ typedef struct SceGxmNotification {
 	uint32_t value;					//!< The 32-bit value that will be written.
 } SceGxmNotification;
 
-#endif // !defined(_LP64) && !defined(_M_X64)
-
 /** 
  * Represents a rectangular region from 0,0 to xMax,yMax (inclusive). This structure is for
  * use as the optional <c><i>validRegion</i></c> parameter to #sceGxmBeginScene().
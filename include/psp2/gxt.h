@@ -95,6 +95,10 @@ typedef enum SceGxtTextureFlags {
 #define SCE_GXT_PALETTE_SIZE_P4					64U
 #define SCE_GXT_PALETTE_SIZE_P8					1024U
 
+#ifndef SCE_UNLIKELY
+#define SCE_UNLIKELY(x)		__builtin_expect(!!(x), 0)
+#endif	/*	#ifndef SCE_UNLIKELY	*/
+
 #ifndef SCE_GXT_ERROR_RETURN
 #if defined _DEBUG && !defined(SCE_GXT_DISABLE_ERROR_TTY)
 #define SCE_GXT_ERROR_RETURN(COND, ERROR_CODE, FMT, ...)		\
@@ -136,7 +140,7 @@ extern "C" {
  * @param gxt				A pointer to the GXT data.
  * @return					The size of the header in bytes.
  */
-inline uint32_t sceGxtGetHeaderSize(const void *gxt)
+static inline uint32_t sceGxtGetHeaderSize(const void *gxt)
 {
 	SCE_GXT_ASSERT(NULL != gxt);
 
@@ -149,7 +153,7 @@ inline uint32_t sceGxtGetHeaderSize(const void *gxt)
  * @param gxt				A pointer to the GXT data.
  * @return					A pointer to the start of the texture data.
  */
-inline const void* sceGxtGetDataAddress(const void *gxt)
+static inline const void* sceGxtGetDataAddress(const void *gxt)
 {
 	SCE_GXT_ASSERT(NULL != gxt);
 
@@ -162,7 +166,7 @@ inline const void* sceGxtGetDataAddress(const void *gxt)
  * @param gxt				A pointer to the GXT data.
  * @return					The size of the texture data in bytes.
  */
-inline uint32_t sceGxtGetDataSize(const void *gxt)
+static inline uint32_t sceGxtGetDataSize(const void *gxt)
 {
 	SCE_GXT_ASSERT(NULL != gxt);
 
@@ -176,7 +180,7 @@ inline uint32_t sceGxtGetDataSize(const void *gxt)
  * @param gxt				A pointer to the GXT data.
  * @return					The number of textures.
  */
-inline uint32_t sceGxtGetTextureCount(const void *gxt)
+static inline uint32_t sceGxtGetTextureCount(const void *gxt)
 {
 	SCE_GXT_ASSERT(NULL != gxt);
 
@@ -190,7 +194,7 @@ inline uint32_t sceGxtGetTextureCount(const void *gxt)
  * @param textureIndex		The index of the texture.
  * @return					A value of true if the texture has border data. If not, false is returned.
  */
-inline bool sceGxtTextureHasBorderData(const void *gxt, uint32_t textureIndex)
+static inline bool sceGxtTextureHasBorderData(const void *gxt, uint32_t textureIndex)
 {
 	const SceGxtHeader *hdr = (const SceGxtHeader*)gxt;
 
@@ -215,7 +219,7 @@ inline bool sceGxtTextureHasBorderData(const void *gxt, uint32_t textureIndex)
  * @retval					SCE_GXT_ERROR_INVALID_VALUE The operation failed due to an invalid input parameter.
  * @retval					SCE_GXT_ERROR_INVALID_POINTER The operation failed due to an invalid input pointer.
  */
-inline SceGxtErrorCode sceGxtSetPalette(SceGxmTexture *texture, const void *gxt, const void *textureData, uint32_t paletteIndex)
+static inline SceGxtErrorCode sceGxtSetPalette(SceGxmTexture *texture, const void *gxt, const void *textureData, uint32_t paletteIndex)
 {
 	// check parameters
 	SCE_GXT_ERROR_RETURN(
@@ -288,7 +292,7 @@ inline SceGxtErrorCode sceGxtSetPalette(SceGxmTexture *texture, const void *gxt,
  * @retval					SCE_GXT_ERROR_INVALID_VALUE The operation failed due to an invalid input parameter.
  * @retval					SCE_GXT_ERROR_INVALID_POINTER The operation failed due to an invalid input pointer.
  */
-inline SceGxtErrorCode sceGxtInitTexture(SceGxmTexture *texture, const void *gxt, const void *textureData, uint32_t textureIndex)
+static inline SceGxtErrorCode sceGxtInitTexture(SceGxmTexture *texture, const void *gxt, const void *textureData, uint32_t textureIndex)
 {
 	const SceGxtHeader *hdr = (const SceGxtHeader*)gxt;
 
@@ -395,7 +399,7 @@ inline SceGxtErrorCode sceGxtInitTexture(SceGxmTexture *texture, const void *gxt
  * or the version numbers are not compatible.
  * @retval				SCE_GXT_ERROR_INVALID_POINTER The operation failed due to an invalid input pointer.
  */
-inline SceGxtErrorCode sceGxtCheckData(const void *gxt)
+static inline SceGxtErrorCode sceGxtCheckData(const void *gxt)
 {
 	// check parameter
 	SCE_GXT_ERROR_RETURN(
@@ -0,0 +1,533 @@
+/**
+ * \file gxt_loader.h
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+
+#ifndef _PSP2_GXT_LOADER_H_
+#define _PSP2_GXT_LOADER_H_
+
+/**
+ * @file
+ *
+ * A loader of GXT files that reads the texture data straight into GPU mapped
+ * memory.
+ *
+ * The loader reads the header and texture information of the file into a
+ * host buffer, allocates the texture data from a heap of
+ * <c>psp2/gxm/heap.h</c> and reads it there with #sceIoReadAsync(), without
+ * an intermediate copy.  The textures are read one at a time, the palettes
+ * first.  The mip levels of a swizzled texture are read from the smallest to
+ * the largest, and the minimum level of detail of the texture is lowered as
+ * they arrive, so that the texture may be drawn with its smaller levels
+ * while the larger ones are still being read.
+ *
+ * @code
+ * 	psp2GxtLoaderOpen(&loader, "app0:tex.gxt", &heap,
+ * 		header, sizeof(header), textures, 16);
+ *
+ * 	// Each frame
+ * 	psp2GxtLoaderPoll(&loader);
+ * 	if (textures[0].levelCount > 0)
+ * 		sceGxmSetFragmentTexture(context, 0, &textures[0].texture);
+ * @endcode
+ *
+ * A loader is not thread-safe.
+ */
+#include <psp2/gxm/heap.h>
+#include <psp2/io/fcntl.h>
+#include <psp2/gxt.h>
+
+#ifdef	__cplusplus
+extern "C" {
+#endif	// def __cplusplus
+
+/**
+ * The size under which the smallest mip levels of a texture are read
+ * together.
+ */
+#define PSP2_GXT_LOADER_MIN_READ_SIZE		(16 * 1024)
+
+/**
+ * A texture of a GXT file.
+ */
+typedef struct Psp2GxtLoaderTexture {
+	SceGxmTexture texture;				//!< The texture.
+	uint32_t levelCount;				//!< The number of mip levels read, from the smallest.  The texture may be used once it is not 0.
+} Psp2GxtLoaderTexture;
+
+/**
+ * A GXT file loader.
+ */
+typedef struct Psp2GxtLoader {
+	SceUID fd;							//!< The file, or a negative value once it is closed.
+	Psp2GxmHeap *heap;
+	const SceGxtHeader *header;			//!< The header and texture information of the file.
+	uint8_t *data;						//!< The texture data, allocated from the heap.
+	Psp2GxtLoaderTexture *textures;
+	uint32_t texture;					//!< The index of the texture being read.
+	uint32_t level;						//!< The first mip level being read.
+	uint32_t size;						//!< The size of the read in progress, or 0.
+	uint32_t palettesRead;				//!< Whether the palettes were read, or there are none.
+	uint32_t readCount;					//!< The number of reads.
+	uint32_t bytesRead;					//!< The number of bytes of texture data read.
+	int error;							//!< The first error of a read, or SCE_OK.
+} Psp2GxtLoader;
+
+static inline const SceGxtTextureInfo *psp2GxtLoaderGetInfo(
+	const Psp2GxtLoader *loader, uint32_t index)
+{
+	return (const SceGxtTextureInfo *)(loader->header + 1) + index;
+}
+
+/**
+ * Returns the bits per pixel of a texture format, or 0 for the YUV formats.
+ */
+static inline uint32_t psp2GxtLoaderGetBitsPerPixel(uint32_t format)
+{
+	uint32_t base;
+
+	base = format & SCE_GXM_TEXTURE_BASE_FORMAT_MASK;
+	if (base < SCE_GXM_TEXTURE_BASE_FORMAT_U4U4U4U4)
+		return 8;
+	if (base < SCE_GXM_TEXTURE_BASE_FORMAT_U8U8U8U8)
+		return 16;
+	if (base < SCE_GXM_TEXTURE_BASE_FORMAT_F16F16F16F16)
+		return 32;
+	if (base <= SCE_GXM_TEXTURE_BASE_FORMAT_U32U32)
+		return 64;
+
+	switch (base) {
+	case SCE_GXM_TEXTURE_BASE_FORMAT_PVRT2BPP:
+	case SCE_GXM_TEXTURE_BASE_FORMAT_PVRTII2BPP:
+		return 2;
+	case SCE_GXM_TEXTURE_BASE_FORMAT_PVRT4BPP:
+	case SCE_GXM_TEXTURE_BASE_FORMAT_PVRTII4BPP:
+	case SCE_GXM_TEXTURE_BASE_FORMAT_UBC1:
+	case SCE_GXM_TEXTURE_BASE_FORMAT_UBC4:
+	case SCE_GXM_TEXTURE_BASE_FORMAT_SBC4:
+	case SCE_GXM_TEXTURE_BASE_FORMAT_P4:
+		return 4;
+	case SCE_GXM_TEXTURE_BASE_FORMAT_UBC2:
+	case SCE_GXM_TEXTURE_BASE_FORMAT_UBC3:
+	case SCE_GXM_TEXTURE_BASE_FORMAT_UBC5:
+	case SCE_GXM_TEXTURE_BASE_FORMAT_SBC5:
+	case SCE_GXM_TEXTURE_BASE_FORMAT_P8:
+		return 8;
+	case SCE_GXM_TEXTURE_BASE_FORMAT_U8U8U8:
+	case SCE_GXM_TEXTURE_BASE_FORMAT_S8S8S8:
+		return 24;
+	case SCE_GXM_TEXTURE_BASE_FORMAT_U2F10F10F10:
+		return 32;
+	default:
+		return 0;
+	}
+}
+
+/**
+ * Returns the size of a mip level of a swizzled texture.  The dimensions of
+ * the levels are powers of two, and those of the block compressed formats
+ * are at least the size of a block, or 8x8 and 16x8 pixels for PVRT.
+ */
+static inline uint32_t psp2GxtLoaderGetLevelSize(const SceGxtTextureInfo *info,
+	uint32_t level)
+{
+	uint32_t width, height, minWidth, minHeight;
+
+	width = 1;
+	while (width < info->width)
+		width <<= 1;
+	height = 1;
+	while (height < info->height)
+		height <<= 1;
+	width >>= level;
+	height >>= level;
+
+	switch (info->format & SCE_GXM_TEXTURE_BASE_FORMAT_MASK) {
+	case SCE_GXM_TEXTURE_BASE_FORMAT_PVRT2BPP:
+	case SCE_GXM_TEXTURE_BASE_FORMAT_PVRTII2BPP:
+		minWidth = 16;
+		minHeight = 8;
+		break;
+	case SCE_GXM_TEXTURE_BASE_FORMAT_PVRT4BPP:
+	case SCE_GXM_TEXTURE_BASE_FORMAT_PVRTII4BPP:
+		minWidth = 8;
+		minHeight = 8;
+		break;
+	case SCE_GXM_TEXTURE_BASE_FORMAT_UBC1:
+	case SCE_GXM_TEXTURE_BASE_FORMAT_UBC2:
+	case SCE_GXM_TEXTURE_BASE_FORMAT_UBC3:
+	case SCE_GXM_TEXTURE_BASE_FORMAT_UBC4:
+	case SCE_GXM_TEXTURE_BASE_FORMAT_SBC4:
+	case SCE_GXM_TEXTURE_BASE_FORMAT_UBC5:
+	case SCE_GXM_TEXTURE_BASE_FORMAT_SBC5:
+		minWidth = 4;
+		minHeight = 4;
+		break;
+	default:
+		minWidth = 1;
+		minHeight = 1;
+		break;
+	}
+
+	if (width < minWidth)
+		width = minWidth;
+	if (height < minHeight)
+		height = minHeight;
+
+	return width * height * psp2GxtLoaderGetBitsPerPixel(info->format) / 8;
+}
+
+/**
+ * Returns whether the mip levels of a texture can be read separately: the
+ * texture is swizzled, and the sizes of its levels add up to the size of its
+ * data.
+ */
+static inline int psp2GxtLoaderCanStream(const SceGxtTextureInfo *info)
+{
+	uint32_t level, size;
+
+	if (info->type != SCE_GXM_TEXTURE_SWIZZLED || info->mipCount <= 1
+		|| psp2GxtLoaderGetBitsPerPixel(info->format) == 0)
+		return 0;
+
+	size = 0;
+	for (level = 0; level < info->mipCount; level++)
+		size += psp2GxtLoaderGetLevelSize(info, level);
+
+	return size == info->dataSize;
+}
+
+static inline int psp2GxtLoaderRead(Psp2GxtLoader *loader,
+	uint32_t offset, uint32_t size)
+{
+	int ret;
+
+	ret = sceIoLseek32(loader->fd, loader->header->dataOffset + offset,
+		PSP2_SEEK_SET);
+	if (ret < 0)
+		return ret;
+
+	ret = sceIoReadAsync(loader->fd, loader->data + offset, size);
+	if (ret < 0)
+		return ret;
+
+	loader->size = size;
+	loader->readCount++;
+
+	return SCE_OK;
+}
+
+/**
+ * Starts the next read, if any.
+ */
+static inline int psp2GxtLoaderIssue(Psp2GxtLoader *loader)
+{
+	const SceGxtTextureInfo *info;
+	uint32_t paletteSize, offset, size, end, i;
+
+	if (!loader->palettesRead) {
+		paletteSize = loader->header->numP4Palettes * SCE_GXT_PALETTE_SIZE_P4
+			+ loader->header->numP8Palettes * SCE_GXT_PALETTE_SIZE_P8;
+		if (paletteSize > 0)
+			return psp2GxtLoaderRead(loader,
+				loader->header->dataSize - paletteSize, paletteSize);
+		loader->palettesRead = 1;
+	}
+
+	while (loader->texture < loader->header->numTextures) {
+		info = psp2GxtLoaderGetInfo(loader, loader->texture);
+		offset = info->dataOffset - loader->header->dataOffset;
+
+		if (loader->textures[loader->texture].levelCount == 0) {
+			if (!psp2GxtLoaderCanStream(info)) {
+				loader->level = 0;
+				if (info->dataSize > 0)
+					return psp2GxtLoaderRead(loader, offset, info->dataSize);
+				loader->textures[loader->texture].levelCount = 1;
+				continue;
+			}
+
+			// Read the smallest levels together.
+			end = offset + info->dataSize;
+			loader->level = info->mipCount - 1;
+			size = psp2GxtLoaderGetLevelSize(info, loader->level);
+			while (loader->level > 0 && size
+				+ psp2GxtLoaderGetLevelSize(info, loader->level - 1)
+					<= PSP2_GXT_LOADER_MIN_READ_SIZE) {
+				loader->level--;
+				size += psp2GxtLoaderGetLevelSize(info, loader->level);
+			}
+
+			return psp2GxtLoaderRead(loader, end - size, size);
+		}
+
+		if (loader->level > 0) {
+			// The levels follow each other from the largest.
+			loader->level--;
+			end = offset + info->dataSize;
+			for (i = info->mipCount; i > loader->level + 1; i--)
+				end -= psp2GxtLoaderGetLevelSize(info, i - 1);
+			size = psp2GxtLoaderGetLevelSize(info, loader->level);
+
+			return psp2GxtLoaderRead(loader, end - size, size);
+		}
+
+		loader->texture++;
+	}
+
+	return SCE_OK;
+}
+
+/**
+ * Processes the result of the read in progress, and starts the next one.  An
+ * error stops the loader, and is returned again by every later call.
+ */
+static inline int psp2GxtLoaderComplete(Psp2GxtLoader *loader, int wait)
+{
+	Psp2GxtLoaderTexture *texture;
+	const SceGxtTextureInfo *info;
+	SceInt64 result;
+	uint32_t size;
+	int ret;
+
+	if (loader->error < 0)
+		return loader->error;
+	if (loader->size == 0)
+		return SCE_OK;
+
+	if (wait)
+		ret = sceIoWaitAsync(loader->fd, &result);
+	else
+		ret = sceIoPollAsync(loader->fd, &result);
+	if (ret < 0)
+		return loader->error = ret;
+	if (ret > 0)
+		return 1;
+
+	size = loader->size;
+	loader->size = 0;
+	if (result < 0)
+		return loader->error = (int)result;
+	if (result != size)
+		return loader->error = SCE_GXT_ERROR_INVALID_VALUE;
+
+	loader->bytesRead += size;
+
+	if (!loader->palettesRead)
+		loader->palettesRead = 1;
+	else if (loader->texture < loader->header->numTextures) {
+		texture = loader->textures + loader->texture;
+		info = psp2GxtLoaderGetInfo(loader, loader->texture);
+		if (psp2GxtLoaderCanStream(info)) {
+			texture->levelCount = info->mipCount - loader->level;
+			sceGxmTextureSetLodMin(&texture->texture, loader->level);
+		} else
+			texture->levelCount = info->mipCount > 1 ? info->mipCount : 1;
+	}
+
+	ret = psp2GxtLoaderIssue(loader);
+	if (ret < 0)
+		return loader->error = ret;
+
+	return loader->size != 0;
+}
+
+/**
+ * Closes the file of a loader, after waiting for the read in progress.  The
+ * texture data stays allocated, and must be freed with #psp2GxmHeapFree()
+ * when the GPU no longer uses the textures.
+ *
+ * @param[in,out]	loader	The loader.
+ */
+static inline void psp2GxtLoaderClose(Psp2GxtLoader *loader)
+{
+	SceInt64 result;
+
+	if (loader->fd < 0)
+		return;
+
+	if (loader->size != 0) {
+		sceIoCancel(loader->fd);
+		sceIoWaitAsync(loader->fd, &result);
+		loader->size = 0;
+	}
+
+	sceIoClose(loader->fd);
+	loader->fd = -1;
+}
+
+/**
+ * Opens a GXT file and starts reading its texture data.
+ *
+ * The header and texture information are read before this function returns,
+ * and the textures are initialized with #sceGxtInitTexture().  They must not
+ * be used before their level count is not 0.
+ *
+ * @param[out]	loader		The loader.
+ * @param[in]	path		The path of the file.
+ * @param[in]	heap		The heap to allocate the texture data from, mapped for reading.
+ * @param[out]	header		The buffer for the header and texture information, aligned
+ * 							to 4 bytes.  It must persist until the textures are no
+ * 							longer used.
+ * @param[in]	headerSize	The size of the header buffer in bytes.
+ * @param[out]	textures	The textures.
+ * @param[in]	textureCount	The number of textures, at least the number of
+ * 							textures of the file.
+ *
+ * @retval
+ * SCE_OK	The operation was completed successfully.
+ * @retval
+ * SCE_GXT_ERROR_INVALID_POINTER The operation failed because a parameter was unexpectedly <c>NULL</c>.
+ * @retval
+ * SCE_GXT_ERROR_INVALID_VALUE The file is not a valid GXT file, or the buffers are too small for it.
+ * @retval
+ * SCE_GXM_ERROR_OUT_OF_MEMORY The heap could not allocate the texture data.
+ * @retval
+ * <0 The error returned by an I/O function or by #sceGxtInitTexture().
+ */
+static inline int psp2GxtLoaderOpen(Psp2GxtLoader *loader, const char *path,
+	Psp2GxmHeap *heap, void *header, uint32_t headerSize,
+	Psp2GxtLoaderTexture *textures, uint32_t textureCount)
+{
+	const SceGxtHeader *gxt;
+	const SceGxtTextureInfo *info;
+	uint32_t i;
+	int ret;
+
+	if (loader == NULL || path == NULL || heap == NULL || header == NULL
+		|| textures == NULL)
+		return SCE_GXT_ERROR_INVALID_POINTER;
+	if (headerSize < sizeof(SceGxtHeader))
+		return SCE_GXT_ERROR_INVALID_VALUE;
+
+	__builtin_memset(loader, 0, sizeof(*loader));
+	loader->heap = heap;
+	loader->header = gxt = (const SceGxtHeader *)header;
+	loader->textures = textures;
+
+	loader->fd = sceIoOpen(path, PSP2_O_RDONLY, 0);
+	if (loader->fd < 0)
+		return loader->fd;
+
+	ret = sceIoRead(loader->fd, header, sizeof(SceGxtHeader));
+	if (ret >= 0 && ret != sizeof(SceGxtHeader))
+		ret = SCE_GXT_ERROR_INVALID_VALUE;
+	if (ret >= 0)
+		ret = sceGxtCheckData(header);
+	if (ret >= 0 && (gxt->numTextures > textureCount
+		|| gxt->dataOffset > headerSize
+		|| gxt->dataOffset < sizeof(SceGxtHeader)
+			+ gxt->numTextures * sizeof(SceGxtTextureInfo)
+		|| gxt->numP4Palettes > gxt->dataSize / SCE_GXT_PALETTE_SIZE_P4
+		|| gxt->numP8Palettes > gxt->dataSize / SCE_GXT_PALETTE_SIZE_P8
+		|| gxt->numP4Palettes * SCE_GXT_PALETTE_SIZE_P4
+			+ gxt->numP8Palettes * SCE_GXT_PALETTE_SIZE_P8 > gxt->dataSize
+		|| gxt->dataSize == 0))
+		ret = SCE_GXT_ERROR_INVALID_VALUE;
+	if (ret < 0)
+		goto fail;
+
+	ret = sceIoRead(loader->fd, (SceGxtHeader *)header + 1,
+		gxt->dataOffset - sizeof(SceGxtHeader));
+	if (ret >= 0 && ret != (int)(gxt->dataOffset - sizeof(SceGxtHeader)))
+		ret = SCE_GXT_ERROR_INVALID_VALUE;
+	if (ret < 0)
+		goto fail;
+
+	for (i = 0; i < gxt->numTextures; i++) {
+		info = psp2GxtLoaderGetInfo(loader, i);
+		if (info->dataOffset < gxt->dataOffset
+			|| info->dataOffset - gxt->dataOffset > gxt->dataSize
+			|| info->dataSize > gxt->dataSize
+				- (info->dataOffset - gxt->dataOffset)) {
+			ret = SCE_GXT_ERROR_INVALID_VALUE;
+			goto fail;
+		}
+	}
+
+	loader->data = (uint8_t *)psp2GxmHeapAlloc(heap, gxt->dataSize,
+		SCE_GXM_PALETTE_ALIGNMENT);
+	if (loader->data == NULL) {
+		ret = SCE_GXM_ERROR_OUT_OF_MEMORY;
+		goto fail;
+	}
+
+	for (i = 0; i < gxt->numTextures; i++) {
+		textures[i].levelCount = 0;
+		ret = sceGxtInitTexture(&textures[i].texture, header, loader->data, i);
+		if (ret < 0)
+			goto fail;
+	}
+
+	ret = psp2GxtLoaderIssue(loader);
+	if (ret < 0)
+		goto fail;
+
+	return SCE_OK;
+
+fail:
+	psp2GxtLoaderClose(loader);
+	if (loader->data != NULL) {
+		psp2GxmHeapFree(heap, loader->data);
+		loader->data = NULL;
+	}
+
+	return ret;
+}
+
+/**
+ * Processes the read in progress if it has completed, and starts the next
+ * one, without waiting.  After an error, the loader stops and every later
+ * call returns the same error.
+ *
+ * @param[in,out]	loader	The loader.
+ *
+ * @retval
+ * SCE_OK	All the texture data was read.
+ * @retval
+ * 1 The texture data is still being read.
+ * @retval
+ * SCE_GXT_ERROR_INVALID_VALUE The file is shorter than its header describes.
+ * @retval
+ * <0 The error returned by an I/O function.
+ */
+static inline int psp2GxtLoaderPoll(Psp2GxtLoader *loader)
+{
+	return psp2GxtLoaderComplete(loader, 0);
+}
+
+/**
+ * Waits until all the texture data of a loader is read, or until a read
+ * fails as for #psp2GxtLoaderPoll().
+ *
+ * @param[in,out]	loader	The loader.
+ *
+ * @retval
+ * SCE_OK	All the texture data was read.
+ * @retval
+ * SCE_GXT_ERROR_INVALID_VALUE The file is shorter than its header describes.
+ * @retval
+ * <0 The error returned by an I/O function.
+ */
+static inline int psp2GxtLoaderWait(Psp2GxtLoader *loader)
+{
+	int ret;
+
+	do
+		ret = psp2GxtLoaderComplete(loader, 1);
+	while (ret > 0);
+
+	return ret;
+}
+
+#ifdef	__cplusplus
+}
+#endif	// def __cplusplus
+
+#endif /* _PSP2_GXT_LOADER_H_ */
@@ -0,0 +1,696 @@
+/**
+ * \file jobs.h
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+
+#ifndef _PSP2_JOBS_H_
+#define _PSP2_JOBS_H_
+
+/**
+ * @file
+ *
+ * A work-stealing job scheduler.
+ *
+ * The scheduler has a worker for the calling thread and a worker thread for
+ * each other worker, each pinned to a core.  A job is a function with an
+ * argument.  A worker pushes the jobs it runs to the bottom of its own
+ * deque and pops them from there, while idle workers steal jobs from the top
+ * of the deques of the others.  The deques are the lock-free deques of
+ * Chase and Lev.
+ *
+ * Each job may count down a counter when it is done, and
+ * #psp2JobWait() runs jobs until a counter reaches zero.  A job may run
+ * child jobs the same way, so the jobs of a frame form a tree whose root is
+ * waited for by the calling thread:
+ *
+ * @code
+ * 	static void update(Psp2JobWorker *worker, void *arg)
+ * 	{
+ * 		Psp2JobCounter counter = PSP2_JOB_COUNTER_INIT;
+ * 		Psp2Job children[2] = { { animate, arg }, { simulate, arg } };
+ *
+ * 		psp2JobRun(worker, &children[0], &counter);
+ * 		psp2JobRun(worker, &children[1], &counter);
+ * 		psp2JobWait(worker, &counter);
+ * 	}
+ *
+ * 	Psp2JobWorker *worker = psp2JobSchedulerGetWorker(&scheduler);
+ * 	Psp2JobCounter counter = PSP2_JOB_COUNTER_INIT;
+ * 	Psp2Job job = { update, world };
+ *
+ * 	psp2JobRun(worker, &job, &counter);
+ * 	psp2JobWait(worker, &counter);
+ * @endcode
+ *
+ * A worker that finds no job spins for a while, then sleeps on an event flag
+ * until a job is pushed or the counter it waits for reaches zero.
+ *
+ * The functions that take a worker must be called by the thread of that
+ * worker: the thread that called #psp2JobSchedulerInit() for the worker of
+ * #psp2JobSchedulerGetWorker(), or a job for the worker it is given.
+ */
+#include <psp2/kernel/atomic.h>
+#include <psp2/kernel/error.h>
+#include <psp2/kernel/threadmgr.h>
+
+#ifdef	__cplusplus
+extern "C" {
+#endif	// def __cplusplus
+
+/** The maximum number of workers, the calling thread included */
+#define PSP2_JOB_MAX_WORKERS			4
+
+/** The number of jobs a deque holds, a power of two */
+#define PSP2_JOB_DEQUE_SIZE				256
+
+/** The default number of times an idle worker looks for a job before it sleeps */
+#define PSP2_JOB_DEFAULT_SPIN_COUNT		64
+
+/** The maximum number of jobs #psp2JobParallelFor() splits a range into */
+#define PSP2_JOB_PARALLEL_FOR_MAX_JOBS	32
+
+/** The maximum number of jobs a counter counts */
+#define PSP2_JOB_COUNTER_MAX			0xFFFF
+
+/** The initializer of a #Psp2JobCounter */
+#define PSP2_JOB_COUNTER_INIT			{ 0 }
+
+struct Psp2JobWorker;
+
+/**
+ * The function of a job.
+ *
+ * @param[in,out]	worker	The worker running the job.
+ * @param[in]		arg		The argument of the job.
+ */
+typedef void (*Psp2JobFunc)(struct Psp2JobWorker *worker, void *arg);
+
+/**
+ * A counter of the jobs that are not done.  At most one worker may wait for
+ * a counter at a time.
+ *
+ * The count and the waiter share a word, so that the job that counts the
+ * counter down to zero learns who waits without touching the counter again:
+ * the counter may be on the stack of the waiter, which may return as soon as
+ * the count is zero.
+ */
+typedef struct Psp2JobCounter {
+	volatile int32_t value;				//!< The count in the low 16 bits, the waiter in the high 16 bits.
+} Psp2JobCounter;
+
+/**
+ * A job.  It must persist until it is done.
+ */
+typedef struct Psp2Job {
+	Psp2JobFunc func;					//!< The function of the job.
+	void *arg;							//!< The argument of the function.
+	Psp2JobCounter *counter;			//!< Set by #psp2JobRun().
+} Psp2Job;
+
+/**
+ * The worker threads of a scheduler and the event flag they sleep on, shared
+ * with the scheduler of psp2/fiber_jobs.h.
+ */
+typedef struct Psp2JobThreads {
+	SceUID eventFlag;					//!< A bit for each worker, set to wake it.
+	volatile int32_t sleepMask;			//!< The bits of the workers that sleep or are about to.
+	volatile int32_t quit;
+	uint32_t workerCount;
+	uint32_t spinCount;
+	SceUID threads[PSP2_JOB_MAX_WORKERS];	//!< The thread of each worker, 0 for the worker of the calling thread.
+} Psp2JobThreads;
+
+/**
+ * A worker.
+ */
+typedef struct Psp2JobWorker {
+	struct Psp2JobScheduler *scheduler;
+	uint32_t index;
+	volatile int32_t top;				//!< The next job to steal.
+	volatile int32_t bottom;			//!< The next free entry of the deque.
+	Psp2Job *volatile jobs[PSP2_JOB_DEQUE_SIZE];
+	uint32_t runCount;					//!< The number of jobs the worker ran.
+	uint32_t stealCount;				//!< The number of jobs the worker stole.
+	uint32_t inlineCount;				//!< The number of jobs run at once because the deque was full.
+	uint32_t sleepCount;				//!< The number of times the worker slept.
+} Psp2JobWorker;
+
+/**
+ * The parameters of #psp2JobSchedulerInit().
+ */
+typedef struct Psp2JobSchedulerParams {
+	uint32_t workerCount;				//!< The number of workers, the calling thread included.
+	int priority;						//!< The priority of the worker threads.
+	int stackSize;						//!< The stack size of the worker threads.
+	int cpuAffinityMask[PSP2_JOB_MAX_WORKERS];	//!< The CPU affinity mask of each worker thread, or 0 to put worker i on user core i modulo 3.  The first mask is not used.
+	uint32_t spinCount;					//!< The number of times an idle worker looks for a job before it sleeps, or 0 for the default.
+} Psp2JobSchedulerParams;
+
+/**
+ * A job scheduler.
+ */
+typedef struct Psp2JobScheduler {
+	Psp2JobThreads threads;
+	Psp2JobWorker workers[PSP2_JOB_MAX_WORKERS];
+} Psp2JobScheduler;
+
+/* Wake a worker if it sleeps */
+static inline void psp2JobThreadsWake(Psp2JobThreads *threads, uint32_t index)
+{
+	int32_t bit;
+
+	bit = 1 << index;
+	if (psp2AtomicGetAndAnd32(&threads->sleepMask, ~bit) & bit)
+		sceKernelSetEventFlag(threads->eventFlag, bit);
+}
+
+/* Wake a sleeping worker, if any */
+static inline void psp2JobThreadsWakeOne(Psp2JobThreads *threads)
+{
+	int32_t mask, bit;
+
+	mask = psp2AtomicLoad32(&threads->sleepMask);
+	while (mask != 0) {
+		bit = mask & -mask;
+		mask = psp2AtomicGetAndAnd32(&threads->sleepMask, ~bit);
+		if (mask & bit) {
+			sceKernelSetEventFlag(threads->eventFlag, bit);
+			return;
+		}
+	}
+}
+
+/*
+ * Publish that a worker is about to sleep.  The worker looks for work once
+ * more before it sleeps, and those who publish work look at the bits after
+ * they publish it, so that no wakeup is lost.
+ */
+static inline void psp2JobThreadsBeginSleep(Psp2JobThreads *threads,
+	uint32_t index)
+{
+	psp2AtomicGetAndOr32(&threads->sleepMask, 1 << index);
+}
+
+/* Sleep until woken if the worker found no work, and clear its bit */
+static inline void psp2JobThreadsEndSleep(Psp2JobThreads *threads,
+	uint32_t index, int idle)
+{
+	int32_t bit;
+
+	bit = 1 << index;
+	if (idle)
+		sceKernelWaitEventFlag(threads->eventFlag, bit,
+			PSP2_EVENT_WAITOR | PSP2_EVENT_WAITCLEAR, NULL, NULL);
+
+	psp2AtomicGetAndAnd32(&threads->sleepMask, ~bit);
+}
+
+/* Stop the worker threads once they are idle, and delete the event flag */
+static inline void psp2JobThreadsTerm(Psp2JobThreads *threads)
+{
+	uint32_t i;
+
+	psp2AtomicStore32(&threads->quit, 1);
+	if (threads->eventFlag > 0)
+		sceKernelSetEventFlag(threads->eventFlag,
+			(1U << PSP2_JOB_MAX_WORKERS) - 1);
+
+	for (i = 0; i < PSP2_JOB_MAX_WORKERS; i++) {
+		if (threads->threads[i] > 0) {
+			sceKernelWaitThreadEnd(threads->threads[i], NULL, NULL);
+			sceKernelDeleteThread(threads->threads[i]);
+			threads->threads[i] = 0;
+		}
+	}
+
+	if (threads->eventFlag > 0) {
+		sceKernelDeleteEventFlag(threads->eventFlag);
+		threads->eventFlag = 0;
+	}
+}
+
+/* Create the event flag of the workers, whose threads are not started yet */
+static inline int psp2JobThreadsInit(Psp2JobThreads *threads,
+	const char *name, uint32_t workerCount, uint32_t spinCount)
+{
+	int ret;
+
+	__builtin_memset(threads, 0, sizeof(*threads));
+	threads->workerCount = workerCount;
+	threads->spinCount = spinCount;
+
+	ret = sceKernelCreateEventFlag(name, PSP2_EVENT_WAITMULTIPLE, 0, NULL);
+	if (ret < 0)
+		return ret;
+	threads->eventFlag = ret;
+
+	return 0;
+}
+
+/*
+ * Start the thread of a worker, on user core index modulo 3 if the CPU
+ * affinity mask is 0.  The entry gets a pointer to the worker pointer.
+ */
+static inline int psp2JobThreadsStart(Psp2JobThreads *threads,
+	uint32_t index, const char *name, SceKernelThreadEntry entry,
+	int priority, int stackSize, int cpuAffinityMask, void *worker)
+{
+	SceUID thread;
+	int ret;
+
+	if (cpuAffinityMask == 0)
+		cpuAffinityMask = SCE_KERNEL_CPU_MASK_USER_0
+			<< (index % SCE_KERNEL_USER_CPU_COUNT);
+
+	thread = sceKernelCreateThread(name, entry, priority, stackSize, 0,
+		cpuAffinityMask, NULL);
+	if (thread < 0)
+		return thread;
+
+	ret = sceKernelStartThread(thread, sizeof(worker), &worker);
+	if (ret < 0) {
+		sceKernelDeleteThread(thread);
+		return ret;
+	}
+
+	threads->threads[index] = thread;
+
+	return 0;
+}
+
+/* Push a job to the bottom of the deque of its owner */
+static inline int psp2JobDequePush(Psp2JobWorker *worker, Psp2Job *job)
+{
+	int32_t bottom;
+
+	bottom = worker->bottom;
+	if (bottom - psp2AtomicLoad32(&worker->top) >= PSP2_JOB_DEQUE_SIZE)
+		return -1;
+
+	worker->jobs[bottom & (PSP2_JOB_DEQUE_SIZE - 1)] = job;
+	psp2AtomicStore32(&worker->bottom, bottom + 1);
+
+	return 0;
+}
+
+/* Pop a job from the bottom of the deque of its owner */
+static inline Psp2Job *psp2JobDequePop(Psp2JobWorker *worker)
+{
+	int32_t bottom, top;
+	Psp2Job *job;
+
+	bottom = worker->bottom - 1;
+	psp2AtomicStore32(&worker->bottom, bottom);
+	top = psp2AtomicLoad32(&worker->top);
+
+	if (bottom - top < 0) {
+		psp2AtomicStore32(&worker->bottom, bottom + 1);
+		return NULL;
+	}
+
+	job = worker->jobs[bottom & (PSP2_JOB_DEQUE_SIZE - 1)];
+	if (bottom == top) {
+		// The last job: race the thieves for it.
+		if (psp2AtomicCompareAndSet32(&worker->top, top, top + 1) != top)
+			job = NULL;
+		psp2AtomicStore32(&worker->bottom, bottom + 1);
+	}
+
+	return job;
+}
+
+/* Steal a job from the top of the deque of another worker */
+static inline Psp2Job *psp2JobDequeSteal(Psp2JobWorker *victim)
+{
+	int32_t top, bottom;
+	Psp2Job *job;
+
+	top = psp2AtomicLoad32(&victim->top);
+	bottom = psp2AtomicLoad32(&victim->bottom);
+	if (bottom - top <= 0)
+		return NULL;
+
+	job = victim->jobs[top & (PSP2_JOB_DEQUE_SIZE - 1)];
+	if (psp2AtomicCompareAndSet32(&victim->top, top, top + 1) != top)
+		return NULL;
+
+	return job;
+}
+
+/* Take a job of the worker, or steal one */
+static inline Psp2Job *psp2JobFind(Psp2JobWorker *worker)
+{
+	Psp2JobScheduler *scheduler;
+	uint32_t i, victim;
+	Psp2Job *job;
+
+	job = psp2JobDequePop(worker);
+	if (job != NULL)
+		return job;
+
+	scheduler = worker->scheduler;
+	victim = worker->index;
+	for (i = 1; i < scheduler->threads.workerCount; i++) {
+		if (++victim == scheduler->threads.workerCount)
+			victim = 0;
+
+		job = psp2JobDequeSteal(scheduler->workers + victim);
+		if (job != NULL) {
+			worker->stealCount++;
+			return job;
+		}
+	}
+
+	return NULL;
+}
+
+static inline int psp2JobHasWork(Psp2JobScheduler *scheduler)
+{
+	Psp2JobWorker *worker;
+	uint32_t i;
+
+	for (i = 0; i < scheduler->threads.workerCount; i++) {
+		worker = scheduler->workers + i;
+		if (psp2AtomicLoad32(&worker->bottom)
+			- psp2AtomicLoad32(&worker->top) > 0)
+			return 1;
+	}
+
+	return 0;
+}
+
+/*
+ * Register a waiter on a counter.  Fails if the count is already zero, in
+ * which case nothing will wake the waiter.
+ */
+static inline int psp2JobCounterPark(Psp2JobCounter *counter, int32_t waiter)
+{
+	int32_t value;
+
+	value = psp2AtomicLoad32(&counter->value);
+	for (;;) {
+		if ((value & PSP2_JOB_COUNTER_MAX) == 0)
+			return -1;
+
+		if (psp2AtomicCompareAndSet32(&counter->value, value,
+			(value & PSP2_JOB_COUNTER_MAX) | (waiter << 16)) == value)
+			return 0;
+
+		value = psp2AtomicLoad32(&counter->value);
+	}
+}
+
+/*
+ * Count a counter down, and return its waiter if it reached zero, or 0.  The
+ * counter may be gone once it reached zero.
+ */
+static inline int32_t psp2JobCounterDone(Psp2JobCounter *counter)
+{
+	int32_t value;
+
+	value = psp2AtomicAddAndGet32(&counter->value, -1);
+	if ((value & PSP2_JOB_COUNTER_MAX) != 0)
+		return 0;
+
+	return (uint32_t)value >> 16;
+}
+
+/* Sleep until a job is pushed, the scheduler quits, or the counter reaches zero */
+static inline void psp2JobSleep(Psp2JobWorker *worker,
+	Psp2JobCounter *counter)
+{
+	Psp2JobScheduler *scheduler;
+	int idle;
+
+	scheduler = worker->scheduler;
+	psp2JobThreadsBeginSleep(&scheduler->threads, worker->index);
+
+	idle = !psp2JobHasWork(scheduler)
+		&& !psp2AtomicLoad32(&scheduler->threads.quit)
+		&& (counter == NULL
+			|| psp2JobCounterPark(counter, worker->index + 1) == 0);
+	if (idle)
+		worker->sleepCount++;
+
+	psp2JobThreadsEndSleep(&scheduler->threads, worker->index, idle);
+}
+
+/* Run a job and count it down */
+static inline void psp2JobExecute(Psp2JobWorker *worker, Psp2Job *job)
+{
+	Psp2JobCounter *counter;
+	int32_t waiter;
+
+	counter = job->counter;
+	job->func(worker, job->arg);
+	worker->runCount++;
+
+	if (counter != NULL) {
+		waiter = psp2JobCounterDone(counter);
+		if (waiter != 0)
+			psp2JobThreadsWake(&worker->scheduler->threads, waiter - 1);
+	}
+}
+
+/**
+ * Runs a job on any worker.  If the deque of the worker is full, the job
+ * runs at once instead.
+ *
+ * @param[in,out]	worker	The worker of the calling thread.
+ * @param[in,out]	job		The job.  It must persist until it is done.
+ * @param[in,out]	counter	The counter to count the job down when it is
+ * 							done, or NULL.  It counts at most
+ * 							#PSP2_JOB_COUNTER_MAX jobs.
+ */
+static inline void psp2JobRun(Psp2JobWorker *worker, Psp2Job *job,
+	Psp2JobCounter *counter)
+{
+	job->counter = counter;
+	if (counter != NULL)
+		psp2AtomicGetAndAdd32(&counter->value, 1);
+
+	if (psp2JobDequePush(worker, job) < 0) {
+		worker->inlineCount++;
+		psp2JobExecute(worker, job);
+		return;
+	}
+
+	if (psp2AtomicLoad32(&worker->scheduler->threads.sleepMask) != 0)
+		psp2JobThreadsWakeOne(&worker->scheduler->threads);
+}
+
+/**
+ * Runs jobs until a counter reaches zero.
+ *
+ * @param[in,out]	worker	The worker of the calling thread.
+ * @param[in,out]	counter	The counter.
+ */
+static inline void psp2JobWait(Psp2JobWorker *worker, Psp2JobCounter *counter)
+{
+	Psp2Job *job;
+	uint32_t spin;
+
+	spin = 0;
+	while ((psp2AtomicLoad32(&counter->value) & PSP2_JOB_COUNTER_MAX) != 0) {
+		job = psp2JobFind(worker);
+		if (job != NULL) {
+			psp2JobExecute(worker, job);
+			spin = 0;
+		} else if (++spin >= worker->scheduler->threads.spinCount) {
+			psp2JobSleep(worker, counter);
+			spin = 0;
+		}
+	}
+
+	// Only the waiter is left to touch the counter.
+	psp2AtomicStore32(&counter->value, 0);
+}
+
+static inline int psp2JobThread(SceSize args, void *argp)
+{
+	Psp2JobScheduler *scheduler;
+	Psp2JobWorker *worker;
+	Psp2Job *job;
+	uint32_t spin;
+
+	(void)args;
+	worker = *(Psp2JobWorker **)argp;
+	scheduler = worker->scheduler;
+
+	spin = 0;
+	while (!psp2AtomicLoad32(&scheduler->threads.quit)) {
+		job = psp2JobFind(worker);
+		if (job != NULL) {
+			psp2JobExecute(worker, job);
+			spin = 0;
+		} else if (++spin >= scheduler->threads.spinCount) {
+			psp2JobSleep(worker, NULL);
+			spin = 0;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * Gets the worker of the thread that called #psp2JobSchedulerInit().
+ *
+ * @param[in,out]	scheduler	The scheduler.
+ *
+ * @return
+ * The worker.
+ */
+static inline Psp2JobWorker *psp2JobSchedulerGetWorker(
+	Psp2JobScheduler *scheduler)
+{
+	return scheduler->workers;
+}
+
+/**
+ * Terminates a scheduler: stops the worker threads once they are idle.  The
+ * jobs must be done.
+ *
+ * @param[in,out]	scheduler	The scheduler.
+ */
+static inline void psp2JobSchedulerTerm(Psp2JobScheduler *scheduler)
+{
+	psp2JobThreadsTerm(&scheduler->threads);
+}
+
+/**
+ * Initializes a scheduler and starts its worker threads.
+ *
+ * @param[out]	scheduler	The scheduler.
+ * @param[in]	params		The parameters.  This structure does not need to
+ * 							persist after the call.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_KERNEL_ERROR_INVALID_ARGUMENT The number of workers is not valid.
+ * @retval
+ * <0 The error returned by the creation of the event flag or of a thread.
+ */
+static inline int psp2JobSchedulerInit(Psp2JobScheduler *scheduler,
+	const Psp2JobSchedulerParams *params)
+{
+	uint32_t i;
+	int ret;
+
+	__builtin_memset(scheduler, 0, sizeof(*scheduler));
+
+	if (params->workerCount == 0
+		|| params->workerCount > PSP2_JOB_MAX_WORKERS)
+		return SCE_KERNEL_ERROR_INVALID_ARGUMENT;
+
+	for (i = 0; i < PSP2_JOB_MAX_WORKERS; i++) {
+		scheduler->workers[i].scheduler = scheduler;
+		scheduler->workers[i].index = i;
+	}
+
+	ret = psp2JobThreadsInit(&scheduler->threads, "psp2JobScheduler",
+		params->workerCount, params->spinCount != 0 ?
+			params->spinCount : PSP2_JOB_DEFAULT_SPIN_COUNT);
+	if (ret < 0)
+		return ret;
+
+	for (i = 1; i < params->workerCount; i++) {
+		ret = psp2JobThreadsStart(&scheduler->threads, i, "psp2JobWorker",
+			psp2JobThread, params->priority, params->stackSize,
+			params->cpuAffinityMask[i], scheduler->workers + i);
+		if (ret < 0) {
+			psp2JobSchedulerTerm(scheduler);
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * The function of #psp2JobParallelFor().
+ *
+ * @param[in,out]	worker	The worker running the range.
+ * @param[in]		begin	The first index of the range.
+ * @param[in]		end		The index after the range.
+ * @param[in]		arg		The argument of #psp2JobParallelFor().
+ */
+typedef void (*Psp2JobParallelForFunc)(Psp2JobWorker *worker,
+	uint32_t begin, uint32_t end, void *arg);
+
+typedef struct Psp2JobParallelForRange {
+	Psp2Job job;
+	Psp2JobParallelForFunc func;
+	void *arg;
+	uint32_t begin;
+	uint32_t end;
+} Psp2JobParallelForRange;
+
+static inline void psp2JobParallelForJob(Psp2JobWorker *worker, void *arg)
+{
+	Psp2JobParallelForRange *range;
+
+	range = (Psp2JobParallelForRange *)arg;
+	range->func(worker, range->begin, range->end, range->arg);
+}
+
+/**
+ * Calls a function over a range of indices split between the workers, and
+ * returns when the whole range is done.  The range is split into ranges of
+ * at least a grain of indices, at most #PSP2_JOB_PARALLEL_FOR_MAX_JOBS of
+ * them.
+ *
+ * @param[in,out]	worker	The worker of the calling thread.
+ * @param[in]		count	The number of indices, from 0.
+ * @param[in]		grain	The minimum number of indices of a range, or 0
+ * 							for 1.
+ * @param[in]		func	The function.
+ * @param[in]		arg		The argument of the function.
+ */
+static inline void psp2JobParallelFor(Psp2JobWorker *worker, uint32_t count,
+	uint32_t grain, Psp2JobParallelForFunc func, void *arg)
+{
+	Psp2JobParallelForRange ranges[PSP2_JOB_PARALLEL_FOR_MAX_JOBS];
+	Psp2JobCounter counter = PSP2_JOB_COUNTER_INIT;
+	uint32_t jobCount, size, i;
+
+	if (count == 0)
+		return;
+	if (grain == 0)
+		grain = 1;
+
+	jobCount = (count + grain - 1) / grain;
+	if (jobCount > PSP2_JOB_PARALLEL_FOR_MAX_JOBS)
+		jobCount = PSP2_JOB_PARALLEL_FOR_MAX_JOBS;
+	size = (count + jobCount - 1) / jobCount;
+	jobCount = (count + size - 1) / size;
+
+	for (i = 0; i < jobCount; i++) {
+		ranges[i].job.func = psp2JobParallelForJob;
+		ranges[i].job.arg = ranges + i;
+		ranges[i].func = func;
+		ranges[i].arg = arg;
+		ranges[i].begin = i * size;
+		ranges[i].end = i + 1 < jobCount ? (i + 1) * size : count;
+	}
+
+	// The other workers steal the first ranges, the calling thread pops
+	// the last ones.
+	for (i = 1; i < jobCount; i++)
+		psp2JobRun(worker, &ranges[i].job, &counter);
+
+	func(worker, ranges[0].begin, ranges[0].end, arg);
+	psp2JobWait(worker, &counter);
+}
+
+#ifdef	__cplusplus
+}
+#endif	// def __cplusplus
+
+#endif /* _PSP2_JOBS_H_ */
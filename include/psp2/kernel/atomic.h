@@ -0,0 +1,216 @@
+/**
+ * \file
+ * \brief Header file which defines inline atomic operations
+ *
+ * The operations are built on the LDREX/STREX exclusive access instructions
+ * of Cortex-A9 and behave like the sceKernelAtomic*32 functions exported by
+ * SceLibKernel, without the cost of an import call. Every read-modify-write
+ * operation is a full memory barrier.
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef _PSP2_KERNEL_ATOMIC_H_
+#define _PSP2_KERNEL_ATOMIC_H_
+
+#include <psp2/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Data memory barrier over the inner shareable domain (all cores) */
+#define PSP2_ATOMIC_DMB() __asm__ __volatile__ ("dmb ish" ::: "memory")
+
+/**
+ * Load a 32-bit value with acquire semantics
+ *
+ * @param ptr - Pointer to the value
+ *
+ * @return The value
+ */
+static inline int32_t psp2AtomicLoad32(const volatile int32_t *ptr)
+{
+	int32_t value = *ptr;
+	PSP2_ATOMIC_DMB();
+	return value;
+}
+
+/**
+ * Store a 32-bit value with release semantics
+ *
+ * @param ptr - Pointer to the value
+ * @param value - The value to store
+ */
+static inline void psp2AtomicStore32(volatile int32_t *ptr, int32_t value)
+{
+	PSP2_ATOMIC_DMB();
+	*ptr = value;
+	PSP2_ATOMIC_DMB();
+}
+
+/**
+ * Atomically add to a 32-bit value
+ *
+ * @param ptr - Pointer to the value
+ * @param value - The value to add
+ *
+ * @return The value before the addition
+ */
+static inline int32_t psp2AtomicGetAndAdd32(volatile int32_t *ptr, int32_t value)
+{
+	int32_t old, tmp;
+	uint32_t failed;
+
+	PSP2_ATOMIC_DMB();
+	__asm__ __volatile__ (
+		"1:	ldrex	%0, [%3]\n"
+		"	add	%1, %0, %4\n"
+		"	strex	%2, %1, [%3]\n"
+		"	teq	%2, #0\n"
+		"	bne	1b\n"
+		: "=&r" (old), "=&r" (tmp), "=&r" (failed)
+		: "r" (ptr), "r" (value)
+		: "cc", "memory");
+	PSP2_ATOMIC_DMB();
+
+	return old;
+}
+
+/**
+ * Atomically add to a 32-bit value
+ *
+ * @param ptr - Pointer to the value
+ * @param value - The value to add
+ *
+ * @return The value after the addition
+ */
+static inline int32_t psp2AtomicAddAndGet32(volatile int32_t *ptr, int32_t value)
+{
+	return psp2AtomicGetAndAdd32(ptr, value) + value;
+}
+
+/**
+ * Atomically replace a 32-bit value
+ *
+ * @param ptr - Pointer to the value
+ * @param value - The new value
+ *
+ * @return The value before the replacement
+ */
+static inline int32_t psp2AtomicGetAndSet32(volatile int32_t *ptr, int32_t value)
+{
+	int32_t old;
+	uint32_t failed;
+
+	PSP2_ATOMIC_DMB();
+	__asm__ __volatile__ (
+		"1:	ldrex	%0, [%2]\n"
+		"	strex	%1, %3, [%2]\n"
+		"	teq	%1, #0\n"
+		"	bne	1b\n"
+		: "=&r" (old), "=&r" (failed)
+		: "r" (ptr), "r" (value)
+		: "cc", "memory");
+	PSP2_ATOMIC_DMB();
+
+	return old;
+}
+
+/**
+ * Atomically replace a 32-bit value if it matches an expected one
+ *
+ * @param ptr - Pointer to the value
+ * @param expected - The value expected to be stored
+ * @param value - The new value, stored only if the current one is expected
+ *
+ * @return The value before the operation; it equals expected on success
+ */
+static inline int32_t psp2AtomicCompareAndSet32(volatile int32_t *ptr,
+	int32_t expected, int32_t value)
+{
+	int32_t old;
+	uint32_t failed;
+
+	PSP2_ATOMIC_DMB();
+	__asm__ __volatile__ (
+		"1:	ldrex	%0, [%2]\n"
+		"	teq	%0, %3\n"
+		"	bne	2f\n"
+		"	strex	%1, %4, [%2]\n"
+		"	teq	%1, #0\n"
+		"	bne	1b\n"
+		"2:\n"
+		: "=&r" (old), "=&r" (failed)
+		: "r" (ptr), "r" (expected), "r" (value)
+		: "cc", "memory");
+	PSP2_ATOMIC_DMB();
+
+	return old;
+}
+
+/**
+ * Atomically OR a mask into a 32-bit value
+ *
+ * @param ptr - Pointer to the value
+ * @param mask - The bits to set
+ *
+ * @return The value before the operation
+ */
+static inline int32_t psp2AtomicGetAndOr32(volatile int32_t *ptr, int32_t mask)
+{
+	int32_t old, tmp;
+	uint32_t failed;
+
+	PSP2_ATOMIC_DMB();
+	__asm__ __volatile__ (
+		"1:	ldrex	%0, [%3]\n"
+		"	orr	%1, %0, %4\n"
+		"	strex	%2, %1, [%3]\n"
+		"	teq	%2, #0\n"
+		"	bne	1b\n"
+		: "=&r" (old), "=&r" (tmp), "=&r" (failed)
+		: "r" (ptr), "r" (mask)
+		: "cc", "memory");
+	PSP2_ATOMIC_DMB();
+
+	return old;
+}
+
+/**
+ * Atomically AND a mask into a 32-bit value
+ *
+ * @param ptr - Pointer to the value
+ * @param mask - The bits to keep
+ *
+ * @return The value before the operation
+ */
+static inline int32_t psp2AtomicGetAndAnd32(volatile int32_t *ptr, int32_t mask)
+{
+	int32_t old, tmp;
+	uint32_t failed;
+
+	PSP2_ATOMIC_DMB();
+	__asm__ __volatile__ (
+		"1:	ldrex	%0, [%3]\n"
+		"	and	%1, %0, %4\n"
+		"	strex	%2, %1, [%3]\n"
+		"	teq	%2, #0\n"
+		"	bne	1b\n"
+		: "=&r" (old), "=&r" (tmp), "=&r" (failed)
+		: "r" (ptr), "r" (mask)
+		: "cc", "memory");
+	PSP2_ATOMIC_DMB();
+
+	return old;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PSP2_KERNEL_ATOMIC_H_ */
@@ -13,14 +13,12 @@
 #define _PSP2_KERNEL_THREADMGR_H_
 
 #include <psp2/types.h>
+#include <psp2/kernel/types.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-/** 64-bit system clock type. */
-typedef SceUInt64 SceKernelSysClock;
-
 /* Threads. */
 
 typedef int (*SceKernelThreadEntry)(SceSize args, void *argp);
@@ -108,6 +106,17 @@ typedef enum Psp2ThreadStatus
 	PSP2_THREAD_KILLED  = 32, /* Thread manager has killed the thread (stack overflow) */
 } Psp2ThreadStatus;
 
+/** CPU affinity masks of the cores available to applications */
+#define SCE_KERNEL_CPU_MASK_USER_0	0x00010000
+#define SCE_KERNEL_CPU_MASK_USER_1	0x00020000
+#define SCE_KERNEL_CPU_MASK_USER_2	0x00040000
+#define SCE_KERNEL_CPU_MASK_USER_ALL	\
+	(SCE_KERNEL_CPU_MASK_USER_0 | SCE_KERNEL_CPU_MASK_USER_1	\
+		| SCE_KERNEL_CPU_MASK_USER_2)
+
+/** The number of cores available to applications */
+#define SCE_KERNEL_USER_CPU_COUNT	3
+
 /**
  * Create a thread
  *
@@ -261,6 +270,15 @@ int sceKernelReleaseWaitThread(SceUID thid);
   */
 int sceKernelGetThreadId(void);
 
+/**
+ * Get the address of a thread local storage slot of the current thread
+ *
+ * @param key - The index of the slot
+ *
+ * @return Pointer to the pointer-sized slot, NULL if the index is invalid.
+ */
+void *sceKernelGetTLSAddr(int key);
+
 /**
  * Get the current priority of the thread you are in.
  *
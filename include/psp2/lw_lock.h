@@ -0,0 +1,743 @@
+/**
+ * \file lw_lock.h
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+
+#ifndef _PSP2_LW_LOCK_H_
+#define _PSP2_LW_LOCK_H_
+
+/**
+ * @file
+ *
+ * Lightweight locks that only enter the kernel under contention.
+ *
+ * #sceKernelLockMutex() and #sceKernelUnlockMutex() are system calls even
+ * when no other thread wants the mutex.  The locks of this file take and
+ * release an uncontended lock with a single atomic operation in user memory.
+ * A thread that finds the lock taken spins for a bounded number of tries,
+ * since the owner is likely running on another core and about to release
+ * it, and then blocks on a kernel semaphore that the owner only signals when
+ * a thread blocks.
+ *
+ * - #Psp2LwMutex is a mutex whose word counts the threads that hold or want
+ *   it, so that the unlock knows whether to signal.
+ * - #Psp2LwRwLock is a reader-writer lock whose word packs the readers, the
+ *   readers waiting and the writers.  A writer waiting blocks the readers
+ *   that come after it, so writers are not starved.
+ * - #Psp2LwCond is a condition variable on a #Psp2LwMutex.
+ *
+ * The locks are not recursive, have no timeout, and must be released by the
+ * thread that took them.  Each lock counts how often it was contended and
+ * blocked; #psp2LwMutexGetInfo() and #psp2LwRwLockGetInfo() read the
+ * counters the way #sceKernelGetMutexInfo() reads a kernel mutex.
+ */
+#include <psp2/kernel/atomic.h>
+#include <psp2/kernel/error.h>
+#include <psp2/kernel/threadmgr.h>
+
+#ifdef	__cplusplus
+extern "C" {
+#endif	// def __cplusplus
+
+/** The default number of tries of a contended lock before it blocks */
+#define PSP2_LW_LOCK_DEFAULT_SPIN_COUNT	128
+
+/** The maximum count of the semaphores of the locks */
+#define PSP2_LW_LOCK_SEMA_MAX			0x7FFFFFFF
+
+/** The maximum number of threads that hold or wait for a #Psp2LwRwLock, per kind */
+#define PSP2_LW_RWLOCK_MAX_THREADS		0x3FF
+
+#define PSP2_LW_RWLOCK_READER			0x00000001	//!< A reader holding the lock.
+#define PSP2_LW_RWLOCK_WAITING_READER	0x00000400	//!< A reader waiting for the writers.
+#define PSP2_LW_RWLOCK_WRITER			0x00100000	//!< A writer holding or waiting for the lock.
+
+#define PSP2_LW_RWLOCK_READERS(state)			((state) & PSP2_LW_RWLOCK_MAX_THREADS)
+#define PSP2_LW_RWLOCK_WAITING_READERS(state)	(((state) >> 10) & PSP2_LW_RWLOCK_MAX_THREADS)
+#define PSP2_LW_RWLOCK_WRITERS(state)			(((state) >> 20) & PSP2_LW_RWLOCK_MAX_THREADS)
+
+/**
+ * A lightweight mutex.
+ */
+typedef struct Psp2LwMutex {
+	volatile int32_t count;				//!< The number of threads that hold or wait for the mutex.
+	SceUID sema;						//!< Signaled to hand the mutex to a blocked thread.
+	uint32_t spinCount;
+	uint32_t lockCount;					//!< The number of times the mutex was locked.
+	uint32_t contendedCount;			//!< The number of times the mutex was found locked.
+	uint32_t blockCount;				//!< The number of times a thread blocked for the mutex.
+	char name[32];
+} Psp2LwMutex;
+
+/**
+ * The state of a #Psp2LwMutex, like #SceKernelMutexInfo.
+ */
+typedef struct Psp2LwMutexInfo {
+	SceSize size;						//!< The size of this structure, set by the caller.
+	SceUID semaId;						//!< The UID of the semaphore of the mutex.
+	char name[32];
+	int currentCount;					//!< 1 if the mutex is locked, or else 0.
+	int numWaitThreads;					//!< The number of threads spinning or blocked for the mutex.
+	uint32_t spinCount;
+	uint32_t lockCount;					//!< The number of times the mutex was locked.
+	uint32_t contendedCount;			//!< The number of times the mutex was found locked.
+	uint32_t blockCount;				//!< The number of times a thread blocked for the mutex.
+} Psp2LwMutexInfo;
+
+/**
+ * A lightweight reader-writer lock.
+ */
+typedef struct Psp2LwRwLock {
+	volatile int32_t state;				//!< The readers, the waiting readers and the writers.
+	SceUID readSema;					//!< Signaled to let in the readers that waited for a writer.
+	SceUID writeSema;					//!< Signaled to hand the lock to a blocked writer.
+	uint32_t spinCount;
+	volatile int32_t readContendedCount;	//!< The number of times a reader found the lock taken.
+	volatile int32_t readBlockCount;	//!< The number of times a reader blocked.
+	uint32_t writeLockCount;			//!< The number of times the lock was locked for writing.
+	uint32_t writeContendedCount;		//!< The number of times a writer found the lock taken.
+	uint32_t writeBlockCount;			//!< The number of times a writer blocked.
+	char name[32];
+} Psp2LwRwLock;
+
+/**
+ * The state of a #Psp2LwRwLock.
+ */
+typedef struct Psp2LwRwLockInfo {
+	SceSize size;						//!< The size of this structure, set by the caller.
+	char name[32];
+	int numReaders;						//!< The number of readers holding the lock.
+	int numWaitReaders;					//!< The number of readers blocked for a writer.
+	int numWriters;						//!< The number of writers holding or waiting for the lock.
+	uint32_t spinCount;
+	uint32_t readContendedCount;		//!< The number of times a reader found the lock taken.
+	uint32_t readBlockCount;			//!< The number of times a reader blocked.
+	uint32_t writeLockCount;			//!< The number of times the lock was locked for writing.
+	uint32_t writeContendedCount;		//!< The number of times a writer found the lock taken.
+	uint32_t writeBlockCount;			//!< The number of times a writer blocked.
+} Psp2LwRwLockInfo;
+
+/**
+ * A lightweight condition variable.
+ */
+typedef struct Psp2LwCond {
+	Psp2LwMutex *mutex;					//!< The mutex that guards the condition.
+	SceUID sema;						//!< Signaled once for each waiter woken.
+	int32_t waitCount;					//!< The number of waiters not yet signaled, guarded by the mutex.
+} Psp2LwCond;
+
+static inline void psp2LwLockSetName(char *dst, const char *name)
+{
+	__builtin_strncpy(dst, name, 31);
+	dst[31] = '\0';
+}
+
+/**
+ * Creates a mutex.
+ *
+ * @param[out]	mutex		The mutex.
+ * @param[in]	name		The name of the mutex and of its semaphore.
+ * @param[in]	spinCount	The number of tries of a contended lock before it
+ * 							blocks, or 0 for the default.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * <0	The error returned by the creation of the semaphore.
+ */
+static inline int psp2LwMutexCreate(Psp2LwMutex *mutex, const char *name,
+	uint32_t spinCount)
+{
+	int ret;
+
+	__builtin_memset(mutex, 0, sizeof(*mutex));
+	mutex->spinCount = spinCount != 0 ?
+		spinCount : PSP2_LW_LOCK_DEFAULT_SPIN_COUNT;
+	psp2LwLockSetName(mutex->name, name);
+
+	ret = sceKernelCreateSema(name, 0, 0, PSP2_LW_LOCK_SEMA_MAX, NULL);
+	if (ret < 0)
+		return ret;
+	mutex->sema = ret;
+
+	return 0;
+}
+
+/**
+ * Deletes a mutex.  The mutex must be unlocked.
+ *
+ * @param[in,out]	mutex	The mutex.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * <0	The error returned by the deletion of the semaphore.
+ */
+static inline int psp2LwMutexDelete(Psp2LwMutex *mutex)
+{
+	return sceKernelDeleteSema(mutex->sema);
+}
+
+/**
+ * Locks a mutex if it is unlocked.
+ *
+ * @param[in,out]	mutex	The mutex.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_KERNEL_ERROR_LW_MUTEX_FAILED_TO_OWN	The mutex is locked.
+ */
+static inline int psp2LwMutexTryLock(Psp2LwMutex *mutex)
+{
+	if (psp2AtomicCompareAndSet32(&mutex->count, 0, 1) != 0)
+		return SCE_KERNEL_ERROR_LW_MUTEX_FAILED_TO_OWN;
+
+	mutex->lockCount++;
+	return 0;
+}
+
+/**
+ * Locks a mutex: spins while it is locked, then blocks until it is handed
+ * over.
+ *
+ * @param[in,out]	mutex	The mutex.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * <0	The error returned by the wait on the semaphore.  The mutex is not
+ * held.
+ */
+static inline int psp2LwMutexLock(Psp2LwMutex *mutex)
+{
+	uint32_t spin, contended, blocked;
+	int32_t count;
+	int ret;
+
+	contended = 0;
+	blocked = 0;
+	if (psp2AtomicCompareAndSet32(&mutex->count, 0, 1) != 0) {
+		contended = 1;
+		for (spin = 0; spin < mutex->spinCount; spin++)
+			if (psp2AtomicLoad32(&mutex->count) == 0
+				&& psp2AtomicCompareAndSet32(&mutex->count, 0, 1) == 0)
+				break;
+
+		// Announce the thread; the unlock that sees it hands the mutex over.
+		if (spin == mutex->spinCount
+			&& psp2AtomicGetAndAdd32(&mutex->count, 1) != 0) {
+			ret = sceKernelWaitSema(mutex->sema, 1, NULL);
+			if (ret < 0) {
+				/*
+				 * Withdraw the thread.  If it is the only one counted, an
+				 * unlock handed the mutex over to it: take the signal, which
+				 * that unlock is about to post, then unlock, so that no later
+				 * thread takes it.
+				 */
+				for (;;) {
+					count = psp2AtomicLoad32(&mutex->count);
+					if (count == 1) {
+						do
+							count = sceKernelPollSema(mutex->sema, 1);
+						while (count == (int32_t)SCE_KERNEL_ERROR_SEMA_ZERO);
+
+						if (count == 0
+							&& psp2AtomicGetAndAdd32(&mutex->count, -1) > 1)
+							sceKernelSignalSema(mutex->sema, 1);
+						break;
+					}
+
+					if (psp2AtomicCompareAndSet32(&mutex->count, count,
+						count - 1) == count)
+						break;
+				}
+
+				return ret;
+			}
+			blocked = 1;
+		}
+	}
+
+	mutex->lockCount++;
+	mutex->contendedCount += contended;
+	mutex->blockCount += blocked;
+
+	return 0;
+}
+
+/**
+ * Unlocks a mutex, and hands it over to a blocked thread if any.
+ *
+ * @param[in,out]	mutex	The mutex.  The calling thread must hold it.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * <0	The error returned by the signal of the semaphore.
+ */
+static inline int psp2LwMutexUnlock(Psp2LwMutex *mutex)
+{
+	if (psp2AtomicGetAndAdd32(&mutex->count, -1) > 1)
+		return sceKernelSignalSema(mutex->sema, 1);
+
+	return 0;
+}
+
+/**
+ * Gets the state and the counters of a mutex.  The counters are only exact
+ * while the mutex is held by the calling thread.
+ *
+ * @param[in]		mutex	The mutex.
+ * @param[in,out]	info	The state.  Its size must be set.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_KERNEL_ERROR_ILLEGAL_SIZE	The size of the state is not valid.
+ */
+static inline int psp2LwMutexGetInfo(Psp2LwMutex *mutex,
+	Psp2LwMutexInfo *info)
+{
+	int32_t count;
+
+	if (info->size != sizeof(*info))
+		return SCE_KERNEL_ERROR_ILLEGAL_SIZE;
+
+	count = psp2AtomicLoad32(&mutex->count);
+	info->semaId = mutex->sema;
+	__builtin_memcpy(info->name, mutex->name, sizeof(info->name));
+	info->currentCount = count > 0;
+	info->numWaitThreads = count > 1 ? count - 1 : 0;
+	info->spinCount = mutex->spinCount;
+	info->lockCount = mutex->lockCount;
+	info->contendedCount = mutex->contendedCount;
+	info->blockCount = mutex->blockCount;
+
+	return 0;
+}
+
+/**
+ * Creates a reader-writer lock.
+ *
+ * @param[out]	rwlock		The lock.
+ * @param[in]	name		The name of the lock and of its semaphores.
+ * @param[in]	spinCount	The number of tries of a contended lock before it
+ * 							blocks, or 0 for the default.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * <0	The error returned by the creation of a semaphore.
+ */
+static inline int psp2LwRwLockCreate(Psp2LwRwLock *rwlock, const char *name,
+	uint32_t spinCount)
+{
+	int ret;
+
+	__builtin_memset(rwlock, 0, sizeof(*rwlock));
+	rwlock->spinCount = spinCount != 0 ?
+		spinCount : PSP2_LW_LOCK_DEFAULT_SPIN_COUNT;
+	psp2LwLockSetName(rwlock->name, name);
+
+	ret = sceKernelCreateSema(name, 0, 0, PSP2_LW_LOCK_SEMA_MAX, NULL);
+	if (ret < 0)
+		return ret;
+	rwlock->readSema = ret;
+
+	ret = sceKernelCreateSema(name, 0, 0, PSP2_LW_LOCK_SEMA_MAX, NULL);
+	if (ret < 0) {
+		sceKernelDeleteSema(rwlock->readSema);
+		return ret;
+	}
+	rwlock->writeSema = ret;
+
+	return 0;
+}
+
+/**
+ * Deletes a reader-writer lock.  The lock must be unlocked.
+ *
+ * @param[in,out]	rwlock	The lock.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * <0	The error returned by the deletion of a semaphore.
+ */
+static inline int psp2LwRwLockDelete(Psp2LwRwLock *rwlock)
+{
+	int ret;
+
+	ret = sceKernelDeleteSema(rwlock->readSema);
+	if (ret < 0)
+		return ret;
+
+	return sceKernelDeleteSema(rwlock->writeSema);
+}
+
+/**
+ * Locks a reader-writer lock for reading if no writer holds or waits for it.
+ *
+ * @param[in,out]	rwlock	The lock.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_KERNEL_ERROR_RW_LOCK_FAILED_TO_LOCK	A writer holds or waits for the
+ * lock.
+ */
+static inline int psp2LwRwLockTryLockRead(Psp2LwRwLock *rwlock)
+{
+	int32_t state, previous;
+
+	state = psp2AtomicLoad32(&rwlock->state);
+	while (PSP2_LW_RWLOCK_WRITERS(state) == 0) {
+		previous = psp2AtomicCompareAndSet32(&rwlock->state, state,
+			state + PSP2_LW_RWLOCK_READER);
+		if (previous == state)
+			return 0;
+		state = previous;
+	}
+
+	return SCE_KERNEL_ERROR_RW_LOCK_FAILED_TO_LOCK;
+}
+
+/**
+ * Locks a reader-writer lock for reading: spins while a writer holds or
+ * waits for it, then blocks until the writers are done.
+ *
+ * @param[in,out]	rwlock	The lock.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * <0	The error returned by the wait on the semaphore.
+ */
+static inline int psp2LwRwLockLockRead(Psp2LwRwLock *rwlock)
+{
+	int32_t state, previous;
+	uint32_t spin;
+	int ret;
+
+	if (psp2LwRwLockTryLockRead(rwlock) == 0)
+		return 0;
+
+	psp2AtomicGetAndAdd32(&rwlock->readContendedCount, 1);
+	for (spin = 0; spin < rwlock->spinCount; spin++)
+		if (psp2LwRwLockTryLockRead(rwlock) == 0)
+			return 0;
+
+	// Enter as a reader, or as a reader waiting for the writers.
+	previous = psp2AtomicLoad32(&rwlock->state);
+	do {
+		state = previous;
+		previous = psp2AtomicCompareAndSet32(&rwlock->state, state,
+			state + (PSP2_LW_RWLOCK_WRITERS(state) != 0 ?
+				PSP2_LW_RWLOCK_WAITING_READER : PSP2_LW_RWLOCK_READER));
+	} while (previous != state);
+
+	if (PSP2_LW_RWLOCK_WRITERS(state) != 0) {
+		psp2AtomicGetAndAdd32(&rwlock->readBlockCount, 1);
+		ret = sceKernelWaitSema(rwlock->readSema, 1, NULL);
+		if (ret < 0)
+			return ret;
+	}
+
+	return 0;
+}
+
+/**
+ * Unlocks a reader-writer lock locked for reading, and hands it over to a
+ * blocked writer if the calling thread is the last reader.
+ *
+ * @param[in,out]	rwlock	The lock.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * <0	The error returned by the signal of the semaphore.
+ */
+static inline int psp2LwRwLockUnlockRead(Psp2LwRwLock *rwlock)
+{
+	int32_t state;
+
+	state = psp2AtomicGetAndAdd32(&rwlock->state, -PSP2_LW_RWLOCK_READER);
+	if (PSP2_LW_RWLOCK_READERS(state) == 1
+		&& PSP2_LW_RWLOCK_WRITERS(state) != 0)
+		return sceKernelSignalSema(rwlock->writeSema, 1);
+
+	return 0;
+}
+
+/**
+ * Locks a reader-writer lock for writing if no thread holds or waits for it.
+ *
+ * @param[in,out]	rwlock	The lock.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_KERNEL_ERROR_RW_LOCK_FAILED_TO_LOCK	The lock is taken.
+ */
+static inline int psp2LwRwLockTryLockWrite(Psp2LwRwLock *rwlock)
+{
+	if (psp2AtomicCompareAndSet32(&rwlock->state, 0,
+		PSP2_LW_RWLOCK_WRITER) != 0)
+		return SCE_KERNEL_ERROR_RW_LOCK_FAILED_TO_LOCK;
+
+	rwlock->writeLockCount++;
+	return 0;
+}
+
+/**
+ * Locks a reader-writer lock for writing: spins while it is taken, then
+ * blocks until it is handed over.
+ *
+ * @param[in,out]	rwlock	The lock.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * <0	The error returned by the wait on the semaphore.
+ */
+static inline int psp2LwRwLockLockWrite(Psp2LwRwLock *rwlock)
+{
+	uint32_t spin, contended, blocked;
+	int32_t state;
+	int ret;
+
+	contended = 0;
+	blocked = 0;
+	if (psp2AtomicCompareAndSet32(&rwlock->state, 0,
+		PSP2_LW_RWLOCK_WRITER) != 0) {
+		contended = 1;
+		for (spin = 0; spin < rwlock->spinCount; spin++)
+			if (psp2AtomicLoad32(&rwlock->state) == 0
+				&& psp2AtomicCompareAndSet32(&rwlock->state, 0,
+					PSP2_LW_RWLOCK_WRITER) == 0)
+				break;
+
+		// Announce the writer; the last reader or writer out hands over.
+		if (spin == rwlock->spinCount) {
+			state = psp2AtomicGetAndAdd32(&rwlock->state,
+				PSP2_LW_RWLOCK_WRITER);
+			if (PSP2_LW_RWLOCK_READERS(state) != 0
+				|| PSP2_LW_RWLOCK_WRITERS(state) != 0) {
+				ret = sceKernelWaitSema(rwlock->writeSema, 1, NULL);
+				if (ret < 0)
+					return ret;
+				blocked = 1;
+			}
+		}
+	}
+
+	rwlock->writeLockCount++;
+	rwlock->writeContendedCount += contended;
+	rwlock->writeBlockCount += blocked;
+
+	return 0;
+}
+
+/**
+ * Unlocks a reader-writer lock locked for writing.  The readers that waited
+ * for the writer get the lock, or else the next writer if any.
+ *
+ * @param[in,out]	rwlock	The lock.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * <0	The error returned by the signal of a semaphore.
+ */
+static inline int psp2LwRwLockUnlockWrite(Psp2LwRwLock *rwlock)
+{
+	int32_t state, previous, waitingReaders;
+
+	previous = psp2AtomicLoad32(&rwlock->state);
+	do {
+		state = previous;
+		waitingReaders = PSP2_LW_RWLOCK_WAITING_READERS(state);
+		previous = psp2AtomicCompareAndSet32(&rwlock->state, state,
+			state - PSP2_LW_RWLOCK_WRITER
+			- waitingReaders * PSP2_LW_RWLOCK_WAITING_READER
+			+ waitingReaders * PSP2_LW_RWLOCK_READER);
+	} while (previous != state);
+
+	if (waitingReaders != 0)
+		return sceKernelSignalSema(rwlock->readSema, waitingReaders);
+	if (PSP2_LW_RWLOCK_WRITERS(state) > 1)
+		return sceKernelSignalSema(rwlock->writeSema, 1);
+
+	return 0;
+}
+
+/**
+ * Gets the state and the counters of a reader-writer lock.  The counters of
+ * the writers are only exact while the lock is held for writing by the
+ * calling thread.
+ *
+ * @param[in]		rwlock	The lock.
+ * @param[in,out]	info	The state.  Its size must be set.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_KERNEL_ERROR_ILLEGAL_SIZE	The size of the state is not valid.
+ */
+static inline int psp2LwRwLockGetInfo(Psp2LwRwLock *rwlock,
+	Psp2LwRwLockInfo *info)
+{
+	int32_t state;
+
+	if (info->size != sizeof(*info))
+		return SCE_KERNEL_ERROR_ILLEGAL_SIZE;
+
+	state = psp2AtomicLoad32(&rwlock->state);
+	__builtin_memcpy(info->name, rwlock->name, sizeof(info->name));
+	info->numReaders = PSP2_LW_RWLOCK_READERS(state);
+	info->numWaitReaders = PSP2_LW_RWLOCK_WAITING_READERS(state);
+	info->numWriters = PSP2_LW_RWLOCK_WRITERS(state);
+	info->spinCount = rwlock->spinCount;
+	info->readContendedCount = psp2AtomicLoad32(&rwlock->readContendedCount);
+	info->readBlockCount = psp2AtomicLoad32(&rwlock->readBlockCount);
+	info->writeLockCount = rwlock->writeLockCount;
+	info->writeContendedCount = rwlock->writeContendedCount;
+	info->writeBlockCount = rwlock->writeBlockCount;
+
+	return 0;
+}
+
+/**
+ * Creates a condition variable.
+ *
+ * @param[out]	cond	The condition variable.
+ * @param[in]	name	The name of its semaphore.
+ * @param[in]	mutex	The mutex that guards the condition.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * <0	The error returned by the creation of the semaphore.
+ */
+static inline int psp2LwCondCreate(Psp2LwCond *cond, const char *name,
+	Psp2LwMutex *mutex)
+{
+	int ret;
+
+	ret = sceKernelCreateSema(name, 0, 0, PSP2_LW_LOCK_SEMA_MAX, NULL);
+	if (ret < 0)
+		return ret;
+
+	cond->mutex = mutex;
+	cond->sema = ret;
+	cond->waitCount = 0;
+
+	return 0;
+}
+
+/**
+ * Deletes a condition variable.  No thread may wait for it.
+ */
+static inline int psp2LwCondDelete(Psp2LwCond *cond)
+{
+	return sceKernelDeleteSema(cond->sema);
+}
+
+/**
+ * Unlocks the mutex of a condition variable, waits until the variable is
+ * signaled, and locks the mutex again.  A thread that starts to wait after a
+ * signal may take the wakeup of a thread that waited before it, so the
+ * condition must be checked again in a loop.
+ *
+ * @param[in,out]	cond	The condition variable.  The calling thread must
+ * 							hold its mutex.
+ * @param[in,out]	timeout	The time to wait for in microseconds, updated with
+ * 							the time left, or NULL to wait for ever.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_KERNEL_ERROR_WAIT_TIMEOUT	The variable was not signaled in time.
+ * @retval
+ * <0	The error returned by the wait on the semaphore, or by the lock of the
+ * mutex, which the calling thread then does not hold.
+ */
+static inline int psp2LwCondWait(Psp2LwCond *cond, SceUInt *timeout)
+{
+	int ret, lockRet;
+
+	cond->waitCount++;
+	psp2LwMutexUnlock(cond->mutex);
+
+	ret = sceKernelWaitSema(cond->sema, 1, timeout);
+
+	lockRet = psp2LwMutexLock(cond->mutex);
+	if (lockRet < 0)
+		return lockRet;
+
+	if (ret < 0) {
+		// A signal may have counted the thread as woken before it gave up.
+		if (sceKernelPollSema(cond->sema, 1) == 0)
+			ret = 0;
+		else
+			cond->waitCount--;
+	}
+
+	return ret;
+}
+
+/**
+ * Wakes a thread waiting for a condition variable, if any.
+ *
+ * @param[in,out]	cond	The condition variable.  The calling thread must
+ * 							hold its mutex.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * <0	The error returned by the signal of the semaphore.
+ */
+static inline int psp2LwCondSignal(Psp2LwCond *cond)
+{
+	if (cond->waitCount == 0)
+		return 0;
+
+	cond->waitCount--;
+	return sceKernelSignalSema(cond->sema, 1);
+}
+
+/**
+ * Wakes all the threads waiting for a condition variable.
+ *
+ * @param[in,out]	cond	The condition variable.  The calling thread must
+ * 							hold its mutex.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * <0	The error returned by the signal of the semaphore.
+ */
+static inline int psp2LwCondSignalAll(Psp2LwCond *cond)
+{
+	int32_t count;
+
+	count = cond->waitCount;
+	if (count == 0)
+		return 0;
+
+	cond->waitCount = 0;
+	return sceKernelSignalSema(cond->sema, count);
+}
+
+#ifdef	__cplusplus
+}
+#endif	// def __cplusplus
+
+#endif /* _PSP2_LW_LOCK_H_ */
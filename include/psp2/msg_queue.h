@@ -0,0 +1,656 @@
+/**
+ * \file msg_queue.h
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+
+#ifndef _PSP2_MSG_QUEUE_H_
+#define _PSP2_MSG_QUEUE_H_
+
+/**
+ * @file
+ *
+ * Bounded lock-free message queues, in place of the message pipes of
+ * psp2/kernel/threadmgr.h.
+ *
+ * A message pipe enters the kernel and copies the message for every send and
+ * receive.  These queues copy the message once, into a slot of a ring in
+ * user memory, and only enter the kernel to block on an event flag when a
+ * queue is full for a sender or empty for a receiver, and to wake a thread
+ * that blocks.
+ *
+ * #Psp2MsgQueue takes any number of senders and receivers; it is the queue of
+ * Dmitry Vyukov, where each slot has a sequence number that tells whether it
+ * is free for the sender of a lap or full for the receiver of a lap.
+ * #Psp2SpscQueue takes a single sender and a single receiver and only shares
+ * its two indices.
+ *
+ * The calls take the arguments of their message pipe counterparts, without
+ * the unknown ones:
+ *
+ * @code
+ * 	sceKernelSendMsgPipe(pipe, &command, sizeof(command), 0, NULL, NULL);
+ * 	psp2MsgQueueSend(&queue, &command, sizeof(command), NULL);
+ *
+ * 	sceKernelTryReceiveMsgPipe(pipe, &command, sizeof(command), 0, NULL);
+ * 	psp2MsgQueueTryReceive(&queue, &command, sizeof(command), NULL);
+ * @endcode
+ *
+ * A queue stores messages of up to a fixed size.  A receive takes a buffer of
+ * any size, copies as much of the message sent as fits, and returns the size
+ * it copied.
+ */
+#include <psp2/kernel/atomic.h>
+#include <psp2/kernel/error.h>
+#include <psp2/kernel/threadmgr.h>
+
+#ifdef	__cplusplus
+extern "C" {
+#endif	// def __cplusplus
+
+/** The size of a cache line, which the indices shared between threads do not share */
+#define PSP2_MSG_QUEUE_CACHE_LINE_SIZE	32
+
+/** The bit of the event flag set when a queue is no longer empty */
+#define PSP2_MSG_QUEUE_NOT_EMPTY		0x1
+/** The bit of the event flag set when a queue is no longer full */
+#define PSP2_MSG_QUEUE_NOT_FULL			0x2
+
+/** The size of a slot of a queue whose messages are of up to a size */
+#define PSP2_MSG_QUEUE_SLOT_SIZE(messageSize)	\
+	((8 + (messageSize) + 3) & ~3)
+
+/** The size of the buffer of a queue of a number of messages of up to a size */
+#define PSP2_MSG_QUEUE_BUFFER_SIZE(messageCount, messageSize)	\
+	((messageCount) * PSP2_MSG_QUEUE_SLOT_SIZE(messageSize))
+
+/**
+ * The event flag of a queue, and the number of threads that are about to
+ * block on each of its bits.
+ */
+typedef struct Psp2MsgQueueSync {
+	SceUID eventFlag;
+	volatile int32_t sendWaitCount;		//!< The number of senders waiting for a free slot.
+	volatile int32_t receiveWaitCount;	//!< The number of receivers waiting for a message.
+} Psp2MsgQueueSync;
+
+/**
+ * A slot of a queue.
+ */
+typedef struct Psp2MsgQueueSlot {
+	volatile int32_t sequence;			//!< For #Psp2MsgQueue, the lap of the slot.
+	uint32_t size;						//!< The size of the message.
+	char message[];
+} Psp2MsgQueueSlot;
+
+/**
+ * A queue with many senders and many receivers.
+ */
+typedef struct Psp2MsgQueue {
+	volatile int32_t sendIndex			//!< The index of the next message to send.
+		__attribute__((aligned(PSP2_MSG_QUEUE_CACHE_LINE_SIZE)));
+	volatile int32_t receiveIndex		//!< The index of the next message to receive.
+		__attribute__((aligned(PSP2_MSG_QUEUE_CACHE_LINE_SIZE)));
+	char *slots							//!< The buffer.
+		__attribute__((aligned(PSP2_MSG_QUEUE_CACHE_LINE_SIZE)));
+	uint32_t mask;						//!< The number of slots minus one.
+	uint32_t slotSize;
+	uint32_t messageSize;				//!< The maximum size of a message.
+	Psp2MsgQueueSync sync;
+} Psp2MsgQueue;
+
+/**
+ * A queue with a single sender and a single receiver.
+ */
+typedef struct Psp2SpscQueue {
+	volatile int32_t sendIndex			//!< The index of the next message to send.
+		__attribute__((aligned(PSP2_MSG_QUEUE_CACHE_LINE_SIZE)));
+	volatile int32_t receiveIndex		//!< The index of the next message to receive.
+		__attribute__((aligned(PSP2_MSG_QUEUE_CACHE_LINE_SIZE)));
+	char *slots							//!< The buffer.
+		__attribute__((aligned(PSP2_MSG_QUEUE_CACHE_LINE_SIZE)));
+	uint32_t mask;						//!< The number of slots minus one.
+	uint32_t slotSize;
+	uint32_t messageSize;				//!< The maximum size of a message.
+	Psp2MsgQueueSync sync;
+} Psp2SpscQueue;
+
+static inline Psp2MsgQueueSlot *psp2MsgQueueSlot(char *slots,
+	uint32_t slotSize, uint32_t index)
+{
+	return (Psp2MsgQueueSlot *)(slots + index * slotSize);
+}
+
+static inline int psp2MsgQueueSyncInit(Psp2MsgQueueSync *sync,
+	const char *name)
+{
+	int ret;
+
+	ret = sceKernelCreateEventFlag(name, PSP2_EVENT_WAITMULTIPLE, 0, NULL);
+	if (ret < 0)
+		return ret;
+
+	sync->eventFlag = ret;
+	sync->sendWaitCount = 0;
+	sync->receiveWaitCount = 0;
+
+	return 0;
+}
+
+/*
+ * Wake a thread waiting for a bit, if any.  The waiters announce themselves
+ * before they look at the queue for the last time, and the wakers look for
+ * them after they change the queue, so that no wakeup is lost.
+ */
+static inline void psp2MsgQueueSyncWake(Psp2MsgQueueSync *sync,
+	volatile int32_t *waitCount, uint32_t bit)
+{
+	if (psp2AtomicLoad32(waitCount) != 0)
+		sceKernelSetEventFlag(sync->eventFlag, bit);
+}
+
+/*
+ * Announce a waiter for a bit.  The caller then tries again before it blocks:
+ * either the waker sees the waiter, or the waiter sees the change of the
+ * waker.
+ */
+static inline void psp2MsgQueueSyncEnter(volatile int32_t *waitCount)
+{
+	psp2AtomicGetAndAdd32(waitCount, 1);
+}
+
+static inline void psp2MsgQueueSyncLeave(volatile int32_t *waitCount)
+{
+	psp2AtomicGetAndAdd32(waitCount, -1);
+}
+
+/*
+ * Block until a bit is set.  The bit is cleared by the waiter it wakes, so a
+ * sender or a receiver that succeeds after waking passes the bit on while
+ * there are messages or free slots left and threads waiting for them.
+ */
+static inline int psp2MsgQueueSyncWait(Psp2MsgQueueSync *sync, uint32_t bit,
+	unsigned int *timeout)
+{
+	return sceKernelWaitEventFlag(sync->eventFlag, bit,
+		PSP2_EVENT_WAITOR | PSP2_EVENT_WAITCLEAR, NULL, timeout);
+}
+
+/**
+ * Creates a queue with many senders and many receivers.
+ *
+ * @param[out]	queue			The queue.
+ * @param[in]	name			The name of its event flag.
+ * @param[in]	buffer			The buffer of the queue, of
+ * 								#PSP2_MSG_QUEUE_BUFFER_SIZE() bytes, aligned
+ * 								to 4 bytes.  It must persist until the queue
+ * 								is deleted.
+ * @param[in]	messageCount	The number of messages the queue holds, a
+ * 								power of two.
+ * @param[in]	messageSize		The maximum size of a message.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_KERNEL_ERROR_ILLEGAL_SIZE	The number of messages is not a power of
+ * two.
+ * @retval
+ * <0	The error returned by the creation of the event flag.
+ */
+static inline int psp2MsgQueueCreate(Psp2MsgQueue *queue, const char *name,
+	void *buffer, uint32_t messageCount, uint32_t messageSize)
+{
+	uint32_t i;
+
+	if (messageCount == 0 || (messageCount & (messageCount - 1)) != 0)
+		return SCE_KERNEL_ERROR_ILLEGAL_SIZE;
+
+	queue->sendIndex = 0;
+	queue->receiveIndex = 0;
+	queue->slots = (char *)buffer;
+	queue->mask = messageCount - 1;
+	queue->slotSize = PSP2_MSG_QUEUE_SLOT_SIZE(messageSize);
+	queue->messageSize = messageSize;
+
+	for (i = 0; i < messageCount; i++)
+		psp2MsgQueueSlot(queue->slots, queue->slotSize, i)->sequence = i;
+
+	return psp2MsgQueueSyncInit(&queue->sync, name);
+}
+
+/**
+ * Deletes a queue.  The threads blocked on it return
+ * SCE_KERNEL_ERROR_WAIT_DELETE.
+ *
+ * @param[in,out]	queue	The queue.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * <0	The error returned by the deletion of the event flag.
+ */
+static inline int psp2MsgQueueDelete(Psp2MsgQueue *queue)
+{
+	return sceKernelDeleteEventFlag(queue->sync.eventFlag);
+}
+
+/**
+ * Sends a message to a queue, or fails if it is full.
+ *
+ * @param[in,out]	queue	The queue.
+ * @param[in]		message	The message.
+ * @param[in]		size	The size of the message.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_KERNEL_ERROR_ILLEGAL_SIZE	The message is too large.
+ * @retval
+ * SCE_KERNEL_ERROR_MSG_PIPE_FULL	The queue is full.
+ */
+static inline int psp2MsgQueueTrySend(Psp2MsgQueue *queue,
+	const void *message, unsigned int size)
+{
+	Psp2MsgQueueSlot *slot;
+	int32_t index, previous, lap;
+
+	if (size > queue->messageSize)
+		return SCE_KERNEL_ERROR_ILLEGAL_SIZE;
+
+	index = psp2AtomicLoad32(&queue->sendIndex);
+	for (;;) {
+		slot = psp2MsgQueueSlot(queue->slots, queue->slotSize,
+			index & queue->mask);
+		lap = psp2AtomicLoad32(&slot->sequence) - index;
+		if (lap == 0) {
+			previous = psp2AtomicCompareAndSet32(&queue->sendIndex,
+				index, index + 1);
+			if (previous == index)
+				break;
+			index = previous;
+		} else if (lap < 0) {
+			return SCE_KERNEL_ERROR_MSG_PIPE_FULL;
+		} else {
+			index = psp2AtomicLoad32(&queue->sendIndex);
+		}
+	}
+
+	__builtin_memcpy(slot->message, message, size);
+	slot->size = size;
+	psp2AtomicStore32(&slot->sequence, index + 1);
+
+	psp2MsgQueueSyncWake(&queue->sync, &queue->sync.receiveWaitCount,
+		PSP2_MSG_QUEUE_NOT_EMPTY);
+
+	return 0;
+}
+
+/**
+ * Receives a message from a queue, or fails if it is empty.
+ *
+ * @param[in,out]	queue	The queue.
+ * @param[out]		message	The message.
+ * @param[in]		size	The size of the message buffer.  At most the size
+ * 							of the message sent is copied.
+ * @param[out]		received	The size copied, or NULL.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_KERNEL_ERROR_MSG_PIPE_EMPTY	The queue is empty.
+ */
+static inline int psp2MsgQueueTryReceive(Psp2MsgQueue *queue, void *message,
+	unsigned int size, unsigned int *received)
+{
+	Psp2MsgQueueSlot *slot;
+	int32_t index, previous, lap;
+
+	index = psp2AtomicLoad32(&queue->receiveIndex);
+	for (;;) {
+		slot = psp2MsgQueueSlot(queue->slots, queue->slotSize,
+			index & queue->mask);
+		lap = psp2AtomicLoad32(&slot->sequence) - (index + 1);
+		if (lap == 0) {
+			previous = psp2AtomicCompareAndSet32(&queue->receiveIndex,
+				index, index + 1);
+			if (previous == index)
+				break;
+			index = previous;
+		} else if (lap < 0) {
+			return SCE_KERNEL_ERROR_MSG_PIPE_EMPTY;
+		} else {
+			index = psp2AtomicLoad32(&queue->receiveIndex);
+		}
+	}
+
+	if (size > slot->size)
+		size = slot->size;
+	__builtin_memcpy(message, slot->message, size);
+	if (received != NULL)
+		*received = size;
+	psp2AtomicStore32(&slot->sequence, index + queue->mask + 1);
+
+	psp2MsgQueueSyncWake(&queue->sync, &queue->sync.sendWaitCount,
+		PSP2_MSG_QUEUE_NOT_FULL);
+
+	return 0;
+}
+
+/**
+ * Sends a message to a queue, and blocks while it is full.
+ *
+ * @param[in,out]	queue	The queue.
+ * @param[in]		message	The message.
+ * @param[in]		size	The size of the message.
+ * @param[in,out]	timeout	The time to block for in microseconds, updated
+ * 							with the time left, or NULL to block for ever.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_KERNEL_ERROR_ILLEGAL_SIZE	The message is too large.
+ * @retval
+ * SCE_KERNEL_ERROR_WAIT_TIMEOUT	The queue stayed full.
+ * @retval
+ * SCE_KERNEL_ERROR_WAIT_DELETE	The queue was deleted.
+ */
+static inline int psp2MsgQueueSend(Psp2MsgQueue *queue, const void *message,
+	unsigned int size, unsigned int *timeout)
+{
+	int ret;
+
+	for (;;) {
+		ret = psp2MsgQueueTrySend(queue, message, size);
+		if (ret != (int)SCE_KERNEL_ERROR_MSG_PIPE_FULL)
+			break;
+
+		psp2MsgQueueSyncEnter(&queue->sync.sendWaitCount);
+		ret = psp2MsgQueueTrySend(queue, message, size);
+		if (ret == (int)SCE_KERNEL_ERROR_MSG_PIPE_FULL) {
+			ret = psp2MsgQueueSyncWait(&queue->sync, PSP2_MSG_QUEUE_NOT_FULL,
+				timeout);
+			if (ret == 0)
+				ret = SCE_KERNEL_ERROR_MSG_PIPE_FULL;
+		}
+		psp2MsgQueueSyncLeave(&queue->sync.sendWaitCount);
+
+		if (ret != (int)SCE_KERNEL_ERROR_MSG_PIPE_FULL)
+			break;
+	}
+
+	if (ret == 0 && psp2AtomicLoad32(&queue->sendIndex)
+		- psp2AtomicLoad32(&queue->receiveIndex) <= (int32_t)queue->mask)
+		psp2MsgQueueSyncWake(&queue->sync, &queue->sync.sendWaitCount,
+			PSP2_MSG_QUEUE_NOT_FULL);
+
+	return ret;
+}
+
+/**
+ * Receives a message from a queue, and blocks while it is empty.
+ *
+ * @param[in,out]	queue	The queue.
+ * @param[out]		message	The message.
+ * @param[in]		size	The size of the message buffer.  At most the size
+ * 							of the message sent is copied.
+ * @param[out]		received	The size copied, or NULL.
+ * @param[in,out]	timeout	The time to block for in microseconds, updated
+ * 							with the time left, or NULL to block for ever.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_KERNEL_ERROR_WAIT_TIMEOUT	The queue stayed empty.
+ * @retval
+ * SCE_KERNEL_ERROR_WAIT_DELETE	The queue was deleted.
+ */
+static inline int psp2MsgQueueReceive(Psp2MsgQueue *queue, void *message,
+	unsigned int size, unsigned int *received, unsigned int *timeout)
+{
+	int ret;
+
+	for (;;) {
+		ret = psp2MsgQueueTryReceive(queue, message, size, received);
+		if (ret != (int)SCE_KERNEL_ERROR_MSG_PIPE_EMPTY)
+			break;
+
+		psp2MsgQueueSyncEnter(&queue->sync.receiveWaitCount);
+		ret = psp2MsgQueueTryReceive(queue, message, size, received);
+		if (ret == (int)SCE_KERNEL_ERROR_MSG_PIPE_EMPTY) {
+			ret = psp2MsgQueueSyncWait(&queue->sync, PSP2_MSG_QUEUE_NOT_EMPTY,
+				timeout);
+			if (ret == 0)
+				ret = SCE_KERNEL_ERROR_MSG_PIPE_EMPTY;
+		}
+		psp2MsgQueueSyncLeave(&queue->sync.receiveWaitCount);
+
+		if (ret != (int)SCE_KERNEL_ERROR_MSG_PIPE_EMPTY)
+			break;
+	}
+
+	if (ret == 0 && psp2AtomicLoad32(&queue->sendIndex)
+		!= psp2AtomicLoad32(&queue->receiveIndex))
+		psp2MsgQueueSyncWake(&queue->sync, &queue->sync.receiveWaitCount,
+			PSP2_MSG_QUEUE_NOT_EMPTY);
+
+	return ret;
+}
+
+/**
+ * Creates a queue with a single sender and a single receiver.
+ *
+ * @param[out]	queue			The queue.
+ * @param[in]	name			The name of its event flag.
+ * @param[in]	buffer			The buffer of the queue, of
+ * 								#PSP2_MSG_QUEUE_BUFFER_SIZE() bytes, aligned
+ * 								to 4 bytes.  It must persist until the queue
+ * 								is deleted.
+ * @param[in]	messageCount	The number of messages the queue holds, a
+ * 								power of two.
+ * @param[in]	messageSize		The maximum size of a message.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_KERNEL_ERROR_ILLEGAL_SIZE	The number of messages is not a power of
+ * two.
+ * @retval
+ * <0	The error returned by the creation of the event flag.
+ */
+static inline int psp2SpscQueueCreate(Psp2SpscQueue *queue, const char *name,
+	void *buffer, uint32_t messageCount, uint32_t messageSize)
+{
+	if (messageCount == 0 || (messageCount & (messageCount - 1)) != 0)
+		return SCE_KERNEL_ERROR_ILLEGAL_SIZE;
+
+	queue->sendIndex = 0;
+	queue->receiveIndex = 0;
+	queue->slots = (char *)buffer;
+	queue->mask = messageCount - 1;
+	queue->slotSize = PSP2_MSG_QUEUE_SLOT_SIZE(messageSize);
+	queue->messageSize = messageSize;
+
+	return psp2MsgQueueSyncInit(&queue->sync, name);
+}
+
+/**
+ * Deletes a queue.  The threads blocked on it return
+ * SCE_KERNEL_ERROR_WAIT_DELETE.
+ */
+static inline int psp2SpscQueueDelete(Psp2SpscQueue *queue)
+{
+	return sceKernelDeleteEventFlag(queue->sync.eventFlag);
+}
+
+/**
+ * Sends a message to a queue, or fails if it is full.  Only the sender may
+ * call it.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_KERNEL_ERROR_ILLEGAL_SIZE	The message is too large.
+ * @retval
+ * SCE_KERNEL_ERROR_MSG_PIPE_FULL	The queue is full.
+ */
+static inline int psp2SpscQueueTrySend(Psp2SpscQueue *queue,
+	const void *message, unsigned int size)
+{
+	Psp2MsgQueueSlot *slot;
+	int32_t index;
+
+	if (size > queue->messageSize)
+		return SCE_KERNEL_ERROR_ILLEGAL_SIZE;
+
+	index = queue->sendIndex;
+	if (index - psp2AtomicLoad32(&queue->receiveIndex) > (int32_t)queue->mask)
+		return SCE_KERNEL_ERROR_MSG_PIPE_FULL;
+
+	slot = psp2MsgQueueSlot(queue->slots, queue->slotSize,
+		index & queue->mask);
+	__builtin_memcpy(slot->message, message, size);
+	slot->size = size;
+	psp2AtomicStore32(&queue->sendIndex, index + 1);
+
+	psp2MsgQueueSyncWake(&queue->sync, &queue->sync.receiveWaitCount,
+		PSP2_MSG_QUEUE_NOT_EMPTY);
+
+	return 0;
+}
+
+/**
+ * Receives a message from a queue, or fails if it is empty.  Only the
+ * receiver may call it.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_KERNEL_ERROR_MSG_PIPE_EMPTY	The queue is empty.
+ */
+static inline int psp2SpscQueueTryReceive(Psp2SpscQueue *queue, void *message,
+	unsigned int size, unsigned int *received)
+{
+	Psp2MsgQueueSlot *slot;
+	int32_t index;
+
+	index = queue->receiveIndex;
+	if (psp2AtomicLoad32(&queue->sendIndex) == index)
+		return SCE_KERNEL_ERROR_MSG_PIPE_EMPTY;
+
+	slot = psp2MsgQueueSlot(queue->slots, queue->slotSize,
+		index & queue->mask);
+	if (size > slot->size)
+		size = slot->size;
+	__builtin_memcpy(message, slot->message, size);
+	if (received != NULL)
+		*received = size;
+	psp2AtomicStore32(&queue->receiveIndex, index + 1);
+
+	psp2MsgQueueSyncWake(&queue->sync, &queue->sync.sendWaitCount,
+		PSP2_MSG_QUEUE_NOT_FULL);
+
+	return 0;
+}
+
+/**
+ * Sends a message to a queue, and blocks while it is full.  Only the sender
+ * may call it.
+ *
+ * @param[in,out]	queue	The queue.
+ * @param[in]		message	The message.
+ * @param[in]		size	The size of the message.
+ * @param[in,out]	timeout	The time to block for in microseconds, updated
+ * 							with the time left, or NULL to block for ever.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_KERNEL_ERROR_ILLEGAL_SIZE	The message is too large.
+ * @retval
+ * SCE_KERNEL_ERROR_WAIT_TIMEOUT	The queue stayed full.
+ * @retval
+ * SCE_KERNEL_ERROR_WAIT_DELETE	The queue was deleted.
+ */
+static inline int psp2SpscQueueSend(Psp2SpscQueue *queue, const void *message,
+	unsigned int size, unsigned int *timeout)
+{
+	int ret;
+
+	for (;;) {
+		ret = psp2SpscQueueTrySend(queue, message, size);
+		if (ret != (int)SCE_KERNEL_ERROR_MSG_PIPE_FULL)
+			break;
+
+		psp2MsgQueueSyncEnter(&queue->sync.sendWaitCount);
+		ret = psp2SpscQueueTrySend(queue, message, size);
+		if (ret == (int)SCE_KERNEL_ERROR_MSG_PIPE_FULL) {
+			ret = psp2MsgQueueSyncWait(&queue->sync, PSP2_MSG_QUEUE_NOT_FULL,
+				timeout);
+			if (ret == 0)
+				ret = SCE_KERNEL_ERROR_MSG_PIPE_FULL;
+		}
+		psp2MsgQueueSyncLeave(&queue->sync.sendWaitCount);
+
+		if (ret != (int)SCE_KERNEL_ERROR_MSG_PIPE_FULL)
+			break;
+	}
+
+	return ret;
+}
+
+/**
+ * Receives a message from a queue, and blocks while it is empty.  Only the
+ * receiver may call it.
+ *
+ * @param[in,out]	queue	The queue.
+ * @param[out]		message	The message.
+ * @param[in]		size	The size of the message buffer.  At most the size
+ * 							of the message sent is copied.
+ * @param[out]		received	The size copied, or NULL.
+ * @param[in,out]	timeout	The time to block for in microseconds, updated
+ * 							with the time left, or NULL to block for ever.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_KERNEL_ERROR_WAIT_TIMEOUT	The queue stayed empty.
+ * @retval
+ * SCE_KERNEL_ERROR_WAIT_DELETE	The queue was deleted.
+ */
+static inline int psp2SpscQueueReceive(Psp2SpscQueue *queue, void *message,
+	unsigned int size, unsigned int *received, unsigned int *timeout)
+{
+	int ret;
+
+	for (;;) {
+		ret = psp2SpscQueueTryReceive(queue, message, size, received);
+		if (ret != (int)SCE_KERNEL_ERROR_MSG_PIPE_EMPTY)
+			break;
+
+		psp2MsgQueueSyncEnter(&queue->sync.receiveWaitCount);
+		ret = psp2SpscQueueTryReceive(queue, message, size, received);
+		if (ret == (int)SCE_KERNEL_ERROR_MSG_PIPE_EMPTY) {
+			ret = psp2MsgQueueSyncWait(&queue->sync, PSP2_MSG_QUEUE_NOT_EMPTY,
+				timeout);
+			if (ret == 0)
+				ret = SCE_KERNEL_ERROR_MSG_PIPE_EMPTY;
+		}
+		psp2MsgQueueSyncLeave(&queue->sync.receiveWaitCount);
+
+		if (ret != (int)SCE_KERNEL_ERROR_MSG_PIPE_EMPTY)
+			break;
+	}
+
+	return ret;
+}
+
+#ifdef	__cplusplus
+}
+#endif	// def __cplusplus
+
+#endif /* _PSP2_MSG_QUEUE_H_ */
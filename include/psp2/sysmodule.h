@@ -19,7 +19,7 @@ extern "C" {
 #endif
 
 enum {
-	SCE_SYSMODULE_LOADED				= 0
+	SCE_SYSMODULE_LOADED				= 0,
 	SCE_SYSMODULE_ERROR_INVALID_VALUE	= 0x805A1000,
 	SCE_SYSMODULE_ERROR_UNLOADED		= 0x805A1001,
 	SCE_SYSMODULE_ERROR_FATAL			= 0x805A10FF,
@@ -0,0 +1,827 @@
+/**
+ * \file ult.h
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+
+#ifndef _PSP2_ULT_H_
+#define _PSP2_ULT_H_
+
+/**
+ * @file
+ *
+ * The user-level thread library, SceUlt.
+ *
+ * A user-level thread, or ULT, is a thread scheduled by the library on the
+ * worker threads of a runtime rather than by the kernel.  A ULT that blocks
+ * on a ULT synchronization object, or joins another ULT, lets its worker
+ * thread run other ULTs, so that many ULTs run on a few kernel threads.
+ *
+ * The library allocates nothing: each object lives in memory of the caller,
+ * and the runtime and the resource pools take a work area whose size is
+ * given by the matching GetWorkAreaSize function.  The synchronization
+ * objects take their waiting queues from a waiting queue resource pool, and
+ * the queues take their data from a queue data resource pool.
+ *
+ * #psp2UltRuntimeInit() creates a runtime and a waiting queue resource pool
+ * in one memory block.
+ */
+#include <psp2/types.h>
+#include <psp2/kernel/error.h>
+#include <psp2/kernel/sysmem/memblock.h>
+
+#ifdef	__cplusplus
+extern "C" {
+#endif	// def __cplusplus
+
+/** A pointer is NULL */
+#define SCE_ULT_ERROR_NULL			0x80418001
+/** An address is not aligned */
+#define SCE_ULT_ERROR_ALIGNMENT		0x80418002
+/** A value is out of range */
+#define SCE_ULT_ERROR_RANGE			0x80418003
+/** An argument is not valid */
+#define SCE_ULT_ERROR_INVALID		0x80418004
+/** The operation is not permitted from the caller */
+#define SCE_ULT_ERROR_PERMISSION	0x80418005
+/** The object is not in a state the operation permits */
+#define SCE_ULT_ERROR_STATE			0x80418006
+/** The object is in use */
+#define SCE_ULT_ERROR_BUSY			0x80418007
+/** The operation would block */
+#define SCE_ULT_ERROR_AGAIN			0x80418008
+/** A fatal error */
+#define SCE_ULT_ERROR_FATAL			0x80418009
+
+/** The maximum length of the name of an object, the terminator excluded */
+#define SCE_ULT_MAX_NAME_LENGTH		31
+
+/** The alignment of the objects, of the work areas and of the contexts */
+#define SCE_ULT_ALIGNMENT			8
+
+/** The alignment of the memory block of #psp2UltRuntimeInit() */
+#define PSP2_ULT_MEMBLOCK_ALIGNMENT	0x1000
+
+/** The header of the options of the objects */
+typedef struct SceUltOptParamHeader {
+	SceInt64 reserved[2];
+} SceUltOptParamHeader;
+
+/** The options of a waiting queue resource pool */
+typedef struct SceUltWaitingQueueResourcePoolOptParam {
+	SceUltOptParamHeader header;
+	SceUInt32 reserved[28];
+} SceUltWaitingQueueResourcePoolOptParam;
+
+/** A waiting queue resource pool */
+typedef struct SceUltWaitingQueueResourcePool {
+	SceUInt64 reserved[32];
+} SceUltWaitingQueueResourcePool;
+
+/** The options of a queue data resource pool */
+typedef struct SceUltQueueDataResourcePoolOptParam {
+	SceUltOptParamHeader header;
+	SceUInt32 reserved[28];
+} SceUltQueueDataResourcePoolOptParam;
+
+/** A queue data resource pool */
+typedef struct SceUltQueueDataResourcePool {
+	SceUInt64 reserved[32];
+} SceUltQueueDataResourcePool;
+
+/** The options of a queue */
+typedef struct SceUltQueueOptParam {
+	SceUltOptParamHeader header;
+	SceUInt32 reserved[28];
+} SceUltQueueOptParam;
+
+/** A queue */
+typedef struct SceUltQueue {
+	SceUInt64 reserved[32];
+} SceUltQueue;
+
+/** The options of a mutex */
+typedef struct SceUltMutexOptParam {
+	SceUltOptParamHeader header;
+	SceUInt32 attribute;
+	SceUInt32 reserved[27];
+} SceUltMutexOptParam;
+
+/** A mutex */
+typedef struct SceUltMutex {
+	SceUInt64 reserved[32];
+} SceUltMutex;
+
+/** The options of a condition variable */
+typedef struct SceUltConditionVariableOptParam {
+	SceUltOptParamHeader header;
+	SceUInt32 reserved[28];
+} SceUltConditionVariableOptParam;
+
+/** A condition variable */
+typedef struct SceUltConditionVariable {
+	SceUInt64 reserved[32];
+} SceUltConditionVariable;
+
+/** The options of a reader-writer lock */
+typedef struct SceUltReaderWriterLockOptParam {
+	SceUltOptParamHeader header;
+	SceUInt32 reserved[28];
+} SceUltReaderWriterLockOptParam;
+
+/** A reader-writer lock */
+typedef struct SceUltReaderWriterLock {
+	SceUInt64 reserved[32];
+} SceUltReaderWriterLock;
+
+/** The options of a semaphore */
+typedef struct SceUltSemaphoreOptParam {
+	SceUltOptParamHeader header;
+	SceUInt32 reserved[28];
+} SceUltSemaphoreOptParam;
+
+/** A semaphore */
+typedef struct SceUltSemaphore {
+	SceUInt64 reserved[32];
+} SceUltSemaphore;
+
+/** The options of a runtime */
+typedef struct SceUltUlthreadRuntimeOptParam {
+	SceUltOptParamHeader header;
+	SceUInt32 reserved[28];
+} SceUltUlthreadRuntimeOptParam;
+
+/** A runtime */
+typedef struct SceUltUlthreadRuntime {
+	SceUInt64 reserved[128];
+} SceUltUlthreadRuntime;
+
+/** The options of a ULT */
+typedef struct SceUltUlthreadOptParam {
+	SceUltOptParamHeader header;
+	SceUInt32 attribute;
+	SceUInt32 reserved[27];
+} SceUltUlthreadOptParam;
+
+/** A ULT */
+typedef struct SceUltUlthread {
+	SceUInt64 reserved[32];
+} SceUltUlthread;
+
+/**
+ * The entry of a ULT.
+ *
+ * @param[in]	arg	The argument given on creation.
+ *
+ * @return
+ * The exit status of the ULT.
+ */
+typedef SceInt32 (*SceUltUlthreadEntry)(SceUInt32 arg);
+
+/* Waiting queue resource pools */
+
+SceInt32 _sceUltWaitingQueueResourcePoolOptParamInitialize(
+	SceUltWaitingQueueResourcePoolOptParam *optParam);
+
+/**
+ * Gets the size of the work area of a waiting queue resource pool.
+ *
+ * @param[in]	numThreads		The number of threads and ULTs that may wait
+ * 								at once.
+ * @param[in]	numSyncObjects	The number of synchronization objects.
+ *
+ * @return
+ * The size.
+ */
+SceUInt32 sceUltWaitingQueueResourcePoolGetWorkAreaSize(SceUInt32 numThreads,
+	SceUInt32 numSyncObjects);
+
+SceInt32 _sceUltWaitingQueueResourcePoolCreate(
+	SceUltWaitingQueueResourcePool *pool, const char *name,
+	SceUInt32 numThreads, SceUInt32 numSyncObjects, void *workArea,
+	const SceUltWaitingQueueResourcePoolOptParam *optParam);
+
+SceInt32 sceUltWaitingQueueResourcePoolDestroy(
+	SceUltWaitingQueueResourcePool *pool);
+
+static inline SceInt32 sceUltWaitingQueueResourcePoolOptParamInitialize(
+	SceUltWaitingQueueResourcePoolOptParam *optParam)
+{
+	return _sceUltWaitingQueueResourcePoolOptParamInitialize(optParam);
+}
+
+/**
+ * Creates a waiting queue resource pool.
+ *
+ * @param[out]	pool			The pool.
+ * @param[in]	name			The name of the pool.
+ * @param[in]	numThreads		The number of threads and ULTs that may wait
+ * 								at once.
+ * @param[in]	numSyncObjects	The number of synchronization objects.
+ * @param[in]	workArea		The work area, of the size given by
+ * 								#sceUltWaitingQueueResourcePoolGetWorkAreaSize().
+ * 								It must persist until the pool is destroyed.
+ * @param[in]	optParam		The options, or NULL.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * <0	An SCE_ULT_ERROR code.
+ */
+static inline SceInt32 sceUltWaitingQueueResourcePoolCreate(
+	SceUltWaitingQueueResourcePool *pool, const char *name,
+	SceUInt32 numThreads, SceUInt32 numSyncObjects, void *workArea,
+	const SceUltWaitingQueueResourcePoolOptParam *optParam)
+{
+	return _sceUltWaitingQueueResourcePoolCreate(pool, name, numThreads,
+		numSyncObjects, workArea, optParam);
+}
+
+/* Queue data resource pools */
+
+SceInt32 _sceUltQueueDataResourcePoolOptParamInitialize(
+	SceUltQueueDataResourcePoolOptParam *optParam);
+
+/**
+ * Gets the size of the work area of a queue data resource pool.
+ *
+ * @param[in]	numData				The number of data the queues hold at once.
+ * @param[in]	dataSize			The size of a datum.
+ * @param[in]	numQueueObjects		The number of queues.
+ *
+ * @return
+ * The size.
+ */
+SceUInt32 sceUltQueueDataResourcePoolGetWorkAreaSize(SceUInt32 numData,
+	SceSize dataSize, SceUInt32 numQueueObjects);
+
+SceInt32 _sceUltQueueDataResourcePoolCreate(SceUltQueueDataResourcePool *pool,
+	const char *name, SceUInt32 numData, SceSize dataSize,
+	SceUInt32 numQueueObjects,
+	SceUltWaitingQueueResourcePool *waitingQueueResourcePool,
+	void *workArea, const SceUltQueueDataResourcePoolOptParam *optParam);
+
+SceInt32 sceUltQueueDataResourcePoolDestroy(SceUltQueueDataResourcePool *pool);
+
+static inline SceInt32 sceUltQueueDataResourcePoolOptParamInitialize(
+	SceUltQueueDataResourcePoolOptParam *optParam)
+{
+	return _sceUltQueueDataResourcePoolOptParamInitialize(optParam);
+}
+
+/**
+ * Creates a queue data resource pool.
+ *
+ * @param[out]	pool						The pool.
+ * @param[in]	name						The name of the pool.
+ * @param[in]	numData						The number of data the queues
+ * 											hold at once.
+ * @param[in]	dataSize					The size of a datum.
+ * @param[in]	numQueueObjects				The number of queues.
+ * @param[in]	waitingQueueResourcePool	The pool of the waiting queues of
+ * 											the queues.
+ * @param[in]	workArea					The work area, of the size given by
+ * 											#sceUltQueueDataResourcePoolGetWorkAreaSize().
+ * @param[in]	optParam					The options, or NULL.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * <0	An SCE_ULT_ERROR code.
+ */
+static inline SceInt32 sceUltQueueDataResourcePoolCreate(
+	SceUltQueueDataResourcePool *pool, const char *name, SceUInt32 numData,
+	SceSize dataSize, SceUInt32 numQueueObjects,
+	SceUltWaitingQueueResourcePool *waitingQueueResourcePool,
+	void *workArea, const SceUltQueueDataResourcePoolOptParam *optParam)
+{
+	return _sceUltQueueDataResourcePoolCreate(pool, name, numData, dataSize,
+		numQueueObjects, waitingQueueResourcePool, workArea, optParam);
+}
+
+/* Queues */
+
+SceInt32 _sceUltQueueOptParamInitialize(SceUltQueueOptParam *optParam);
+
+SceInt32 _sceUltQueueCreate(SceUltQueue *queue, const char *name,
+	SceSize dataSize, SceUltWaitingQueueResourcePool *waitingQueueResourcePool,
+	SceUltQueueDataResourcePool *queueDataResourcePool,
+	const SceUltQueueOptParam *optParam);
+
+/**
+ * Pushes a datum to a queue, and blocks while the queue data resource pool
+ * is exhausted.
+ *
+ * @param[in,out]	queue	The queue.
+ * @param[in]		data	The datum, of the size of the data of the queue.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * <0	An SCE_ULT_ERROR code.
+ */
+SceInt32 sceUltQueuePush(SceUltQueue *queue, const void *data);
+
+/**
+ * Pushes a datum to a queue, or fails at once with #SCE_ULT_ERROR_AGAIN.
+ */
+SceInt32 sceUltQueueTryPush(SceUltQueue *queue, const void *data);
+
+/**
+ * Pops a datum from a queue, and blocks while the queue is empty.
+ *
+ * @param[in,out]	queue	The queue.
+ * @param[out]		data	The datum, of the size of the data of the queue.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * <0	An SCE_ULT_ERROR code.
+ */
+SceInt32 sceUltQueuePop(SceUltQueue *queue, void *data);
+
+/**
+ * Pops a datum from a queue, or fails at once with #SCE_ULT_ERROR_AGAIN.
+ */
+SceInt32 sceUltQueueTryPop(SceUltQueue *queue, void *data);
+
+SceInt32 sceUltQueueDestroy(SceUltQueue *queue);
+
+static inline SceInt32 sceUltQueueOptParamInitialize(
+	SceUltQueueOptParam *optParam)
+{
+	return _sceUltQueueOptParamInitialize(optParam);
+}
+
+static inline SceInt32 sceUltQueueCreate(SceUltQueue *queue, const char *name,
+	SceSize dataSize, SceUltWaitingQueueResourcePool *waitingQueueResourcePool,
+	SceUltQueueDataResourcePool *queueDataResourcePool,
+	const SceUltQueueOptParam *optParam)
+{
+	return _sceUltQueueCreate(queue, name, dataSize,
+		waitingQueueResourcePool, queueDataResourcePool, optParam);
+}
+
+/* Mutexes */
+
+SceInt32 _sceUltMutexOptParamInitialize(SceUltMutexOptParam *optParam);
+
+SceInt32 _sceUltMutexCreate(SceUltMutex *mutex, const char *name,
+	SceUltWaitingQueueResourcePool *waitingQueueResourcePool,
+	const SceUltMutexOptParam *optParam);
+
+/**
+ * Locks a mutex, and blocks while another thread or ULT holds it.
+ *
+ * @param[in,out]	mutex	The mutex.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * <0	An SCE_ULT_ERROR code.
+ */
+SceInt32 sceUltMutexLock(SceUltMutex *mutex);
+
+/**
+ * Locks a mutex, or fails at once with #SCE_ULT_ERROR_BUSY.
+ */
+SceInt32 sceUltMutexTryLock(SceUltMutex *mutex);
+
+SceInt32 sceUltMutexUnlock(SceUltMutex *mutex);
+
+SceInt32 sceUltMutexDestroy(SceUltMutex *mutex);
+
+static inline SceInt32 sceUltMutexOptParamInitialize(
+	SceUltMutexOptParam *optParam)
+{
+	return _sceUltMutexOptParamInitialize(optParam);
+}
+
+static inline SceInt32 sceUltMutexCreate(SceUltMutex *mutex, const char *name,
+	SceUltWaitingQueueResourcePool *waitingQueueResourcePool,
+	const SceUltMutexOptParam *optParam)
+{
+	return _sceUltMutexCreate(mutex, name, waitingQueueResourcePool,
+		optParam);
+}
+
+/* Condition variables */
+
+SceInt32 _sceUltConditionVariableOptParamInitialize(
+	SceUltConditionVariableOptParam *optParam);
+
+SceInt32 _sceUltConditionVariableCreate(
+	SceUltConditionVariable *conditionVariable, const char *name,
+	SceUltMutex *mutex, const SceUltConditionVariableOptParam *optParam);
+
+/**
+ * Unlocks the mutex of a condition variable, waits until the variable is
+ * signaled, and locks the mutex again.
+ *
+ * @param[in,out]	conditionVariable	The condition variable.  The caller
+ * 										must hold its mutex.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * <0	An SCE_ULT_ERROR code.
+ */
+SceInt32 sceUltConditionVariableWait(
+	SceUltConditionVariable *conditionVariable);
+
+SceInt32 sceUltConditionVariableSignal(
+	SceUltConditionVariable *conditionVariable);
+
+SceInt32 sceUltConditionVariableSignalAll(
+	SceUltConditionVariable *conditionVariable);
+
+SceInt32 sceUltConditionVariableDestroy(
+	SceUltConditionVariable *conditionVariable);
+
+static inline SceInt32 sceUltConditionVariableOptParamInitialize(
+	SceUltConditionVariableOptParam *optParam)
+{
+	return _sceUltConditionVariableOptParamInitialize(optParam);
+}
+
+static inline SceInt32 sceUltConditionVariableCreate(
+	SceUltConditionVariable *conditionVariable, const char *name,
+	SceUltMutex *mutex, const SceUltConditionVariableOptParam *optParam)
+{
+	return _sceUltConditionVariableCreate(conditionVariable, name, mutex,
+		optParam);
+}
+
+/* Reader-writer locks */
+
+SceInt32 _sceUltReaderWriterLockOptParamInitialize(
+	SceUltReaderWriterLockOptParam *optParam);
+
+SceInt32 _sceUltReaderWriterLockCreate(SceUltReaderWriterLock *rwlock,
+	const char *name, SceUltWaitingQueueResourcePool *waitingQueueResourcePool,
+	const SceUltReaderWriterLockOptParam *optParam);
+
+/**
+ * Locks a reader-writer lock for reading, and blocks while a writer holds
+ * it.
+ *
+ * @param[in,out]	rwlock	The lock.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * <0	An SCE_ULT_ERROR code.
+ */
+SceInt32 sceUltReaderWriterLockLockRead(SceUltReaderWriterLock *rwlock);
+
+SceInt32 sceUltReaderWriterLockTryLockRead(SceUltReaderWriterLock *rwlock);
+
+SceInt32 sceUltReaderWriterLockUnlockRead(SceUltReaderWriterLock *rwlock);
+
+/**
+ * Locks a reader-writer lock for writing, and blocks while a reader or a
+ * writer holds it.
+ *
+ * @param[in,out]	rwlock	The lock.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * <0	An SCE_ULT_ERROR code.
+ */
+SceInt32 sceUltReaderWriterLockLockWrite(SceUltReaderWriterLock *rwlock);
+
+SceInt32 sceUltReaderWriterLockTryLockWrite(SceUltReaderWriterLock *rwlock);
+
+SceInt32 sceUltReaderWriterLockUnlockWrite(SceUltReaderWriterLock *rwlock);
+
+SceInt32 sceUltReaderWriterLockDestroy(SceUltReaderWriterLock *rwlock);
+
+static inline SceInt32 sceUltReaderWriterLockOptParamInitialize(
+	SceUltReaderWriterLockOptParam *optParam)
+{
+	return _sceUltReaderWriterLockOptParamInitialize(optParam);
+}
+
+static inline SceInt32 sceUltReaderWriterLockCreate(
+	SceUltReaderWriterLock *rwlock, const char *name,
+	SceUltWaitingQueueResourcePool *waitingQueueResourcePool,
+	const SceUltReaderWriterLockOptParam *optParam)
+{
+	return _sceUltReaderWriterLockCreate(rwlock, name,
+		waitingQueueResourcePool, optParam);
+}
+
+/* Semaphores */
+
+SceInt32 _sceUltSemaphoreOptParamInitialize(SceUltSemaphoreOptParam *optParam);
+
+SceInt32 _sceUltSemaphoreCreate(SceUltSemaphore *semaphore, const char *name,
+	SceInt32 numInitialResource,
+	SceUltWaitingQueueResourcePool *waitingQueueResourcePool,
+	const SceUltSemaphoreOptParam *optParam);
+
+/**
+ * Acquires resources of a semaphore, and blocks until there are enough.
+ *
+ * @param[in,out]	semaphore	The semaphore.
+ * @param[in]		numResource	The number of resources.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * <0	An SCE_ULT_ERROR code.
+ */
+SceInt32 sceUltSemaphoreAcquire(SceUltSemaphore *semaphore,
+	SceInt32 numResource);
+
+SceInt32 sceUltSemaphoreTryAcquire(SceUltSemaphore *semaphore,
+	SceInt32 numResource);
+
+SceInt32 sceUltSemaphoreRelease(SceUltSemaphore *semaphore,
+	SceInt32 numResource);
+
+SceInt32 sceUltSemaphoreDestroy(SceUltSemaphore *semaphore);
+
+static inline SceInt32 sceUltSemaphoreOptParamInitialize(
+	SceUltSemaphoreOptParam *optParam)
+{
+	return _sceUltSemaphoreOptParamInitialize(optParam);
+}
+
+static inline SceInt32 sceUltSemaphoreCreate(SceUltSemaphore *semaphore,
+	const char *name, SceInt32 numInitialResource,
+	SceUltWaitingQueueResourcePool *waitingQueueResourcePool,
+	const SceUltSemaphoreOptParam *optParam)
+{
+	return _sceUltSemaphoreCreate(semaphore, name, numInitialResource,
+		waitingQueueResourcePool, optParam);
+}
+
+/* Runtimes */
+
+SceInt32 _sceUltUlthreadRuntimeOptParamInitialize(
+	SceUltUlthreadRuntimeOptParam *optParam);
+
+/**
+ * Gets the size of the work area of a runtime.
+ *
+ * @param[in]	numMaxUlthread		The maximum number of ULTs at once.
+ * @param[in]	numWorkerThread		The number of worker threads.
+ *
+ * @return
+ * The size.
+ */
+SceUInt32 sceUltUlthreadRuntimeGetWorkAreaSize(SceUInt32 numMaxUlthread,
+	SceUInt32 numWorkerThread);
+
+SceInt32 _sceUltUlthreadRuntimeCreate(SceUltUlthreadRuntime *runtime,
+	const char *name, SceUInt32 numMaxUlthread, SceUInt32 numWorkerThread,
+	void *workArea, const SceUltUlthreadRuntimeOptParam *optParam);
+
+SceInt32 sceUltUlthreadRuntimeDestroy(SceUltUlthreadRuntime *runtime);
+
+static inline SceInt32 sceUltUlthreadRuntimeOptParamInitialize(
+	SceUltUlthreadRuntimeOptParam *optParam)
+{
+	return _sceUltUlthreadRuntimeOptParamInitialize(optParam);
+}
+
+/**
+ * Creates a runtime and starts its worker threads.
+ *
+ * @param[out]	runtime			The runtime.
+ * @param[in]	name			The name of the runtime.
+ * @param[in]	numMaxUlthread	The maximum number of ULTs at once.
+ * @param[in]	numWorkerThread	The number of worker threads.
+ * @param[in]	workArea		The work area, of the size given by
+ * 								#sceUltUlthreadRuntimeGetWorkAreaSize().  It
+ * 								must persist until the runtime is destroyed.
+ * @param[in]	optParam		The options, or NULL.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * <0	An SCE_ULT_ERROR code.
+ */
+static inline SceInt32 sceUltUlthreadRuntimeCreate(
+	SceUltUlthreadRuntime *runtime, const char *name,
+	SceUInt32 numMaxUlthread, SceUInt32 numWorkerThread, void *workArea,
+	const SceUltUlthreadRuntimeOptParam *optParam)
+{
+	return _sceUltUlthreadRuntimeCreate(runtime, name, numMaxUlthread,
+		numWorkerThread, workArea, optParam);
+}
+
+/* ULTs */
+
+SceInt32 _sceUltUlthreadOptParamInitialize(SceUltUlthreadOptParam *optParam);
+
+SceInt32 _sceUltUlthreadCreate(SceUltUlthread *ulthread, const char *name,
+	SceUltUlthreadEntry entry, SceUInt32 arg, void *context,
+	SceSize sizeContext, SceUltUlthreadRuntime *runtime,
+	const SceUltUlthreadOptParam *optParam);
+
+/**
+ * Lets the worker thread run other ULTs before the calling ULT goes on.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_ULT_ERROR_PERMISSION	The caller is not a ULT.
+ */
+SceInt32 sceUltUlthreadYield(void);
+
+/**
+ * Ends the calling ULT.
+ *
+ * @param[in]	status	The exit status.
+ */
+SceInt32 sceUltUlthreadExit(SceInt32 status);
+
+/**
+ * Waits until a ULT ends, and releases it.  The context of the ULT may be
+ * reused once the ULT is joined.
+ *
+ * @param[in,out]	ulthread	The ULT.
+ * @param[out]		status		The exit status of the ULT, or NULL.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * <0	An SCE_ULT_ERROR code.
+ */
+SceInt32 sceUltUlthreadJoin(SceUltUlthread *ulthread, SceInt32 *status);
+
+/**
+ * Joins a ULT if it has ended, or fails at once with #SCE_ULT_ERROR_BUSY.
+ */
+SceInt32 sceUltUlthreadTryJoin(SceUltUlthread *ulthread, SceInt32 *status);
+
+SceInt32 sceUltUlthreadGetSelf(SceUltUlthread **ulthread);
+
+static inline SceInt32 sceUltUlthreadOptParamInitialize(
+	SceUltUlthreadOptParam *optParam)
+{
+	return _sceUltUlthreadOptParamInitialize(optParam);
+}
+
+/**
+ * Creates a ULT, which runs on a worker thread of a runtime.
+ *
+ * @param[out]	ulthread	The ULT.  It must persist until it is joined.
+ * @param[in]	name		The name of the ULT.
+ * @param[in]	entry		The entry of the ULT.
+ * @param[in]	arg			The argument of the entry.
+ * @param[in]	context		The context of the ULT, its stack.  It must
+ * 							persist until the ULT is joined.
+ * @param[in]	sizeContext	The size of the context.
+ * @param[in]	runtime		The runtime.
+ * @param[in]	optParam	The options, or NULL.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * <0	An SCE_ULT_ERROR code.
+ */
+static inline SceInt32 sceUltUlthreadCreate(SceUltUlthread *ulthread,
+	const char *name, SceUltUlthreadEntry entry, SceUInt32 arg,
+	void *context, SceSize sizeContext, SceUltUlthreadRuntime *runtime,
+	const SceUltUlthreadOptParam *optParam)
+{
+	return _sceUltUlthreadCreate(ulthread, name, entry, arg, context,
+		sizeContext, runtime, optParam);
+}
+
+/**
+ * The parameters of #psp2UltRuntimeInit().
+ */
+typedef struct Psp2UltRuntimeParams {
+	const char *name;					//!< The name of the runtime and of its pool.
+	uint32_t maxUlthreadCount;			//!< The maximum number of ULTs at once.
+	uint32_t workerThreadCount;			//!< The number of worker threads.
+	uint32_t maxSyncObjectCount;		//!< The number of synchronization objects of the pool.
+	uint32_t maxWaiterCount;			//!< The number of threads and ULTs that may wait at once, or 0 for the maximum number of ULTs plus one per worker thread.
+} Psp2UltRuntimeParams;
+
+/**
+ * A runtime with a waiting queue resource pool, whose work areas share one
+ * memory block.
+ */
+typedef struct Psp2UltRuntime {
+	SceUltUlthreadRuntime runtime;
+	SceUltWaitingQueueResourcePool pool;
+	SceUID memBlock;					//!< The memory block of the work areas.
+	int poolCreated;
+	int runtimeCreated;
+} Psp2UltRuntime;
+
+static inline SceSize psp2UltAlign(SceSize size, SceSize alignment)
+{
+	return (size + alignment - 1) & ~(alignment - 1);
+}
+
+/**
+ * Destroys a runtime and its pool, and frees their memory block.  The ULTs
+ * must be joined and the synchronization objects destroyed.
+ *
+ * @param[in,out]	runtime	The runtime.
+ */
+static inline void psp2UltRuntimeTerm(Psp2UltRuntime *runtime)
+{
+	if (runtime->runtimeCreated) {
+		sceUltUlthreadRuntimeDestroy(&runtime->runtime);
+		runtime->runtimeCreated = 0;
+	}
+
+	if (runtime->poolCreated) {
+		sceUltWaitingQueueResourcePoolDestroy(&runtime->pool);
+		runtime->poolCreated = 0;
+	}
+
+	if (runtime->memBlock > 0) {
+		sceKernelFreeMemBlock(runtime->memBlock);
+		runtime->memBlock = 0;
+	}
+}
+
+/**
+ * Creates a runtime and a waiting queue resource pool, with their work areas
+ * in one memory block.
+ *
+ * @param[out]	runtime	The runtime.
+ * @param[in]	params	The parameters.  This structure does not need to
+ * 						persist after the call.
+ *
+ * @retval
+ * 0	The operation was completed successfully.
+ * @retval
+ * SCE_KERNEL_ERROR_INVALID_ARGUMENT	There is no ULT or no worker thread.
+ * @retval
+ * <0	The error returned by the allocation of the memory block, or by the
+ * creation of the pool or of the runtime.
+ */
+static inline int psp2UltRuntimeInit(Psp2UltRuntime *runtime,
+	const Psp2UltRuntimeParams *params)
+{
+	SceSize runtimeSize, poolSize;
+	uint32_t waiterCount;
+	char *base;
+	int ret;
+
+	__builtin_memset(runtime, 0, sizeof(*runtime));
+
+	if (params->maxUlthreadCount == 0 || params->workerThreadCount == 0)
+		return SCE_KERNEL_ERROR_INVALID_ARGUMENT;
+
+	waiterCount = params->maxWaiterCount != 0 ? params->maxWaiterCount :
+		params->maxUlthreadCount + params->workerThreadCount;
+
+	runtimeSize = psp2UltAlign(sceUltUlthreadRuntimeGetWorkAreaSize(
+			params->maxUlthreadCount, params->workerThreadCount),
+		SCE_ULT_ALIGNMENT);
+	poolSize = psp2UltAlign(sceUltWaitingQueueResourcePoolGetWorkAreaSize(
+			waiterCount, params->maxSyncObjectCount),
+		SCE_ULT_ALIGNMENT);
+
+	ret = sceKernelAllocMemBlock(params->name,
+		SCE_KERNEL_MEMBLOCK_TYPE_USER_RW,
+		psp2UltAlign(runtimeSize + poolSize, PSP2_ULT_MEMBLOCK_ALIGNMENT),
+		NULL);
+	if (ret < 0)
+		return ret;
+	runtime->memBlock = ret;
+
+	ret = sceKernelGetMemBlockBase(runtime->memBlock, (void **)&base);
+	if (ret < 0)
+		goto fail;
+
+	ret = sceUltWaitingQueueResourcePoolCreate(&runtime->pool, params->name,
+		waiterCount, params->maxSyncObjectCount, base + runtimeSize, NULL);
+	if (ret < 0)
+		goto fail;
+	runtime->poolCreated = 1;
+
+	ret = sceUltUlthreadRuntimeCreate(&runtime->runtime, params->name,
+		params->maxUlthreadCount, params->workerThreadCount, base, NULL);
+	if (ret < 0)
+		goto fail;
+	runtime->runtimeCreated = 1;
+
+	return 0;
+
+fail:
+	psp2UltRuntimeTerm(runtime);
+	return ret;
+}
+
+#ifdef	__cplusplus
+}
+#endif	// def __cplusplus
+
+#endif /* _PSP2_ULT_H_ */
@@ -0,0 +1,431 @@
+/**
+ * \file ult_task.h
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+
+#ifndef _PSP2_ULT_TASK_H_
+#define _PSP2_ULT_TASK_H_
+
+/**
+ * @file
+ *
+ * Tasks and futures on SceUlt user-level threads.
+ *
+ * #psp2::Ult::async() runs a function or a function object on a new ULT of a
+ * runtime and ties the ULT to a future.  Waiting for a future from a task
+ * only blocks the ULT of the task, so the code of a task is written straight
+ * and thousands of tasks share the few worker threads of the runtime:
+ *
+ * @code
+ * 	struct LoadChunk {
+ * 		int index;
+ * 		Chunk *operator()() const { return loadChunk(index); }
+ * 	};
+ *
+ * 	psp2::Ult::Runtime runtime;
+ * 	psp2::Ult::Future<Chunk *> chunks[64];
+ *
+ * 	runtime.init(params);
+ * 	for (int i = 0; i < 64; i++) {
+ * 		LoadChunk load = { i };
+ * 		psp2::Ult::async(runtime, chunks[i], load);
+ * 	}
+ * 	for (int i = 0; i < 64; i++) {
+ * 		Chunk *chunk;
+ *
+ * 		if (chunks[i].get(&chunk) == 0)
+ * 			addChunk(chunk);
+ * 	}
+ * @endcode
+ *
+ * Errors are returned as SCE error codes; nothing throws.  The state of a
+ * task and its context are allocated together with malloc(), and freed when
+ * its future is reset or destroyed, which joins the task first.
+ */
+#include <new>
+#include <stdlib.h>
+#include <psp2/ult.h>
+
+namespace psp2 {
+namespace Ult {
+
+	/** The default size of the context of a task, its stack */
+	const SceSize kDefaultContextSize = 0x4000;
+
+	/**
+	 * A runtime and its waiting queue resource pool.
+	 */
+	class Runtime
+	{
+	public:
+		Runtime() : m_contextSize(kDefaultContextSize)
+		{
+			__builtin_memset(&m_runtime, 0, sizeof(m_runtime));
+		}
+
+		~Runtime()
+		{
+			term();
+		}
+
+		/**
+		 * Creates the runtime.
+		 *
+		 * @param[in]	params		The parameters of #psp2UltRuntimeInit().
+		 * @param[in]	contextSize	The size of the context of each task.
+		 *
+		 * @retval
+		 * 0	The operation was completed successfully.
+		 * @retval
+		 * <0	The error returned by #psp2UltRuntimeInit().
+		 */
+		int init(const Psp2UltRuntimeParams &params,
+			SceSize contextSize = kDefaultContextSize)
+		{
+			term();
+			m_contextSize = psp2UltAlign(contextSize, SCE_ULT_ALIGNMENT);
+			return psp2UltRuntimeInit(&m_runtime, &params);
+		}
+
+		/**
+		 * Destroys the runtime.  The futures of its tasks must be reset.
+		 */
+		void term()
+		{
+			psp2UltRuntimeTerm(&m_runtime);
+		}
+
+		SceUltUlthreadRuntime *get()
+		{
+			return &m_runtime.runtime;
+		}
+
+		/** The pool for the synchronization objects used by the tasks */
+		SceUltWaitingQueueResourcePool *pool()
+		{
+			return &m_runtime.pool;
+		}
+
+		SceSize contextSize() const
+		{
+			return m_contextSize;
+		}
+
+	private:
+		Runtime(const Runtime &);
+		Runtime &operator=(const Runtime &);
+
+		Psp2UltRuntime m_runtime;
+		SceSize m_contextSize;
+	};
+
+	template <typename T> class Future;
+
+	template <typename T, typename F>
+	int async(Runtime &runtime, Future<T> &future, const F &func);
+
+	namespace detail {
+
+		template <typename T>
+		struct FutureState
+		{
+			SceUltUlthread ulthread;
+			void (*destroy)(FutureState *state);
+			bool joined;
+			bool hasValue;
+			union {
+				SceUInt64 align;
+				char bytes[sizeof(T)];
+			} storage;
+
+			T *value()
+			{
+				return reinterpret_cast<T *>(storage.bytes);
+			}
+
+			void destroyValue()
+			{
+				if (hasValue)
+					value()->~T();
+			}
+		};
+
+		template <>
+		struct FutureState<void>
+		{
+			SceUltUlthread ulthread;
+			void (*destroy)(FutureState *state);
+			bool joined;
+			bool hasValue;
+
+			void destroyValue()
+			{
+			}
+		};
+
+		template <typename T>
+		struct Call
+		{
+			template <typename State>
+			static void run(State *state)
+			{
+				new (state->value()) T(state->func());
+				state->hasValue = true;
+			}
+		};
+
+		template <>
+		struct Call<void>
+		{
+			template <typename State>
+			static void run(State *state)
+			{
+				state->func();
+				state->hasValue = true;
+			}
+		};
+
+		/* The state of a task, followed by its context */
+		template <typename T, typename F>
+		struct TaskState : FutureState<T>
+		{
+			F func;
+
+			explicit TaskState(const F &f) : func(f)
+			{
+				this->destroy = destroyState;
+				this->joined = false;
+				this->hasValue = false;
+			}
+
+			static SceInt32 entry(SceUInt32 arg)
+			{
+				Call<T>::run(reinterpret_cast<TaskState *>(
+					static_cast<uintptr_t>(arg)));
+				return 0;
+			}
+
+			static void destroyState(FutureState<T> *base)
+			{
+				TaskState *state = static_cast<TaskState *>(base);
+
+				state->destroyValue();
+				state->~TaskState();
+				free(state);
+			}
+		};
+
+		template <typename T>
+		class FutureBase
+		{
+		public:
+			FutureBase() : m_state(NULL)
+			{
+			}
+
+			~FutureBase()
+			{
+				reset();
+			}
+
+			/** Whether a task is tied to the future */
+			bool valid() const
+			{
+				return m_state != NULL;
+			}
+
+			/** Whether the task is done, without waiting */
+			bool ready()
+			{
+				if (m_state == NULL)
+					return false;
+
+				if (!m_state->joined
+					&& sceUltUlthreadTryJoin(&m_state->ulthread, NULL) == 0)
+					m_state->joined = true;
+
+				return m_state->joined;
+			}
+
+			/**
+			 * Waits until the task is done.  Only the calling ULT blocks if
+			 * the caller is a task.
+			 *
+			 * @retval
+			 * 0	The operation was completed successfully.
+			 * @retval
+			 * SCE_ULT_ERROR_STATE	No task is tied to the future.
+			 * @retval
+			 * <0	The error returned by #sceUltUlthreadJoin().
+			 */
+			int wait()
+			{
+				int ret;
+
+				if (m_state == NULL)
+					return SCE_ULT_ERROR_STATE;
+
+				if (!m_state->joined) {
+					ret = sceUltUlthreadJoin(&m_state->ulthread, NULL);
+					if (ret < 0)
+						return ret;
+					m_state->joined = true;
+				}
+
+				return 0;
+			}
+
+			/** Waits until the task is done, and frees it */
+			void reset()
+			{
+				if (m_state != NULL) {
+					wait();
+					m_state->destroy(m_state);
+					m_state = NULL;
+				}
+			}
+
+		protected:
+			FutureState<T> *m_state;
+
+		private:
+			FutureBase(const FutureBase &);
+			FutureBase &operator=(const FutureBase &);
+
+			template <typename U, typename F>
+			friend int psp2::Ult::async(Runtime &runtime, Future<U> &future,
+				const F &func);
+		};
+
+	} // namespace detail
+
+	/**
+	 * The result of a task.
+	 */
+	template <typename T>
+	class Future : public detail::FutureBase<T>
+	{
+	public:
+		/**
+		 * Waits until the task is done, and copies its result.
+		 *
+		 * @param[out]	out	The result of the task.
+		 *
+		 * @retval
+		 * 0	The operation was completed successfully.
+		 * @retval
+		 * SCE_ULT_ERROR_NULL	@p out is NULL.
+		 * @retval
+		 * SCE_ULT_ERROR_STATE	No task is tied to the future, or the task
+		 * ended without a result.
+		 * @retval
+		 * <0	The error returned by #sceUltUlthreadJoin().
+		 */
+		int get(T *out)
+		{
+			int ret;
+
+			if (out == NULL)
+				return SCE_ULT_ERROR_NULL;
+
+			ret = this->wait();
+			if (ret < 0)
+				return ret;
+
+			if (!this->m_state->hasValue)
+				return SCE_ULT_ERROR_STATE;
+
+			*out = *this->m_state->value();
+			return 0;
+		}
+	};
+
+	/**
+	 * The end of a task without a result.
+	 */
+	template <>
+	class Future<void> : public detail::FutureBase<void>
+	{
+	public:
+		/**
+		 * Waits until the task is done.
+		 *
+		 * @retval
+		 * 0	The operation was completed successfully.
+		 * @retval
+		 * SCE_ULT_ERROR_STATE	No task is tied to the future.
+		 * @retval
+		 * <0	The error returned by #sceUltUlthreadJoin().
+		 */
+		int get()
+		{
+			return wait();
+		}
+	};
+
+	/**
+	 * Runs a function, or a copy of a function object, on a new ULT, and ties
+	 * it to a future, which is reset first.
+	 *
+	 * @param[in,out]	runtime	The runtime.
+	 * @param[out]		future	The future of the result of the function.
+	 * @param[in]		func	The function, called with no argument.
+	 *
+	 * @retval
+	 * 0	The operation was completed successfully.
+	 * @retval
+	 * SCE_KERNEL_ERROR_NO_MEMORY	The state of the task could not be
+	 * allocated.
+	 * @retval
+	 * <0	The error returned by #sceUltUlthreadCreate().
+	 */
+	template <typename T, typename F>
+	int async(Runtime &runtime, Future<T> &future, const F &func)
+	{
+		typedef detail::TaskState<T, F> State;
+		SceSize stateSize;
+		State *state;
+		void *memory;
+		int ret;
+
+		future.reset();
+
+		stateSize = psp2UltAlign(sizeof(State), SCE_ULT_ALIGNMENT);
+		memory = malloc(stateSize + runtime.contextSize());
+		if (memory == NULL)
+			return SCE_KERNEL_ERROR_NO_MEMORY;
+
+		state = new (memory) State(func);
+		ret = sceUltUlthreadCreate(&state->ulthread, "psp2UltTask",
+			State::entry, static_cast<SceUInt32>(
+				reinterpret_cast<uintptr_t>(state)),
+			static_cast<char *>(memory) + stateSize, runtime.contextSize(),
+			runtime.get(), NULL);
+		if (ret < 0) {
+			state->~State();
+			free(memory);
+			return ret;
+		}
+
+		future.m_state = state;
+		return 0;
+	}
+
+	/**
+	 * Lets the worker thread run other tasks before the calling task goes on.
+	 */
+	inline int yield()
+	{
+		return sceUltUlthreadYield();
+	}
+
+} // namespace Ult
+} // namespace psp2
+
+#endif /* _PSP2_ULT_TASK_H_ */
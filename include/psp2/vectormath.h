@@ -11,8 +11,43 @@
 #ifndef _PSP2_VECTORMATH_H_
 #define _PSP2_VECTORMATH_H_
 
-/* sce::Vectormath::Scalar::Aos */
+/* sce::Vectormath::Scalar::Aos and sce::Vectormath::Scalar::Soa */
 #include <psp2/vectormath/scalar_cpp/vectormath_aos.h>
 #include <psp2/vectormath/scalar_cpp/floatInVec_math.h>
+#include <psp2/vectormath/scalar_cpp/batch_soa.h>
+
+/* sce::Vectormath::Neon::Aos and sce::Vectormath::Neon::Soa, built unless SCE_VECTORMATH_NO_NEON is defined */
+#if defined(__ARM_NEON__) && !defined(SCE_VECTORMATH_NO_NEON)
+#include <psp2/vectormath/neon_cpp/vectormath_aos.h>
+#include <psp2/vectormath/neon_cpp/floatInVec_math.h>
+#include <psp2/vectormath/neon_cpp/batch_soa.h>
+
+namespace sce {
+namespace Vectormath {
+	/* The fastest implementation available for the target */
+	namespace Simd = Neon;
+} // namespace Vectormath
+} // namespace sce
+/* sce::Vectormath::Sse::Aos and sce::Vectormath::Sse::Soa for host tools,
+   built unless SCE_VECTORMATH_NO_SSE is defined */
+#elif defined(__SSE2__) && !defined(SCE_VECTORMATH_NO_SSE)
+#include <psp2/vectormath/sse_cpp/vectormath_aos.h>
+#include <psp2/vectormath/sse_cpp/floatInVec_math.h>
+#include <psp2/vectormath/sse_cpp/batch_soa.h>
+
+namespace sce {
+namespace Vectormath {
+	/* The fastest implementation available for the target */
+	namespace Simd = Sse;
+} // namespace Vectormath
+} // namespace sce
+#else
+namespace sce {
+namespace Vectormath {
+	/* The fastest implementation available for the target */
+	namespace Simd = Scalar;
+} // namespace Vectormath
+} // namespace sce
+#endif
 
 #endif // _PSP2_VECTORMATH_H_
@@ -0,0 +1,345 @@
+﻿/**
+ * \file batch_soa.h
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+
+#ifndef _PSP2_VECTORMATH_NEON_BATCH_SOA_CPP_H_
+#define _PSP2_VECTORMATH_NEON_BATCH_SOA_CPP_H_
+
+#include <psp2/vectormath/neon_cpp/vectormath_aos.h>
+
+namespace sce {
+namespace Vectormath {
+namespace Neon {
+
+/// @short
+/// The namespace containing the batch (structure-of-arrays) entry points.
+///
+/// The namespace containing the batch (structure-of-arrays) entry points.
+/// Each function processes <code>count</code> elements stored as separate
+/// x, y, z (and w) arrays. Inputs are only read, so an output stream may
+/// alias the corresponding input stream to transform in place.
+///
+namespace Soa {
+
+/// @short
+/// A stream of 3-element values in structure-of-arrays format
+///
+/// A stream of 3-element values stored as three separate float arrays.
+///
+struct Stream3
+{
+	float *x;	//!< Array of x elements
+	float *y;	//!< Array of y elements
+	float *z;	//!< Array of z elements
+};
+
+/// @short
+/// A stream of 4-element values in structure-of-arrays format
+///
+/// A stream of 4-element values stored as four separate float arrays.
+///
+struct Stream4
+{
+	float *x;	//!< Array of x elements
+	float *y;	//!< Array of y elements
+	float *z;	//!< Array of z elements
+	float *w;	//!< Array of w elements
+};
+
+/// @short
+/// Transform a stream of 3D points by a 4x4 matrix
+///
+/// Multiply each point (with an implied w of 1) by a 4x4 matrix and store the homogeneous result.
+/// @param mat   4x4 matrix
+/// @param in   3D points
+/// @param out   Transformed 4D points
+/// @param count   Number of points
+///
+SCE_VECTORMATH_INLINE void transformPoints(Aos::Matrix4_arg mat, const Stream3 &in, const Stream4 &out, uint32_t count);
+
+/// @short
+/// Transform a stream of 3D points by a 3x4 transformation matrix
+///
+/// Multiply each point (with an implied w of 1) by a 3x4 transformation matrix.
+/// @param tfrm   3x4 transformation matrix
+/// @param in   3D points
+/// @param out   Transformed 3D points
+/// @param count   Number of points
+///
+SCE_VECTORMATH_INLINE void transformPoints(Aos::Transform3_arg tfrm, const Stream3 &in, const Stream3 &out, uint32_t count);
+
+/// @short
+/// Transform a stream of 3D vectors by a 3x3 matrix
+///
+/// Multiply each vector by a 3x3 matrix.
+/// @param mat   3x3 matrix
+/// @param in   3D vectors
+/// @param out   Transformed 3D vectors
+/// @param count   Number of vectors
+///
+SCE_VECTORMATH_INLINE void transformVectors(Aos::Matrix3_arg mat, const Stream3 &in, const Stream3 &out, uint32_t count);
+
+#if !defined(SCE_VECTORMATH_NO_MATH_DEFS)
+
+/// @short
+/// Transform and renormalize a stream of normals
+///
+/// Multiply each normal by a 3x3 matrix and normalize the result. For a non-uniformly scaled transform, pass the inverse transpose of its upper 3x3.
+/// @param mat   3x3 matrix
+/// @param in   Normals
+/// @param out   Transformed unit-length normals
+/// @param count   Number of normals
+/// @note
+/// The result is unpredictable when a transformed normal has zero length.
+///
+SCE_VECTORMATH_INLINE void transformNormals(Aos::Matrix3_arg mat, const Stream3 &in, const Stream3 &out, uint32_t count);
+
+#endif	/* !defined(SCE_VECTORMATH_NO_MATH_DEFS) */
+
+/// @short
+/// Test a stream of bounding spheres against a set of planes
+///
+/// A sphere is visible when it is not entirely behind any plane. A plane (a, b, c, d) keeps the points with a*x + b*y + c*z + d >= 0.
+/// @param planes   Planes, typically the six planes of a view frustum
+/// @param numPlanes   Number of planes
+/// @param spheres   Sphere centers in x, y, z and radii in w
+/// @param visible   Receives 1 for every visible sphere and 0 for every culled sphere
+/// @param count   Number of spheres
+/// @return
+/// The number of visible spheres
+///
+SCE_VECTORMATH_INLINE uint32_t cullSpheres(const Aos::Vector4 *planes, uint32_t numPlanes, const Stream4 &spheres, uint8_t *visible, uint32_t count);
+
+#if !defined(SCE_VECTORMATH_NO_MATH_DEFS)
+
+/// @short
+/// Normalize a stream of quaternions
+///
+/// Normalize each quaternion.
+/// @param in   Quaternions
+/// @param out   Unit-length quaternions
+/// @param count   Number of quaternions
+/// @note
+/// The result is unpredictable when a quaternion has zero length.
+///
+SCE_VECTORMATH_INLINE void normalizeQuats(const Stream4 &in, const Stream4 &out, uint32_t count);
+
+/// @short
+/// Spherical linear interpolation between two streams of unit-length quaternions
+///
+/// Interpolate each pair of quaternions like <code>Aos::slerp</code>, taking the shortest path.
+/// @param t   Interpolation parameter
+/// @param unitQuat0   Unit-length quaternions
+/// @param unitQuat1   Unit-length quaternions
+/// @param out   Interpolated quaternions
+/// @param count   Number of quaternions
+/// @param tol   Above this cosine the interpolation falls back to a linear one
+///
+SCE_VECTORMATH_INLINE void slerpQuats(float t, const Stream4 &unitQuat0, const Stream4 &unitQuat1, const Stream4 &out, uint32_t count, float tol = SCE_VECTORMATH_DEFAULT_SLERP_TOL_F);
+
+#endif	/* !defined(SCE_VECTORMATH_NO_MATH_DEFS) */
+
+//-----------------------------------------------------------------------------
+// Definitions
+
+SCE_VECTORMATH_INLINE void transformPoints(Aos::Matrix4_arg mat, const Stream3 &in, const Stream4 &out, uint32_t count)
+{
+	const float32x4_t col0 = mat.getCol0().get128();
+	const float32x4_t col1 = mat.getCol1().get128();
+	const float32x4_t col2 = mat.getCol2().get128();
+	const float32x4_t col3 = mat.getCol3().get128();
+	const float32x2_t col0xy = vget_low_f32(col0), col0zw = vget_high_f32(col0);
+	const float32x2_t col1xy = vget_low_f32(col1), col1zw = vget_high_f32(col1);
+	const float32x2_t col2xy = vget_low_f32(col2), col2zw = vget_high_f32(col2);
+	const float32x2_t col3xy = vget_low_f32(col3), col3zw = vget_high_f32(col3);
+	for (uint32_t i = 0; i < count; i += 4) {
+		const uint32_t n = count - i;
+		const float32x4_t x = Internal::load4(in.x + i, n, 0.0f);
+		const float32x4_t y = Internal::load4(in.y + i, n, 0.0f);
+		const float32x4_t z = Internal::load4(in.z + i, n, 0.0f);
+		float32x4_t res;
+		res = vmlaq_lane_f32(vmlaq_lane_f32(vmlaq_lane_f32(vdupq_lane_f32(col3xy, 0), x, col0xy, 0), y, col1xy, 0), z, col2xy, 0);
+		Internal::store4(out.x + i, res, n);
+		res = vmlaq_lane_f32(vmlaq_lane_f32(vmlaq_lane_f32(vdupq_lane_f32(col3xy, 1), x, col0xy, 1), y, col1xy, 1), z, col2xy, 1);
+		Internal::store4(out.y + i, res, n);
+		res = vmlaq_lane_f32(vmlaq_lane_f32(vmlaq_lane_f32(vdupq_lane_f32(col3zw, 0), x, col0zw, 0), y, col1zw, 0), z, col2zw, 0);
+		Internal::store4(out.z + i, res, n);
+		res = vmlaq_lane_f32(vmlaq_lane_f32(vmlaq_lane_f32(vdupq_lane_f32(col3zw, 1), x, col0zw, 1), y, col1zw, 1), z, col2zw, 1);
+		Internal::store4(out.w + i, res, n);
+	}
+}
+
+SCE_VECTORMATH_INLINE void transformPoints(Aos::Transform3_arg tfrm, const Stream3 &in, const Stream3 &out, uint32_t count)
+{
+	const float32x4_t col0 = tfrm.getCol0().get128();
+	const float32x4_t col1 = tfrm.getCol1().get128();
+	const float32x4_t col2 = tfrm.getCol2().get128();
+	const float32x4_t col3 = tfrm.getCol3().get128();
+	const float32x2_t col0xy = vget_low_f32(col0), col0zw = vget_high_f32(col0);
+	const float32x2_t col1xy = vget_low_f32(col1), col1zw = vget_high_f32(col1);
+	const float32x2_t col2xy = vget_low_f32(col2), col2zw = vget_high_f32(col2);
+	const float32x2_t col3xy = vget_low_f32(col3), col3zw = vget_high_f32(col3);
+	for (uint32_t i = 0; i < count; i += 4) {
+		const uint32_t n = count - i;
+		const float32x4_t x = Internal::load4(in.x + i, n, 0.0f);
+		const float32x4_t y = Internal::load4(in.y + i, n, 0.0f);
+		const float32x4_t z = Internal::load4(in.z + i, n, 0.0f);
+		float32x4_t res;
+		res = vmlaq_lane_f32(vmlaq_lane_f32(vmlaq_lane_f32(vdupq_lane_f32(col3xy, 0), x, col0xy, 0), y, col1xy, 0), z, col2xy, 0);
+		Internal::store4(out.x + i, res, n);
+		res = vmlaq_lane_f32(vmlaq_lane_f32(vmlaq_lane_f32(vdupq_lane_f32(col3xy, 1), x, col0xy, 1), y, col1xy, 1), z, col2xy, 1);
+		Internal::store4(out.y + i, res, n);
+		res = vmlaq_lane_f32(vmlaq_lane_f32(vmlaq_lane_f32(vdupq_lane_f32(col3zw, 0), x, col0zw, 0), y, col1zw, 0), z, col2zw, 0);
+		Internal::store4(out.z + i, res, n);
+	}
+}
+
+SCE_VECTORMATH_INLINE void transformVectors(Aos::Matrix3_arg mat, const Stream3 &in, const Stream3 &out, uint32_t count)
+{
+	const float32x4_t col0 = mat.getCol0().get128();
+	const float32x4_t col1 = mat.getCol1().get128();
+	const float32x4_t col2 = mat.getCol2().get128();
+	const float32x2_t col0xy = vget_low_f32(col0), col0zw = vget_high_f32(col0);
+	const float32x2_t col1xy = vget_low_f32(col1), col1zw = vget_high_f32(col1);
+	const float32x2_t col2xy = vget_low_f32(col2), col2zw = vget_high_f32(col2);
+	for (uint32_t i = 0; i < count; i += 4) {
+		const uint32_t n = count - i;
+		const float32x4_t x = Internal::load4(in.x + i, n, 0.0f);
+		const float32x4_t y = Internal::load4(in.y + i, n, 0.0f);
+		const float32x4_t z = Internal::load4(in.z + i, n, 0.0f);
+		float32x4_t res;
+		res = vmlaq_lane_f32(vmlaq_lane_f32(vmulq_lane_f32(x, col0xy, 0), y, col1xy, 0), z, col2xy, 0);
+		Internal::store4(out.x + i, res, n);
+		res = vmlaq_lane_f32(vmlaq_lane_f32(vmulq_lane_f32(x, col0xy, 1), y, col1xy, 1), z, col2xy, 1);
+		Internal::store4(out.y + i, res, n);
+		res = vmlaq_lane_f32(vmlaq_lane_f32(vmulq_lane_f32(x, col0zw, 0), y, col1zw, 0), z, col2zw, 0);
+		Internal::store4(out.z + i, res, n);
+	}
+}
+
+#if !defined(SCE_VECTORMATH_NO_MATH_DEFS)
+
+SCE_VECTORMATH_INLINE void transformNormals(Aos::Matrix3_arg mat, const Stream3 &in, const Stream3 &out, uint32_t count)
+{
+	const float32x4_t col0 = mat.getCol0().get128();
+	const float32x4_t col1 = mat.getCol1().get128();
+	const float32x4_t col2 = mat.getCol2().get128();
+	const float32x2_t col0xy = vget_low_f32(col0), col0zw = vget_high_f32(col0);
+	const float32x2_t col1xy = vget_low_f32(col1), col1zw = vget_high_f32(col1);
+	const float32x2_t col2xy = vget_low_f32(col2), col2zw = vget_high_f32(col2);
+	for (uint32_t i = 0; i < count; i += 4) {
+		const uint32_t n = count - i;
+		// Pad with a unit normal so that the unused lanes never divide by zero
+		const float32x4_t x = Internal::load4(in.x + i, n, 1.0f);
+		const float32x4_t y = Internal::load4(in.y + i, n, 0.0f);
+		const float32x4_t z = Internal::load4(in.z + i, n, 0.0f);
+		const float32x4_t resX = vmlaq_lane_f32(vmlaq_lane_f32(vmulq_lane_f32(x, col0xy, 0), y, col1xy, 0), z, col2xy, 0);
+		const float32x4_t resY = vmlaq_lane_f32(vmlaq_lane_f32(vmulq_lane_f32(x, col0xy, 1), y, col1xy, 1), z, col2xy, 1);
+		const float32x4_t resZ = vmlaq_lane_f32(vmlaq_lane_f32(vmulq_lane_f32(x, col0zw, 0), y, col1zw, 0), z, col2zw, 0);
+		const float32x4_t lenInv = Internal::rsqrt4(vmlaq_f32(vmlaq_f32(vmulq_f32(resX, resX), resY, resY), resZ, resZ));
+		Internal::store4(out.x + i, vmulq_f32(resX, lenInv), n);
+		Internal::store4(out.y + i, vmulq_f32(resY, lenInv), n);
+		Internal::store4(out.z + i, vmulq_f32(resZ, lenInv), n);
+	}
+}
+
+#endif	/* !defined(SCE_VECTORMATH_NO_MATH_DEFS) */
+
+SCE_VECTORMATH_INLINE uint32_t cullSpheres(const Aos::Vector4 *planes, uint32_t numPlanes, const Stream4 &spheres, uint8_t *visible, uint32_t count)
+{
+	uint32_t numVisible = 0;
+	for (uint32_t i = 0; i < count; i += 4) {
+		const uint32_t n = count - i;
+		const float32x4_t x = Internal::load4(spheres.x + i, n, 0.0f);
+		const float32x4_t y = Internal::load4(spheres.y + i, n, 0.0f);
+		const float32x4_t z = Internal::load4(spheres.z + i, n, 0.0f);
+		const float32x4_t negRadius = vnegq_f32(Internal::load4(spheres.w + i, n, 0.0f));
+		uint32x4_t culled = vdupq_n_u32(0);
+		for (uint32_t p = 0; p < numPlanes; p++) {
+			const float32x4_t plane = planes[p].get128();
+			const float32x2_t planeXY = vget_low_f32(plane), planeZW = vget_high_f32(plane);
+			const float32x4_t dist = vmlaq_lane_f32(vmlaq_lane_f32(vmlaq_lane_f32(vdupq_lane_f32(planeZW, 1), x, planeXY, 0), y, planeXY, 1), z, planeZW, 0);
+			culled = vorrq_u32(culled, vcltq_f32(dist, negRadius));
+		}
+		uint32_t mask[4];
+		vst1q_u32(mask, culled);
+		for (uint32_t lane = 0; lane < 4 && lane < n; lane++) {
+			const uint8_t inside = ( mask[lane] == 0 );
+			visible[i + lane] = inside;
+			numVisible += inside;
+		}
+	}
+	return numVisible;
+}
+
+#if !defined(SCE_VECTORMATH_NO_MATH_DEFS)
+
+SCE_VECTORMATH_INLINE void normalizeQuats(const Stream4 &in, const Stream4 &out, uint32_t count)
+{
+	for (uint32_t i = 0; i < count; i += 4) {
+		const uint32_t n = count - i;
+		// Pad with the identity so that the unused lanes never divide by zero
+		const float32x4_t x = Internal::load4(in.x + i, n, 0.0f);
+		const float32x4_t y = Internal::load4(in.y + i, n, 0.0f);
+		const float32x4_t z = Internal::load4(in.z + i, n, 0.0f);
+		const float32x4_t w = Internal::load4(in.w + i, n, 1.0f);
+		const float32x4_t lenInv = Internal::rsqrt4(vmlaq_f32(vmlaq_f32(vmlaq_f32(vmulq_f32(x, x), y, y), z, z), w, w));
+		Internal::store4(out.x + i, vmulq_f32(x, lenInv), n);
+		Internal::store4(out.y + i, vmulq_f32(y, lenInv), n);
+		Internal::store4(out.z + i, vmulq_f32(z, lenInv), n);
+		Internal::store4(out.w + i, vmulq_f32(w, lenInv), n);
+	}
+}
+
+SCE_VECTORMATH_INLINE void slerpQuats(float t, const Stream4 &unitQuat0, const Stream4 &unitQuat1, const Stream4 &out, uint32_t count, float tol)
+{
+	for (uint32_t i = 0; i < count; i += 4) {
+		const uint32_t n = count - i;
+		const float32x4_t x0 = Internal::load4(unitQuat0.x + i, n, 0.0f);
+		const float32x4_t y0 = Internal::load4(unitQuat0.y + i, n, 0.0f);
+		const float32x4_t z0 = Internal::load4(unitQuat0.z + i, n, 0.0f);
+		const float32x4_t w0 = Internal::load4(unitQuat0.w + i, n, 1.0f);
+		const float32x4_t x1 = Internal::load4(unitQuat1.x + i, n, 0.0f);
+		const float32x4_t y1 = Internal::load4(unitQuat1.y + i, n, 0.0f);
+		const float32x4_t z1 = Internal::load4(unitQuat1.z + i, n, 0.0f);
+		const float32x4_t w1 = Internal::load4(unitQuat1.w + i, n, 1.0f);
+		float cosAngle[4], scale0[4], scale1[4];
+		vst1q_f32(cosAngle, vmlaq_f32(vmlaq_f32(vmlaq_f32(vmulq_f32(x0, x1), y0, y1), z0, z1), w0, w1));
+		// The trigonometry stays scalar; the sign of scale0 takes the shortest path
+		for (uint32_t lane = 0; lane < 4; lane++) {
+			const float sign = ( cosAngle[lane] < 0.0f ) ? -1.0f : 1.0f;
+			const float cosAbs = cosAngle[lane] * sign;
+			if ( cosAbs < tol ) {
+				const float angle = ::acosf( cosAbs );
+				const float recipSinAngle = ( 1.0f / ::sinf( angle ) );
+				scale0[lane] = ( ::sinf( ( ( 1.0f - t ) * angle ) ) * recipSinAngle ) * sign;
+				scale1[lane] = ( ::sinf( ( t * angle ) ) * recipSinAngle );
+			} else {
+				scale0[lane] = ( 1.0f - t ) * sign;
+				scale1[lane] = t;
+			}
+		}
+		const float32x4_t s0 = vld1q_f32(scale0);
+		const float32x4_t s1 = vld1q_f32(scale1);
+		Internal::store4(out.x + i, vmlaq_f32(vmulq_f32(x0, s0), x1, s1), n);
+		Internal::store4(out.y + i, vmlaq_f32(vmulq_f32(y0, s0), y1, s1), n);
+		Internal::store4(out.z + i, vmlaq_f32(vmulq_f32(z0, s0), z1, s1), n);
+		Internal::store4(out.w + i, vmlaq_f32(vmulq_f32(w0, s0), w1, s1), n);
+	}
+}
+
+#endif	/* !defined(SCE_VECTORMATH_NO_MATH_DEFS) */
+
+} // namespace Soa
+} // namespace Neon
+} // namespace Vectormath
+} // namespace sce
+
+#endif /* _PSP2_VECTORMATH_NEON_BATCH_SOA_CPP_H_ */
@@ -0,0 +1,144 @@
+﻿/**
+ * \file internal.h
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+
+#ifndef _PSP2_VECTORMATH_NEON_INTERNAL_H_
+#define _PSP2_VECTORMATH_NEON_INTERNAL_H_
+
+#if !defined(SCE_VECTORMATH_NO_MATH_DEFS)
+#include <math.h>
+#endif	/* !defined(SCE_VECTORMATH_NO_MATH_DEFS) */
+
+//-----------------------------------------------------------------------------
+// Alignment and Inlining Control
+#define SCE_VECTORMATH_PREALIGN_16
+#define SCE_VECTORMATH_POSTALIGN_16 __attribute__ ((aligned(16)))
+#define SCE_VECTORMATH_ALWAYS_INLINE inline __attribute__((always_inline))
+#if defined(SCE_VECTORMATH_FORCE_INLINE)
+#define SCE_VECTORMATH_INLINE SCE_VECTORMATH_ALWAYS_INLINE
+#else
+#define SCE_VECTORMATH_INLINE inline
+#endif
+#define SCE_VECTORMATH_NO_INLINE __attribute__((noinline))
+#define SCE_VECTORMATH_UNUSED
+#define SCE_VECTORMATH_IS_COMPILE_TIME_CONSTANT( x ) __builtin_constant_p(x)
+
+
+//-----------------------------------------------------------------------------
+// Platform-specific Type Inclusion
+#include <psp2/vectormath/neon_cpp/internal/internal_types.h>
+#include <arm_neon.h>
+
+//-----------------------------------------------------------------------------
+// Platform-specific Argument Types
+// Vectors and matrices are passed by value: the hard-float ABI keeps them in
+// the q registers, which lets inlined calls avoid the round trip through
+// memory.
+#define SCE_VECTORMATH_NEON_AOS_FLOATINVEC_ARG
+#define SCE_VECTORMATH_NEON_AOS_BOOLINVEC_ARG
+#define SCE_VECTORMATH_NEON_AOS_VECTOR_ARG
+#define SCE_VECTORMATH_NEON_AOS_MATRIX_ARG
+
+//-----------------------------------------------------------------------------
+// Default Assert Stub
+#if !defined(SCE_VECTORMATH_ASSERT_MSG)
+#define SCE_VECTORMATH_ASSERT_MSG(condition,message)	(void)(condition)
+#endif	//	#if !(defined SCE_VECTORMATH_ASSERT_MSG)
+
+//-----------------------------------------------------------------------------
+// NEON Helpers
+namespace sce {
+namespace Vectormath {
+namespace Neon {
+namespace Internal {
+
+// Sum of the products of all four lanes, returned in both lanes
+SCE_VECTORMATH_ALWAYS_INLINE float32x2_t dot4(float32x4_t vec0, float32x4_t vec1)
+{
+	float32x4_t prod = vmulq_f32(vec0, vec1);
+	float32x2_t sum = vadd_f32(vget_low_f32(prod), vget_high_f32(prod));
+	return vpadd_f32(sum, sum);
+}
+
+// Sum of the products of the x, y and z lanes, returned in both lanes
+SCE_VECTORMATH_ALWAYS_INLINE float32x2_t dot3(float32x4_t vec0, float32x4_t vec1)
+{
+	float32x4_t prod = vmulq_f32(vec0, vec1);
+	float32x2_t sum = vpadd_f32(vget_low_f32(prod), vget_low_f32(prod));
+	return vadd_f32(sum, vdup_lane_f32(vget_high_f32(prod), 0));
+}
+
+// Reciprocal square root estimate refined by two Newton-Raphson steps
+SCE_VECTORMATH_ALWAYS_INLINE float32x2_t rsqrt(float32x2_t x)
+{
+	float32x2_t est = vrsqrte_f32(x);
+	est = vmul_f32(est, vrsqrts_f32(vmul_f32(x, est), est));
+	est = vmul_f32(est, vrsqrts_f32(vmul_f32(x, est), est));
+	return est;
+}
+
+// Reciprocal square root estimate of four lanes refined by two Newton-Raphson steps
+SCE_VECTORMATH_ALWAYS_INLINE float32x4_t rsqrt4(float32x4_t x)
+{
+	float32x4_t est = vrsqrteq_f32(x);
+	est = vmulq_f32(est, vrsqrtsq_f32(vmulq_f32(x, est), est));
+	est = vmulq_f32(est, vrsqrtsq_f32(vmulq_f32(x, est), est));
+	return est;
+}
+
+// Load four floats, or the first n of them with the other lanes set to pad
+SCE_VECTORMATH_ALWAYS_INLINE float32x4_t load4(const float *p, uint32_t n, float pad)
+{
+	if (n >= 4)
+		return vld1q_f32(p);
+
+	float tmp[4] = { pad, pad, pad, pad };
+	for (uint32_t i = 0; i < n; i++)
+		tmp[i] = p[i];
+	return vld1q_f32(tmp);
+}
+
+// Store four floats, or only the first n of them
+SCE_VECTORMATH_ALWAYS_INLINE void store4(float *p, float32x4_t vec, uint32_t n)
+{
+	if (n >= 4) {
+		vst1q_f32(p, vec);
+		return;
+	}
+
+	float tmp[4];
+	vst1q_f32(tmp, vec);
+	for (uint32_t i = 0; i < n; i++)
+		p[i] = tmp[i];
+}
+
+// Linear combination col0 * x + col1 * y + col2 * z + col3 * w
+SCE_VECTORMATH_ALWAYS_INLINE float32x4_t transform4(float32x4_t col0, float32x4_t col1, float32x4_t col2, float32x4_t col3, float32x4_t vec)
+{
+	float32x2_t xy = vget_low_f32(vec);
+	float32x2_t zw = vget_high_f32(vec);
+	float32x4_t res = vmulq_lane_f32(col0, xy, 0);
+	res = vmlaq_lane_f32(res, col1, xy, 1);
+	res = vmlaq_lane_f32(res, col2, zw, 0);
+	return vmlaq_lane_f32(res, col3, zw, 1);
+}
+
+// Swap the low and high halves of a register (zwxy)
+SCE_VECTORMATH_ALWAYS_INLINE float32x4_t swapHalves(float32x4_t vec)
+{
+	return vcombine_f32(vget_high_f32(vec), vget_low_f32(vec));
+}
+
+} // namespace Internal
+} // namespace Neon
+} // namespace Vectormath
+} // namespace sce
+
+#endif /* _PSP2_VECTORMATH_NEON_INTERNAL_H_ */
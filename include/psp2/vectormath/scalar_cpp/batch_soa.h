@@ -0,0 +1,262 @@
+﻿/**
+ * \file batch_soa.h
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+
+#ifndef _PSP2_VECTORMATH_SCALAR_BATCH_SOA_CPP_H_
+#define _PSP2_VECTORMATH_SCALAR_BATCH_SOA_CPP_H_
+
+#include <psp2/vectormath/scalar_cpp/vectormath_aos.h>
+
+namespace sce {
+namespace Vectormath {
+namespace Scalar {
+
+/// @short
+/// The namespace containing the batch (structure-of-arrays) entry points.
+///
+/// The namespace containing the batch (structure-of-arrays) entry points.
+/// Each function processes <code>count</code> elements stored as separate
+/// x, y, z (and w) arrays. Inputs are only read, so an output stream may
+/// alias the corresponding input stream to transform in place.
+///
+namespace Soa {
+
+/// @short
+/// A stream of 3-element values in structure-of-arrays format
+///
+/// A stream of 3-element values stored as three separate float arrays.
+///
+struct Stream3
+{
+	float *x;	//!< Array of x elements
+	float *y;	//!< Array of y elements
+	float *z;	//!< Array of z elements
+};
+
+/// @short
+/// A stream of 4-element values in structure-of-arrays format
+///
+/// A stream of 4-element values stored as four separate float arrays.
+///
+struct Stream4
+{
+	float *x;	//!< Array of x elements
+	float *y;	//!< Array of y elements
+	float *z;	//!< Array of z elements
+	float *w;	//!< Array of w elements
+};
+
+/// @short
+/// Transform a stream of 3D points by a 4x4 matrix
+///
+/// Multiply each point (with an implied w of 1) by a 4x4 matrix and store the homogeneous result.
+/// @param mat   4x4 matrix
+/// @param in   3D points
+/// @param out   Transformed 4D points
+/// @param count   Number of points
+///
+SCE_VECTORMATH_INLINE void transformPoints(Aos::Matrix4_arg mat, const Stream3 &in, const Stream4 &out, uint32_t count);
+
+/// @short
+/// Transform a stream of 3D points by a 3x4 transformation matrix
+///
+/// Multiply each point (with an implied w of 1) by a 3x4 transformation matrix.
+/// @param tfrm   3x4 transformation matrix
+/// @param in   3D points
+/// @param out   Transformed 3D points
+/// @param count   Number of points
+///
+SCE_VECTORMATH_INLINE void transformPoints(Aos::Transform3_arg tfrm, const Stream3 &in, const Stream3 &out, uint32_t count);
+
+/// @short
+/// Transform a stream of 3D vectors by a 3x3 matrix
+///
+/// Multiply each vector by a 3x3 matrix.
+/// @param mat   3x3 matrix
+/// @param in   3D vectors
+/// @param out   Transformed 3D vectors
+/// @param count   Number of vectors
+///
+SCE_VECTORMATH_INLINE void transformVectors(Aos::Matrix3_arg mat, const Stream3 &in, const Stream3 &out, uint32_t count);
+
+#if !defined(SCE_VECTORMATH_NO_MATH_DEFS)
+
+/// @short
+/// Transform and renormalize a stream of normals
+///
+/// Multiply each normal by a 3x3 matrix and normalize the result. For a non-uniformly scaled transform, pass the inverse transpose of its upper 3x3.
+/// @param mat   3x3 matrix
+/// @param in   Normals
+/// @param out   Transformed unit-length normals
+/// @param count   Number of normals
+/// @note
+/// The result is unpredictable when a transformed normal has zero length.
+///
+SCE_VECTORMATH_INLINE void transformNormals(Aos::Matrix3_arg mat, const Stream3 &in, const Stream3 &out, uint32_t count);
+
+#endif	/* !defined(SCE_VECTORMATH_NO_MATH_DEFS) */
+
+/// @short
+/// Test a stream of bounding spheres against a set of planes
+///
+/// A sphere is visible when it is not entirely behind any plane. A plane (a, b, c, d) keeps the points with a*x + b*y + c*z + d >= 0.
+/// @param planes   Planes, typically the six planes of a view frustum
+/// @param numPlanes   Number of planes
+/// @param spheres   Sphere centers in x, y, z and radii in w
+/// @param visible   Receives 1 for every visible sphere and 0 for every culled sphere
+/// @param count   Number of spheres
+/// @return
+/// The number of visible spheres
+///
+SCE_VECTORMATH_INLINE uint32_t cullSpheres(const Aos::Vector4 *planes, uint32_t numPlanes, const Stream4 &spheres, uint8_t *visible, uint32_t count);
+
+#if !defined(SCE_VECTORMATH_NO_MATH_DEFS)
+
+/// @short
+/// Normalize a stream of quaternions
+///
+/// Normalize each quaternion.
+/// @param in   Quaternions
+/// @param out   Unit-length quaternions
+/// @param count   Number of quaternions
+/// @note
+/// The result is unpredictable when a quaternion has zero length.
+///
+SCE_VECTORMATH_INLINE void normalizeQuats(const Stream4 &in, const Stream4 &out, uint32_t count);
+
+/// @short
+/// Spherical linear interpolation between two streams of unit-length quaternions
+///
+/// Interpolate each pair of quaternions like <code>Aos::slerp</code>, taking the shortest path.
+/// @param t   Interpolation parameter
+/// @param unitQuat0   Unit-length quaternions
+/// @param unitQuat1   Unit-length quaternions
+/// @param out   Interpolated quaternions
+/// @param count   Number of quaternions
+/// @param tol   Above this cosine the interpolation falls back to a linear one
+///
+SCE_VECTORMATH_INLINE void slerpQuats(float t, const Stream4 &unitQuat0, const Stream4 &unitQuat1, const Stream4 &out, uint32_t count, float tol = SCE_VECTORMATH_DEFAULT_SLERP_TOL_F);
+
+#endif	/* !defined(SCE_VECTORMATH_NO_MATH_DEFS) */
+
+//-----------------------------------------------------------------------------
+// Definitions
+
+SCE_VECTORMATH_INLINE void transformPoints(Aos::Matrix4_arg mat, const Stream3 &in, const Stream4 &out, uint32_t count)
+{
+	const float m00 = mat.getCol0().getX().getAsFloat(), m01 = mat.getCol1().getX().getAsFloat(), m02 = mat.getCol2().getX().getAsFloat(), m03 = mat.getCol3().getX().getAsFloat();
+	const float m10 = mat.getCol0().getY().getAsFloat(), m11 = mat.getCol1().getY().getAsFloat(), m12 = mat.getCol2().getY().getAsFloat(), m13 = mat.getCol3().getY().getAsFloat();
+	const float m20 = mat.getCol0().getZ().getAsFloat(), m21 = mat.getCol1().getZ().getAsFloat(), m22 = mat.getCol2().getZ().getAsFloat(), m23 = mat.getCol3().getZ().getAsFloat();
+	const float m30 = mat.getCol0().getW().getAsFloat(), m31 = mat.getCol1().getW().getAsFloat(), m32 = mat.getCol2().getW().getAsFloat(), m33 = mat.getCol3().getW().getAsFloat();
+	for (uint32_t i = 0; i < count; i++) {
+		const float x = in.x[i], y = in.y[i], z = in.z[i];
+		out.x[i] = ( ( ( ( m00 * x ) + ( m01 * y ) ) + ( m02 * z ) ) + m03 );
+		out.y[i] = ( ( ( ( m10 * x ) + ( m11 * y ) ) + ( m12 * z ) ) + m13 );
+		out.z[i] = ( ( ( ( m20 * x ) + ( m21 * y ) ) + ( m22 * z ) ) + m23 );
+		out.w[i] = ( ( ( ( m30 * x ) + ( m31 * y ) ) + ( m32 * z ) ) + m33 );
+	}
+}
+
+SCE_VECTORMATH_INLINE void transformPoints(Aos::Transform3_arg tfrm, const Stream3 &in, const Stream3 &out, uint32_t count)
+{
+	const float m00 = tfrm.getCol0().getX().getAsFloat(), m01 = tfrm.getCol1().getX().getAsFloat(), m02 = tfrm.getCol2().getX().getAsFloat(), m03 = tfrm.getCol3().getX().getAsFloat();
+	const float m10 = tfrm.getCol0().getY().getAsFloat(), m11 = tfrm.getCol1().getY().getAsFloat(), m12 = tfrm.getCol2().getY().getAsFloat(), m13 = tfrm.getCol3().getY().getAsFloat();
+	const float m20 = tfrm.getCol0().getZ().getAsFloat(), m21 = tfrm.getCol1().getZ().getAsFloat(), m22 = tfrm.getCol2().getZ().getAsFloat(), m23 = tfrm.getCol3().getZ().getAsFloat();
+	for (uint32_t i = 0; i < count; i++) {
+		const float x = in.x[i], y = in.y[i], z = in.z[i];
+		out.x[i] = ( ( ( ( m00 * x ) + ( m01 * y ) ) + ( m02 * z ) ) + m03 );
+		out.y[i] = ( ( ( ( m10 * x ) + ( m11 * y ) ) + ( m12 * z ) ) + m13 );
+		out.z[i] = ( ( ( ( m20 * x ) + ( m21 * y ) ) + ( m22 * z ) ) + m23 );
+	}
+}
+
+SCE_VECTORMATH_INLINE void transformVectors(Aos::Matrix3_arg mat, const Stream3 &in, const Stream3 &out, uint32_t count)
+{
+	const float m00 = mat.getCol0().getX().getAsFloat(), m01 = mat.getCol1().getX().getAsFloat(), m02 = mat.getCol2().getX().getAsFloat();
+	const float m10 = mat.getCol0().getY().getAsFloat(), m11 = mat.getCol1().getY().getAsFloat(), m12 = mat.getCol2().getY().getAsFloat();
+	const float m20 = mat.getCol0().getZ().getAsFloat(), m21 = mat.getCol1().getZ().getAsFloat(), m22 = mat.getCol2().getZ().getAsFloat();
+	for (uint32_t i = 0; i < count; i++) {
+		const float x = in.x[i], y = in.y[i], z = in.z[i];
+		out.x[i] = ( ( ( m00 * x ) + ( m01 * y ) ) + ( m02 * z ) );
+		out.y[i] = ( ( ( m10 * x ) + ( m11 * y ) ) + ( m12 * z ) );
+		out.z[i] = ( ( ( m20 * x ) + ( m21 * y ) ) + ( m22 * z ) );
+	}
+}
+
+#if !defined(SCE_VECTORMATH_NO_MATH_DEFS)
+
+SCE_VECTORMATH_INLINE void transformNormals(Aos::Matrix3_arg mat, const Stream3 &in, const Stream3 &out, uint32_t count)
+{
+	transformVectors(mat, in, out, count);
+	for (uint32_t i = 0; i < count; i++) {
+		const float x = out.x[i], y = out.y[i], z = out.z[i];
+		const float lenInv = 1.0f / ::sqrtf( ( ( x * x ) + ( y * y ) ) + ( z * z ) );
+		out.x[i] = x * lenInv;
+		out.y[i] = y * lenInv;
+		out.z[i] = z * lenInv;
+	}
+}
+
+#endif	/* !defined(SCE_VECTORMATH_NO_MATH_DEFS) */
+
+SCE_VECTORMATH_INLINE uint32_t cullSpheres(const Aos::Vector4 *planes, uint32_t numPlanes, const Stream4 &spheres, uint8_t *visible, uint32_t count)
+{
+	uint32_t numVisible = 0;
+	for (uint32_t i = 0; i < count; i++) {
+		const float x = spheres.x[i], y = spheres.y[i], z = spheres.z[i], negRadius = -spheres.w[i];
+		uint8_t inside = 1;
+		for (uint32_t p = 0; p < numPlanes; p++) {
+			const float dist = ( ( ( ( planes[p].getX().getAsFloat() * x ) + ( planes[p].getY().getAsFloat() * y ) ) + ( planes[p].getZ().getAsFloat() * z ) ) + planes[p].getW().getAsFloat() );
+			if (dist < negRadius) {
+				inside = 0;
+				break;
+			}
+		}
+		visible[i] = inside;
+		numVisible += inside;
+	}
+	return numVisible;
+}
+
+#if !defined(SCE_VECTORMATH_NO_MATH_DEFS)
+
+SCE_VECTORMATH_INLINE void normalizeQuats(const Stream4 &in, const Stream4 &out, uint32_t count)
+{
+	for (uint32_t i = 0; i < count; i++) {
+		const float x = in.x[i], y = in.y[i], z = in.z[i], w = in.w[i];
+		const float lenInv = 1.0f / ::sqrtf( ( ( ( x * x ) + ( y * y ) ) + ( z * z ) ) + ( w * w ) );
+		out.x[i] = x * lenInv;
+		out.y[i] = y * lenInv;
+		out.z[i] = z * lenInv;
+		out.w[i] = w * lenInv;
+	}
+}
+
+SCE_VECTORMATH_INLINE void slerpQuats(float t, const Stream4 &unitQuat0, const Stream4 &unitQuat1, const Stream4 &out, uint32_t count, float tol)
+{
+	for (uint32_t i = 0; i < count; i++) {
+		const Aos::Quat quat0( unitQuat0.x[i], unitQuat0.y[i], unitQuat0.z[i], unitQuat0.w[i] );
+		const Aos::Quat quat1( unitQuat1.x[i], unitQuat1.y[i], unitQuat1.z[i], unitQuat1.w[i] );
+		const Aos::Quat res = Aos::slerp( t, quat0, quat1, tol );
+		out.x[i] = res.getX().getAsFloat();
+		out.y[i] = res.getY().getAsFloat();
+		out.z[i] = res.getZ().getAsFloat();
+		out.w[i] = res.getW().getAsFloat();
+	}
+}
+
+#endif	/* !defined(SCE_VECTORMATH_NO_MATH_DEFS) */
+
+} // namespace Soa
+} // namespace Scalar
+} // namespace Vectormath
+} // namespace sce
+
+#endif /* _PSP2_VECTORMATH_SCALAR_BATCH_SOA_CPP_H_ */
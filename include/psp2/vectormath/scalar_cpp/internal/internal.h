@@ -21,7 +21,11 @@
 #define SCE_VECTORMATH_PREALIGN_16
 #define SCE_VECTORMATH_POSTALIGN_16 __attribute__ ((aligned(16)))
 #define SCE_VECTORMATH_ALWAYS_INLINE inline __attribute__((always_inline))
-#define SCE_VECTORMATH_INLINE
+#if defined(SCE_VECTORMATH_FORCE_INLINE)
+#define SCE_VECTORMATH_INLINE SCE_VECTORMATH_ALWAYS_INLINE
+#else
+#define SCE_VECTORMATH_INLINE inline
+#endif
 #define SCE_VECTORMATH_NO_INLINE __attribute__((noinline))
 #define SCE_VECTORMATH_UNUSED
 #define SCE_VECTORMATH_IS_COMPILE_TIME_CONSTANT( x ) __builtin_constant_p(x)
@@ -33,12 +37,14 @@
 
 //-----------------------------------------------------------------------------
 // Platform-specific Argument Types
-//#if defined(_MSC_VER)
+// Vectors and matrices are passed by value where the ABI can keep them in
+// registers, which lets inlined calls avoid the round trip through memory.
+#if defined(_MSC_VER)
   #define SCE_VECTORMATH_SCALAR_AOS_FLOATINVEC_ARG
   #define SCE_VECTORMATH_SCALAR_AOS_BOOLINVEC_ARG
   #define SCE_VECTORMATH_SCALAR_AOS_VECTOR_ARG &
   #define SCE_VECTORMATH_SCALAR_AOS_MATRIX_ARG &
-/*#elif defined(__SSE2__)
+#elif defined(__SSE2__)
   #define SCE_VECTORMATH_SCALAR_AOS_FLOATINVEC_ARG
   #define SCE_VECTORMATH_SCALAR_AOS_BOOLINVEC_ARG
   #define SCE_VECTORMATH_SCALAR_AOS_VECTOR_ARG
@@ -48,19 +54,12 @@
   #define SCE_VECTORMATH_SCALAR_AOS_BOOLINVEC_ARG
   #define SCE_VECTORMATH_SCALAR_AOS_VECTOR_ARG
   #define SCE_VECTORMATH_SCALAR_AOS_MATRIX_ARG
-#elif defined(__ALTIVEC__) || defined(__PPU__)
-  #define SCE_VECTORMATH_SCALAR_AOS_FLOATINVEC_ARG
-  #define SCE_VECTORMATH_SCALAR_AOS_BOOLINVEC_ARG
-  #define SCE_VECTORMATH_SCALAR_AOS_VECTOR_ARG
-  #define SCE_VECTORMATH_SCALAR_AOS_MATRIX_ARG
-#elif defined(__SPU__)
+#else
   #define SCE_VECTORMATH_SCALAR_AOS_FLOATINVEC_ARG
   #define SCE_VECTORMATH_SCALAR_AOS_BOOLINVEC_ARG
-  #define SCE_VECTORMATH_SCALAR_AOS_VECTOR_ARG
-  #define SCE_VECTORMATH_SCALAR_AOS_MATRIX_ARG
-#else
-  #error unsupported environment
-#endif*/
+  #define SCE_VECTORMATH_SCALAR_AOS_VECTOR_ARG &
+  #define SCE_VECTORMATH_SCALAR_AOS_MATRIX_ARG &
+#endif
 
 //-----------------------------------------------------------------------------
 // Default Assert Stub
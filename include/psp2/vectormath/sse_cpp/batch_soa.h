@@ -0,0 +1,333 @@
+﻿/**
+ * \file batch_soa.h
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+
+#ifndef _PSP2_VECTORMATH_SSE_BATCH_SOA_CPP_H_
+#define _PSP2_VECTORMATH_SSE_BATCH_SOA_CPP_H_
+
+#include <psp2/vectormath/sse_cpp/vectormath_aos.h>
+
+namespace sce {
+namespace Vectormath {
+namespace Sse {
+
+/// @short
+/// The namespace containing the batch (structure-of-arrays) entry points.
+///
+/// The namespace containing the batch (structure-of-arrays) entry points.
+/// Each function processes <code>count</code> elements stored as separate
+/// x, y, z (and w) arrays. Inputs are only read, so an output stream may
+/// alias the corresponding input stream to transform in place.
+///
+namespace Soa {
+
+/// @short
+/// A stream of 3-element values in structure-of-arrays format
+///
+/// A stream of 3-element values stored as three separate float arrays.
+///
+struct Stream3
+{
+	float *x;	//!< Array of x elements
+	float *y;	//!< Array of y elements
+	float *z;	//!< Array of z elements
+};
+
+/// @short
+/// A stream of 4-element values in structure-of-arrays format
+///
+/// A stream of 4-element values stored as four separate float arrays.
+///
+struct Stream4
+{
+	float *x;	//!< Array of x elements
+	float *y;	//!< Array of y elements
+	float *z;	//!< Array of z elements
+	float *w;	//!< Array of w elements
+};
+
+/// @short
+/// Transform a stream of 3D points by a 4x4 matrix
+///
+/// Multiply each point (with an implied w of 1) by a 4x4 matrix and store the homogeneous result.
+/// @param mat   4x4 matrix
+/// @param in   3D points
+/// @param out   Transformed 4D points
+/// @param count   Number of points
+///
+SCE_VECTORMATH_INLINE void transformPoints(Aos::Matrix4_arg mat, const Stream3 &in, const Stream4 &out, uint32_t count);
+
+/// @short
+/// Transform a stream of 3D points by a 3x4 transformation matrix
+///
+/// Multiply each point (with an implied w of 1) by a 3x4 transformation matrix.
+/// @param tfrm   3x4 transformation matrix
+/// @param in   3D points
+/// @param out   Transformed 3D points
+/// @param count   Number of points
+///
+SCE_VECTORMATH_INLINE void transformPoints(Aos::Transform3_arg tfrm, const Stream3 &in, const Stream3 &out, uint32_t count);
+
+/// @short
+/// Transform a stream of 3D vectors by a 3x3 matrix
+///
+/// Multiply each vector by a 3x3 matrix.
+/// @param mat   3x3 matrix
+/// @param in   3D vectors
+/// @param out   Transformed 3D vectors
+/// @param count   Number of vectors
+///
+SCE_VECTORMATH_INLINE void transformVectors(Aos::Matrix3_arg mat, const Stream3 &in, const Stream3 &out, uint32_t count);
+
+#if !defined(SCE_VECTORMATH_NO_MATH_DEFS)
+
+/// @short
+/// Transform and renormalize a stream of normals
+///
+/// Multiply each normal by a 3x3 matrix and normalize the result. For a non-uniformly scaled transform, pass the inverse transpose of its upper 3x3.
+/// @param mat   3x3 matrix
+/// @param in   Normals
+/// @param out   Transformed unit-length normals
+/// @param count   Number of normals
+/// @note
+/// The result is unpredictable when a transformed normal has zero length.
+///
+SCE_VECTORMATH_INLINE void transformNormals(Aos::Matrix3_arg mat, const Stream3 &in, const Stream3 &out, uint32_t count);
+
+#endif	/* !defined(SCE_VECTORMATH_NO_MATH_DEFS) */
+
+/// @short
+/// Test a stream of bounding spheres against a set of planes
+///
+/// A sphere is visible when it is not entirely behind any plane. A plane (a, b, c, d) keeps the points with a*x + b*y + c*z + d >= 0.
+/// @param planes   Planes, typically the six planes of a view frustum
+/// @param numPlanes   Number of planes
+/// @param spheres   Sphere centers in x, y, z and radii in w
+/// @param visible   Receives 1 for every visible sphere and 0 for every culled sphere
+/// @param count   Number of spheres
+/// @return
+/// The number of visible spheres
+///
+SCE_VECTORMATH_INLINE uint32_t cullSpheres(const Aos::Vector4 *planes, uint32_t numPlanes, const Stream4 &spheres, uint8_t *visible, uint32_t count);
+
+#if !defined(SCE_VECTORMATH_NO_MATH_DEFS)
+
+/// @short
+/// Normalize a stream of quaternions
+///
+/// Normalize each quaternion.
+/// @param in   Quaternions
+/// @param out   Unit-length quaternions
+/// @param count   Number of quaternions
+/// @note
+/// The result is unpredictable when a quaternion has zero length.
+///
+SCE_VECTORMATH_INLINE void normalizeQuats(const Stream4 &in, const Stream4 &out, uint32_t count);
+
+/// @short
+/// Spherical linear interpolation between two streams of unit-length quaternions
+///
+/// Interpolate each pair of quaternions like <code>Aos::slerp</code>, taking the shortest path.
+/// @param t   Interpolation parameter
+/// @param unitQuat0   Unit-length quaternions
+/// @param unitQuat1   Unit-length quaternions
+/// @param out   Interpolated quaternions
+/// @param count   Number of quaternions
+/// @param tol   Above this cosine the interpolation falls back to a linear one
+///
+SCE_VECTORMATH_INLINE void slerpQuats(float t, const Stream4 &unitQuat0, const Stream4 &unitQuat1, const Stream4 &out, uint32_t count, float tol = SCE_VECTORMATH_DEFAULT_SLERP_TOL_F);
+
+#endif	/* !defined(SCE_VECTORMATH_NO_MATH_DEFS) */
+
+//-----------------------------------------------------------------------------
+// Definitions
+
+SCE_VECTORMATH_INLINE void transformPoints(Aos::Matrix4_arg mat, const Stream3 &in, const Stream4 &out, uint32_t count)
+{
+	const __m128 col0 = mat.getCol0().get128();
+	const __m128 col1 = mat.getCol1().get128();
+	const __m128 col2 = mat.getCol2().get128();
+	const __m128 col3 = mat.getCol3().get128();
+	const __m128 m00 = SCE_VECTORMATH_SSE_SPLAT(col0, 0), m01 = SCE_VECTORMATH_SSE_SPLAT(col1, 0), m02 = SCE_VECTORMATH_SSE_SPLAT(col2, 0), m03 = SCE_VECTORMATH_SSE_SPLAT(col3, 0);
+	const __m128 m10 = SCE_VECTORMATH_SSE_SPLAT(col0, 1), m11 = SCE_VECTORMATH_SSE_SPLAT(col1, 1), m12 = SCE_VECTORMATH_SSE_SPLAT(col2, 1), m13 = SCE_VECTORMATH_SSE_SPLAT(col3, 1);
+	const __m128 m20 = SCE_VECTORMATH_SSE_SPLAT(col0, 2), m21 = SCE_VECTORMATH_SSE_SPLAT(col1, 2), m22 = SCE_VECTORMATH_SSE_SPLAT(col2, 2), m23 = SCE_VECTORMATH_SSE_SPLAT(col3, 2);
+	const __m128 m30 = SCE_VECTORMATH_SSE_SPLAT(col0, 3), m31 = SCE_VECTORMATH_SSE_SPLAT(col1, 3), m32 = SCE_VECTORMATH_SSE_SPLAT(col2, 3), m33 = SCE_VECTORMATH_SSE_SPLAT(col3, 3);
+	for (uint32_t i = 0; i < count; i += 4) {
+		const uint32_t n = count - i;
+		const __m128 x = Internal::load4(in.x + i, n, 0.0f);
+		const __m128 y = Internal::load4(in.y + i, n, 0.0f);
+		const __m128 z = Internal::load4(in.z + i, n, 0.0f);
+		Internal::store4(out.x + i, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m00, x), _mm_mul_ps(m01, y)), _mm_mul_ps(m02, z)), m03), n);
+		Internal::store4(out.y + i, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m10, x), _mm_mul_ps(m11, y)), _mm_mul_ps(m12, z)), m13), n);
+		Internal::store4(out.z + i, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m20, x), _mm_mul_ps(m21, y)), _mm_mul_ps(m22, z)), m23), n);
+		Internal::store4(out.w + i, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m30, x), _mm_mul_ps(m31, y)), _mm_mul_ps(m32, z)), m33), n);
+	}
+}
+
+SCE_VECTORMATH_INLINE void transformPoints(Aos::Transform3_arg tfrm, const Stream3 &in, const Stream3 &out, uint32_t count)
+{
+	const __m128 col0 = tfrm.getCol0().get128();
+	const __m128 col1 = tfrm.getCol1().get128();
+	const __m128 col2 = tfrm.getCol2().get128();
+	const __m128 col3 = tfrm.getCol3().get128();
+	const __m128 m00 = SCE_VECTORMATH_SSE_SPLAT(col0, 0), m01 = SCE_VECTORMATH_SSE_SPLAT(col1, 0), m02 = SCE_VECTORMATH_SSE_SPLAT(col2, 0), m03 = SCE_VECTORMATH_SSE_SPLAT(col3, 0);
+	const __m128 m10 = SCE_VECTORMATH_SSE_SPLAT(col0, 1), m11 = SCE_VECTORMATH_SSE_SPLAT(col1, 1), m12 = SCE_VECTORMATH_SSE_SPLAT(col2, 1), m13 = SCE_VECTORMATH_SSE_SPLAT(col3, 1);
+	const __m128 m20 = SCE_VECTORMATH_SSE_SPLAT(col0, 2), m21 = SCE_VECTORMATH_SSE_SPLAT(col1, 2), m22 = SCE_VECTORMATH_SSE_SPLAT(col2, 2), m23 = SCE_VECTORMATH_SSE_SPLAT(col3, 2);
+	for (uint32_t i = 0; i < count; i += 4) {
+		const uint32_t n = count - i;
+		const __m128 x = Internal::load4(in.x + i, n, 0.0f);
+		const __m128 y = Internal::load4(in.y + i, n, 0.0f);
+		const __m128 z = Internal::load4(in.z + i, n, 0.0f);
+		Internal::store4(out.x + i, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m00, x), _mm_mul_ps(m01, y)), _mm_mul_ps(m02, z)), m03), n);
+		Internal::store4(out.y + i, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m10, x), _mm_mul_ps(m11, y)), _mm_mul_ps(m12, z)), m13), n);
+		Internal::store4(out.z + i, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m20, x), _mm_mul_ps(m21, y)), _mm_mul_ps(m22, z)), m23), n);
+	}
+}
+
+SCE_VECTORMATH_INLINE void transformVectors(Aos::Matrix3_arg mat, const Stream3 &in, const Stream3 &out, uint32_t count)
+{
+	const __m128 col0 = mat.getCol0().get128();
+	const __m128 col1 = mat.getCol1().get128();
+	const __m128 col2 = mat.getCol2().get128();
+	const __m128 m00 = SCE_VECTORMATH_SSE_SPLAT(col0, 0), m01 = SCE_VECTORMATH_SSE_SPLAT(col1, 0), m02 = SCE_VECTORMATH_SSE_SPLAT(col2, 0);
+	const __m128 m10 = SCE_VECTORMATH_SSE_SPLAT(col0, 1), m11 = SCE_VECTORMATH_SSE_SPLAT(col1, 1), m12 = SCE_VECTORMATH_SSE_SPLAT(col2, 1);
+	const __m128 m20 = SCE_VECTORMATH_SSE_SPLAT(col0, 2), m21 = SCE_VECTORMATH_SSE_SPLAT(col1, 2), m22 = SCE_VECTORMATH_SSE_SPLAT(col2, 2);
+	for (uint32_t i = 0; i < count; i += 4) {
+		const uint32_t n = count - i;
+		const __m128 x = Internal::load4(in.x + i, n, 0.0f);
+		const __m128 y = Internal::load4(in.y + i, n, 0.0f);
+		const __m128 z = Internal::load4(in.z + i, n, 0.0f);
+		Internal::store4(out.x + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(m00, x), _mm_mul_ps(m01, y)), _mm_mul_ps(m02, z)), n);
+		Internal::store4(out.y + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(m10, x), _mm_mul_ps(m11, y)), _mm_mul_ps(m12, z)), n);
+		Internal::store4(out.z + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(m20, x), _mm_mul_ps(m21, y)), _mm_mul_ps(m22, z)), n);
+	}
+}
+
+#if !defined(SCE_VECTORMATH_NO_MATH_DEFS)
+
+SCE_VECTORMATH_INLINE void transformNormals(Aos::Matrix3_arg mat, const Stream3 &in, const Stream3 &out, uint32_t count)
+{
+	const __m128 col0 = mat.getCol0().get128();
+	const __m128 col1 = mat.getCol1().get128();
+	const __m128 col2 = mat.getCol2().get128();
+	const __m128 m00 = SCE_VECTORMATH_SSE_SPLAT(col0, 0), m01 = SCE_VECTORMATH_SSE_SPLAT(col1, 0), m02 = SCE_VECTORMATH_SSE_SPLAT(col2, 0);
+	const __m128 m10 = SCE_VECTORMATH_SSE_SPLAT(col0, 1), m11 = SCE_VECTORMATH_SSE_SPLAT(col1, 1), m12 = SCE_VECTORMATH_SSE_SPLAT(col2, 1);
+	const __m128 m20 = SCE_VECTORMATH_SSE_SPLAT(col0, 2), m21 = SCE_VECTORMATH_SSE_SPLAT(col1, 2), m22 = SCE_VECTORMATH_SSE_SPLAT(col2, 2);
+	for (uint32_t i = 0; i < count; i += 4) {
+		const uint32_t n = count - i;
+		// Pad with a unit normal so that the unused lanes never divide by zero
+		const __m128 x = Internal::load4(in.x + i, n, 1.0f);
+		const __m128 y = Internal::load4(in.y + i, n, 0.0f);
+		const __m128 z = Internal::load4(in.z + i, n, 0.0f);
+		const __m128 resX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m00, x), _mm_mul_ps(m01, y)), _mm_mul_ps(m02, z));
+		const __m128 resY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m10, x), _mm_mul_ps(m11, y)), _mm_mul_ps(m12, z));
+		const __m128 resZ = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m20, x), _mm_mul_ps(m21, y)), _mm_mul_ps(m22, z));
+		const __m128 lenInv = Internal::rsqrt4(_mm_add_ps(_mm_add_ps(_mm_mul_ps(resX, resX), _mm_mul_ps(resY, resY)), _mm_mul_ps(resZ, resZ)));
+		Internal::store4(out.x + i, _mm_mul_ps(resX, lenInv), n);
+		Internal::store4(out.y + i, _mm_mul_ps(resY, lenInv), n);
+		Internal::store4(out.z + i, _mm_mul_ps(resZ, lenInv), n);
+	}
+}
+
+#endif	/* !defined(SCE_VECTORMATH_NO_MATH_DEFS) */
+
+SCE_VECTORMATH_INLINE uint32_t cullSpheres(const Aos::Vector4 *planes, uint32_t numPlanes, const Stream4 &spheres, uint8_t *visible, uint32_t count)
+{
+	uint32_t numVisible = 0;
+	for (uint32_t i = 0; i < count; i += 4) {
+		const uint32_t n = count - i;
+		const __m128 x = Internal::load4(spheres.x + i, n, 0.0f);
+		const __m128 y = Internal::load4(spheres.y + i, n, 0.0f);
+		const __m128 z = Internal::load4(spheres.z + i, n, 0.0f);
+		const __m128 negRadius = _mm_sub_ps(_mm_setzero_ps(), Internal::load4(spheres.w + i, n, 0.0f));
+		__m128 culled = _mm_setzero_ps();
+		for (uint32_t p = 0; p < numPlanes; p++) {
+			const __m128 plane = planes[p].get128();
+			const __m128 dist = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+				_mm_mul_ps(SCE_VECTORMATH_SSE_SPLAT(plane, 0), x),
+				_mm_mul_ps(SCE_VECTORMATH_SSE_SPLAT(plane, 1), y)),
+				_mm_mul_ps(SCE_VECTORMATH_SSE_SPLAT(plane, 2), z)),
+				SCE_VECTORMATH_SSE_SPLAT(plane, 3));
+			culled = _mm_or_ps(culled, _mm_cmplt_ps(dist, negRadius));
+		}
+		const int mask = _mm_movemask_ps(culled);
+		for (uint32_t lane = 0; lane < 4 && lane < n; lane++) {
+			const uint8_t inside = ( ( mask >> lane ) & 1 ) ^ 1;
+			visible[i + lane] = inside;
+			numVisible += inside;
+		}
+	}
+	return numVisible;
+}
+
+#if !defined(SCE_VECTORMATH_NO_MATH_DEFS)
+
+SCE_VECTORMATH_INLINE void normalizeQuats(const Stream4 &in, const Stream4 &out, uint32_t count)
+{
+	for (uint32_t i = 0; i < count; i += 4) {
+		const uint32_t n = count - i;
+		// Pad with the identity so that the unused lanes never divide by zero
+		const __m128 x = Internal::load4(in.x + i, n, 0.0f);
+		const __m128 y = Internal::load4(in.y + i, n, 0.0f);
+		const __m128 z = Internal::load4(in.z + i, n, 0.0f);
+		const __m128 w = Internal::load4(in.w + i, n, 1.0f);
+		const __m128 lenInv = Internal::rsqrt4(_mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)), _mm_mul_ps(w, w)));
+		Internal::store4(out.x + i, _mm_mul_ps(x, lenInv), n);
+		Internal::store4(out.y + i, _mm_mul_ps(y, lenInv), n);
+		Internal::store4(out.z + i, _mm_mul_ps(z, lenInv), n);
+		Internal::store4(out.w + i, _mm_mul_ps(w, lenInv), n);
+	}
+}
+
+SCE_VECTORMATH_INLINE void slerpQuats(float t, const Stream4 &unitQuat0, const Stream4 &unitQuat1, const Stream4 &out, uint32_t count, float tol)
+{
+	for (uint32_t i = 0; i < count; i += 4) {
+		const uint32_t n = count - i;
+		const __m128 x0 = Internal::load4(unitQuat0.x + i, n, 0.0f);
+		const __m128 y0 = Internal::load4(unitQuat0.y + i, n, 0.0f);
+		const __m128 z0 = Internal::load4(unitQuat0.z + i, n, 0.0f);
+		const __m128 w0 = Internal::load4(unitQuat0.w + i, n, 1.0f);
+		const __m128 x1 = Internal::load4(unitQuat1.x + i, n, 0.0f);
+		const __m128 y1 = Internal::load4(unitQuat1.y + i, n, 0.0f);
+		const __m128 z1 = Internal::load4(unitQuat1.z + i, n, 0.0f);
+		const __m128 w1 = Internal::load4(unitQuat1.w + i, n, 1.0f);
+		float cosAngle[4], scale0[4], scale1[4];
+		_mm_storeu_ps(cosAngle, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x0, x1), _mm_mul_ps(y0, y1)), _mm_mul_ps(z0, z1)), _mm_mul_ps(w0, w1)));
+		// The trigonometry stays scalar; the sign of scale0 takes the shortest path
+		for (uint32_t lane = 0; lane < 4; lane++) {
+			const float sign = ( cosAngle[lane] < 0.0f ) ? -1.0f : 1.0f;
+			const float cosAbs = cosAngle[lane] * sign;
+			if ( cosAbs < tol ) {
+				const float angle = ::acosf( cosAbs );
+				const float recipSinAngle = ( 1.0f / ::sinf( angle ) );
+				scale0[lane] = ( ::sinf( ( ( 1.0f - t ) * angle ) ) * recipSinAngle ) * sign;
+				scale1[lane] = ( ::sinf( ( t * angle ) ) * recipSinAngle );
+			} else {
+				scale0[lane] = ( 1.0f - t ) * sign;
+				scale1[lane] = t;
+			}
+		}
+		const __m128 s0 = _mm_loadu_ps(scale0);
+		const __m128 s1 = _mm_loadu_ps(scale1);
+		Internal::store4(out.x + i, _mm_add_ps(_mm_mul_ps(x0, s0), _mm_mul_ps(x1, s1)), n);
+		Internal::store4(out.y + i, _mm_add_ps(_mm_mul_ps(y0, s0), _mm_mul_ps(y1, s1)), n);
+		Internal::store4(out.z + i, _mm_add_ps(_mm_mul_ps(z0, s0), _mm_mul_ps(z1, s1)), n);
+		Internal::store4(out.w + i, _mm_add_ps(_mm_mul_ps(w0, s0), _mm_mul_ps(w1, s1)), n);
+	}
+}
+
+#endif	/* !defined(SCE_VECTORMATH_NO_MATH_DEFS) */
+
+} // namespace Soa
+} // namespace Sse
+} // namespace Vectormath
+} // namespace sce
+
+#endif /* _PSP2_VECTORMATH_SSE_BATCH_SOA_CPP_H_ */
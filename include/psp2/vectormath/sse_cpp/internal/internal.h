@@ -0,0 +1,144 @@
+﻿/**
+ * \file internal.h
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+
+#ifndef _PSP2_VECTORMATH_SSE_INTERNAL_H_
+#define _PSP2_VECTORMATH_SSE_INTERNAL_H_
+
+#if !defined(SCE_VECTORMATH_NO_MATH_DEFS)
+#include <math.h>
+#endif	/* !defined(SCE_VECTORMATH_NO_MATH_DEFS) */
+
+//-----------------------------------------------------------------------------
+// Alignment and Inlining Control
+#define SCE_VECTORMATH_PREALIGN_16
+#define SCE_VECTORMATH_POSTALIGN_16 __attribute__ ((aligned(16)))
+#define SCE_VECTORMATH_ALWAYS_INLINE inline __attribute__((always_inline))
+#if defined(SCE_VECTORMATH_FORCE_INLINE)
+#define SCE_VECTORMATH_INLINE SCE_VECTORMATH_ALWAYS_INLINE
+#else
+#define SCE_VECTORMATH_INLINE inline
+#endif
+#define SCE_VECTORMATH_NO_INLINE __attribute__((noinline))
+#define SCE_VECTORMATH_UNUSED
+#define SCE_VECTORMATH_IS_COMPILE_TIME_CONSTANT( x ) __builtin_constant_p(x)
+
+
+//-----------------------------------------------------------------------------
+// Platform-specific Type Inclusion
+#include <psp2/vectormath/sse_cpp/internal/internal_types.h>
+#include <xmmintrin.h>
+
+//-----------------------------------------------------------------------------
+// Platform-specific Argument Types
+// Vectors are passed by value in the XMM registers, which lets inlined calls
+// avoid the round trip through memory.  Matrices are passed by reference,
+// since not every x86 ABI passes four __m128 in registers.
+#define SCE_VECTORMATH_SSE_AOS_FLOATINVEC_ARG
+#define SCE_VECTORMATH_SSE_AOS_BOOLINVEC_ARG
+#define SCE_VECTORMATH_SSE_AOS_VECTOR_ARG
+#define SCE_VECTORMATH_SSE_AOS_MATRIX_ARG &
+
+//-----------------------------------------------------------------------------
+// Default Assert Stub
+#if !defined(SCE_VECTORMATH_ASSERT_MSG)
+#define SCE_VECTORMATH_ASSERT_MSG(condition,message)	(void)(condition)
+#endif	//	#if !(defined SCE_VECTORMATH_ASSERT_MSG)
+
+//-----------------------------------------------------------------------------
+// SSE Helpers
+namespace sce {
+namespace Vectormath {
+namespace Sse {
+namespace Internal {
+
+// Broadcast one lane of a register to all four lanes
+#define SCE_VECTORMATH_SSE_SPLAT(vec, lane) _mm_shuffle_ps((vec), (vec), _MM_SHUFFLE(lane, lane, lane, lane))
+
+// Sum of the products of all four lanes, returned in all lanes
+SCE_VECTORMATH_ALWAYS_INLINE __m128 dot4(__m128 vec0, __m128 vec1)
+{
+	__m128 prod = _mm_mul_ps(vec0, vec1);
+	__m128 sum = _mm_add_ps(prod, _mm_shuffle_ps(prod, prod, _MM_SHUFFLE(2, 3, 0, 1)));
+	return _mm_add_ps(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 0, 3, 2)));
+}
+
+// Sum of the products of the x, y and z lanes, returned in all lanes
+SCE_VECTORMATH_ALWAYS_INLINE __m128 dot3(__m128 vec0, __m128 vec1)
+{
+	__m128 prod = _mm_mul_ps(vec0, vec1);
+	__m128 sum = _mm_add_ps(SCE_VECTORMATH_SSE_SPLAT(prod, 0), SCE_VECTORMATH_SSE_SPLAT(prod, 1));
+	return _mm_add_ps(sum, SCE_VECTORMATH_SSE_SPLAT(prod, 2));
+}
+
+// Reciprocal square root of four lanes. The estimate instruction is only
+// good for 12 bits, so divide by the exact root to stay close to Scalar.
+SCE_VECTORMATH_ALWAYS_INLINE __m128 rsqrt4(__m128 x)
+{
+	return _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(x));
+}
+
+// Load four floats, or the first n of them with the other lanes set to pad
+SCE_VECTORMATH_ALWAYS_INLINE __m128 load4(const float *p, uint32_t n, float pad)
+{
+	if (n >= 4)
+		return _mm_loadu_ps(p);
+
+	float tmp[4] = { pad, pad, pad, pad };
+	for (uint32_t i = 0; i < n; i++)
+		tmp[i] = p[i];
+	return _mm_loadu_ps(tmp);
+}
+
+// Store four floats, or only the first n of them
+SCE_VECTORMATH_ALWAYS_INLINE void store4(float *p, __m128 vec, uint32_t n)
+{
+	if (n >= 4) {
+		_mm_storeu_ps(p, vec);
+		return;
+	}
+
+	float tmp[4];
+	_mm_storeu_ps(tmp, vec);
+	for (uint32_t i = 0; i < n; i++)
+		p[i] = tmp[i];
+}
+
+// Linear combination col0 * x + col1 * y + col2 * z + col3 * w
+SCE_VECTORMATH_ALWAYS_INLINE __m128 transform4(__m128 col0, __m128 col1, __m128 col2, __m128 col3, __m128 vec)
+{
+	__m128 res = _mm_mul_ps(col0, SCE_VECTORMATH_SSE_SPLAT(vec, 0));
+	res = _mm_add_ps(res, _mm_mul_ps(col1, SCE_VECTORMATH_SSE_SPLAT(vec, 1)));
+	res = _mm_add_ps(res, _mm_mul_ps(col2, SCE_VECTORMATH_SSE_SPLAT(vec, 2)));
+	return _mm_add_ps(res, _mm_mul_ps(col3, SCE_VECTORMATH_SSE_SPLAT(vec, 3)));
+}
+
+// Linear combination col0 * x + col1 * y + col2 * z + col3
+SCE_VECTORMATH_ALWAYS_INLINE __m128 transformPoint(__m128 col0, __m128 col1, __m128 col2, __m128 col3, __m128 pnt)
+{
+	__m128 res = _mm_add_ps(col3, _mm_mul_ps(col0, SCE_VECTORMATH_SSE_SPLAT(pnt, 0)));
+	res = _mm_add_ps(res, _mm_mul_ps(col1, SCE_VECTORMATH_SSE_SPLAT(pnt, 1)));
+	return _mm_add_ps(res, _mm_mul_ps(col2, SCE_VECTORMATH_SSE_SPLAT(pnt, 2)));
+}
+
+// Linear combination col0 * x + col1 * y + col2 * z
+SCE_VECTORMATH_ALWAYS_INLINE __m128 transformVector(__m128 col0, __m128 col1, __m128 col2, __m128 vec)
+{
+	__m128 res = _mm_mul_ps(col0, SCE_VECTORMATH_SSE_SPLAT(vec, 0));
+	res = _mm_add_ps(res, _mm_mul_ps(col1, SCE_VECTORMATH_SSE_SPLAT(vec, 1)));
+	return _mm_add_ps(res, _mm_mul_ps(col2, SCE_VECTORMATH_SSE_SPLAT(vec, 2)));
+}
+
+} // namespace Internal
+} // namespace Sse
+} // namespace Vectormath
+} // namespace sce
+
+#endif /* _PSP2_VECTORMATH_SSE_INTERNAL_H_ */
@@ -13,26 +13,32 @@ PHDRS
 	rela 0x60000000;
 }
 
+/* Each import of the stub libraries is a section group, so --gc-sections
+   drops the imports nothing calls. Its table sections are named after the
+   module and the symbol; sorting them by name makes the entries of each module
+   contiguous and in the same order in the stub, NID and reference tables. */
 SECTIONS
 {
-	.text : { *(.text) } :text
-	.sceStub.text : { *(.sceStub.text.*) } :text
+	.text : { *(.text .text.* .gnu.linkonce.t.*) } :text
+	.sceStub.text : { *(SORT(.sceStubs.text.*)) } :text
 
-	.sceModuleInfo.rodata : { *(.sceModuleInfo.rodata) } :text
+	.sceModuleInfo.rodata : { KEEP(*(.sceModuleInfo.rodata)) } :text
 
-	.sceLib.ent : { *(.sceLib.ent) } :text
-	.sceLib.stub : { *(.sceLib.stub) } :text
+	.sceLib.ent : { KEEP(*(.sceLib.ent)) } :text
+	.sceLib.stub : { KEEP(*(.sceLib.stub)) } :text
 
-	.sceExport.rodata : { *(.sceExport.rodata) } :text
+	.sceExport.rodata : { KEEP(*(.sceExport.rodata)) } :text
 	.sceImport.rodata : { *(.sceImport.rodata) } :text
 
-	.sceFNID.rodata : { KEEP(*(.sceFNID.rodata)) } :text
-	.sceVNID.rodata : { KEEP(*(.sceVNID.rodata)) } :text
+	.sceFNID.rodata : { *(.sceFNID.rodata) *(SORT(.sceFNID.rodata.*)) } :text
+	.sceVNID.rodata : { *(.sceVNID.rodata) *(SORT(.sceVNID.rodata.*)) } :text
 
-	.sceFStub.rodata : { KEEP(*(.sceFStub.rodata)) } :text
-	.sceVStub.rodata : { KEEP(*(.sceVStub.rodata)) } :text
+	.sceFStub.rodata : { *(.sceFStub.rodata) *(SORT(.sceFStub.rodata.*)) } :text
+	.sceVStub.rodata : { *(.sceVStub.rodata) *(SORT(.sceVStub.rodata.*)) } :text
 
-	.rodata : { *(.rodata) } :text
+	.sceRefs.rodata : { *(.sceRefs.rodata) *(SORT(.sceRefs.rodata.*)) } :text
+
+	.rodata : { *(.rodata .rodata.* .gnu.linkonce.r.*) } :text
 
 	.ARM.extab : { *(.ARM.extab* .gnu.linkonce.armextab.*) } :text
 
@@ -45,26 +51,42 @@ SECTIONS
 
 	.ctors :
 	{
-		KEEP(*ctrbegin.o(.ctors))
-		KEEP(*ctrbegin?.o(.ctors))
-		*(EXCLUDE_FILE (*crtend.o *crtend?.o ) .ctors)
-		*(SORT(.ctors.*))
-		*(.ctors)
+		KEEP(*crtbegin.o(.ctors))
+		KEEP(*crtbegin?.o(.ctors))
+		KEEP(*(EXCLUDE_FILE (*crtend.o *crtend?.o ) .ctors))
+		KEEP(*(SORT(.ctors.*)))
+		KEEP(*(.ctors))
 	} :text
 
 	.dtors :
 	{
 		KEEP(*crtbegin.o(.dtors))
 		KEEP(*crtbegin?.o(.dtors))
-		*(EXCLUDE_FILE (*crtend.o *crtend?.o ) .dtors)
-		*(SORT(.dtors.*))
-		*(.dtors)
+		KEEP(*(EXCLUDE_FILE (*crtend.o *crtend?.o ) .dtors))
+		KEEP(*(SORT(.dtors.*)))
+		KEEP(*(.dtors))
+	} :text
+
+	.init_array :
+	{
+		PROVIDE_HIDDEN (__init_array_start = .);
+		KEEP(*(SORT(.init_array.*)))
+		KEEP(*(.init_array))
+		PROVIDE_HIDDEN (__init_array_end = .);
+	} :text
+
+	.fini_array :
+	{
+		PROVIDE_HIDDEN (__fini_array_start = .);
+		KEEP(*(SORT(.fini_array.*)))
+		KEEP(*(.fini_array))
+		PROVIDE_HIDDEN (__fini_array_end = .);
 	} :text
 
-	.data : { *(.data) } :data
-	.bss : { *(.bss) } :data
+	.data : { *(.data .data.* .gnu.linkonce.d.*) } :data
+	.bss : { *(.bss .bss.* .gnu.linkonce.b.*) *(COMMON) } :data
 
-	.rel.text : { *(.rel.text) } :rela
+	.rel.text : { *(.rel.text .rel.text.* .rel.gnu.linkonce.t.*) } :rela
 	.rel.sceModuleInfo.rodata : { *(.rel.sceModuleInfo.rodata) } :rela
 
 	.rel.sceLib.ent : { *(.rel.sceLib.ent) } :rela
@@ -73,23 +95,25 @@ SECTIONS
 		. = .;
 	} :rela
 
-	.rel.sceExport.rodata : { *(rel.sceExport.rodata) } :rela
+	.rel.sceExport.rodata : { *(.rel.sceExport.rodata) } :rela
 	.rel.sceFStub.rodata :
 	{
 		*(.rel.sceFStub.rodata)
+		*(SORT(.rel.sceFStub.rodata.*))
 		. = .;
 	} :rela
 
 	.rel.sceVStub.rodata :
 	{
 		*(.rel.sceVStub.rodata)
+		*(SORT(.rel.sceVStub.rodata.*))
 		. = .;
 	} :rela
 
-	.rel.rodata : { *(.rel.rodata) } :rela
+	.rel.rodata : { *(.rel.rodata .rel.rodata.* .rel.gnu.linkonce.r.*) } :rela
 
-	.rel.data : { *(.rel.data) } :rela
+	.rel.data : { *(.rel.data .rel.data.* .rel.gnu.linkonce.d.*) } :rela
 
-	.sce_libgen_mark : { KEEP(*(.sce_libgen_mark)) }
-	.rel.sce_libgen_mark (NOLOAD) : { KEEP(*(.rel.sce_libgen_mark)) }
+	.sce_libgen_mark : { *(.sce_libgen_mark) }
+	.rel.sce_libgen_mark (NOLOAD) : { *(.rel.sce_libgen_mark) }
 }
@@ -0,0 +1,244 @@
+/**
+ * \file dump.c
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+/*
+ * psp2-gxmrec-dump: prints the records of a log of the GXM recorder, or with
+ * -s only the number of records of each operation.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "gxmrec.h"
+
+static const char *const opNames[PSP2_GXM_REC_OP_COUNT] = {
+	[PSP2_GXM_REC_OP_FRAME] = "Frame",
+	[PSP2_GXM_REC_OP_BEGIN_SCENE] = "BeginScene",
+	[PSP2_GXM_REC_OP_END_SCENE] = "EndScene",
+	[PSP2_GXM_REC_OP_MID_SCENE_FLUSH] = "MidSceneFlush",
+	[PSP2_GXM_REC_OP_SET_VERTEX_PROGRAM] = "SetVertexProgram",
+	[PSP2_GXM_REC_OP_SET_FRAGMENT_PROGRAM] = "SetFragmentProgram",
+	[PSP2_GXM_REC_OP_SET_VERTEX_STREAM] = "SetVertexStream",
+	[PSP2_GXM_REC_OP_SET_VERTEX_TEXTURE] = "SetVertexTexture",
+	[PSP2_GXM_REC_OP_SET_FRAGMENT_TEXTURE] = "SetFragmentTexture",
+	[PSP2_GXM_REC_OP_SET_VERTEX_UNIFORM_BUFFER] = "SetVertexUniformBuffer",
+	[PSP2_GXM_REC_OP_SET_FRAGMENT_UNIFORM_BUFFER] =
+		"SetFragmentUniformBuffer",
+	[PSP2_GXM_REC_OP_SET_VERTEX_DEFAULT_UNIFORM_BUFFER] =
+		"SetVertexDefaultUniformBuffer",
+	[PSP2_GXM_REC_OP_SET_FRAGMENT_DEFAULT_UNIFORM_BUFFER] =
+		"SetFragmentDefaultUniformBuffer",
+	[PSP2_GXM_REC_OP_SET_PRECOMPUTED_VERTEX_STATE] =
+		"SetPrecomputedVertexState",
+	[PSP2_GXM_REC_OP_SET_PRECOMPUTED_FRAGMENT_STATE] =
+		"SetPrecomputedFragmentState",
+	[PSP2_GXM_REC_OP_SET_STATE] = "SetState",
+	[PSP2_GXM_REC_OP_DRAW] = "Draw",
+	[PSP2_GXM_REC_OP_DRAW_PRECOMPUTED] = "DrawPrecomputed",
+	[PSP2_GXM_REC_OP_EXECUTE_COMMAND_LIST] = "ExecuteCommandList",
+	[PSP2_GXM_REC_OP_VERTEX_FENCE] = "VertexFence",
+	[PSP2_GXM_REC_OP_FINISH] = "Finish",
+	[PSP2_GXM_REC_OP_PUSH_USER_MARKER] = "PushUserMarker",
+	[PSP2_GXM_REC_OP_POP_USER_MARKER] = "PopUserMarker",
+	[PSP2_GXM_REC_OP_SET_USER_MARKER] = "SetUserMarker"
+};
+
+static const char *const stateNames[PSP2_GXM_REC_STATE_COUNT] = {
+	[PSP2_GXM_REC_STATE_FRONT_DEPTH_FUNC] = "FrontDepthFunc",
+	[PSP2_GXM_REC_STATE_BACK_DEPTH_FUNC] = "BackDepthFunc",
+	[PSP2_GXM_REC_STATE_FRONT_FRAGMENT_PROGRAM_ENABLE] =
+		"FrontFragmentProgramEnable",
+	[PSP2_GXM_REC_STATE_BACK_FRAGMENT_PROGRAM_ENABLE] =
+		"BackFragmentProgramEnable",
+	[PSP2_GXM_REC_STATE_FRONT_DEPTH_WRITE_ENABLE] = "FrontDepthWriteEnable",
+	[PSP2_GXM_REC_STATE_BACK_DEPTH_WRITE_ENABLE] = "BackDepthWriteEnable",
+	[PSP2_GXM_REC_STATE_FRONT_LINE_FILL_LAST_PIXEL_ENABLE] =
+		"FrontLineFillLastPixelEnable",
+	[PSP2_GXM_REC_STATE_BACK_LINE_FILL_LAST_PIXEL_ENABLE] =
+		"BackLineFillLastPixelEnable",
+	[PSP2_GXM_REC_STATE_FRONT_STENCIL_REF] = "FrontStencilRef",
+	[PSP2_GXM_REC_STATE_BACK_STENCIL_REF] = "BackStencilRef",
+	[PSP2_GXM_REC_STATE_FRONT_POINT_LINE_WIDTH] = "FrontPointLineWidth",
+	[PSP2_GXM_REC_STATE_BACK_POINT_LINE_WIDTH] = "BackPointLineWidth",
+	[PSP2_GXM_REC_STATE_FRONT_POLYGON_MODE] = "FrontPolygonMode",
+	[PSP2_GXM_REC_STATE_BACK_POLYGON_MODE] = "BackPolygonMode",
+	[PSP2_GXM_REC_STATE_FRONT_STENCIL_FUNC] = "FrontStencilFunc",
+	[PSP2_GXM_REC_STATE_BACK_STENCIL_FUNC] = "BackStencilFunc",
+	[PSP2_GXM_REC_STATE_FRONT_DEPTH_BIAS] = "FrontDepthBias",
+	[PSP2_GXM_REC_STATE_BACK_DEPTH_BIAS] = "BackDepthBias",
+	[PSP2_GXM_REC_STATE_TWO_SIDED_ENABLE] = "TwoSidedEnable",
+	[PSP2_GXM_REC_STATE_VIEWPORT] = "Viewport",
+	[PSP2_GXM_REC_STATE_W_CLAMP_VALUE] = "WClampValue",
+	[PSP2_GXM_REC_STATE_W_CLAMP_ENABLE] = "WClampEnable",
+	[PSP2_GXM_REC_STATE_REGION_CLIP] = "RegionClip",
+	[PSP2_GXM_REC_STATE_CULL_MODE] = "CullMode",
+	[PSP2_GXM_REC_STATE_VIEWPORT_ENABLE] = "ViewportEnable",
+	[PSP2_GXM_REC_STATE_W_BUFFER_ENABLE] = "WBufferEnable",
+	[PSP2_GXM_REC_STATE_FRONT_VISIBILITY_TEST_INDEX] =
+		"FrontVisibilityTestIndex",
+	[PSP2_GXM_REC_STATE_BACK_VISIBILITY_TEST_INDEX] =
+		"BackVisibilityTestIndex",
+	[PSP2_GXM_REC_STATE_FRONT_VISIBILITY_TEST_OP] = "FrontVisibilityTestOp",
+	[PSP2_GXM_REC_STATE_BACK_VISIBILITY_TEST_OP] = "BackVisibilityTestOp",
+	[PSP2_GXM_REC_STATE_FRONT_VISIBILITY_TEST_ENABLE] =
+		"FrontVisibilityTestEnable",
+	[PSP2_GXM_REC_STATE_BACK_VISIBILITY_TEST_ENABLE] =
+		"BackVisibilityTestEnable"
+};
+
+static uint64_t getPointer(const uint32_t *words)
+{
+	return words[0] | (uint64_t)words[1] << 32;
+}
+
+static void printRecord(uint32_t op, const uint32_t *words, uint32_t size)
+{
+	uint32_t i;
+
+	switch (op) {
+	case PSP2_GXM_REC_OP_SET_VERTEX_PROGRAM:
+	case PSP2_GXM_REC_OP_SET_FRAGMENT_PROGRAM:
+	case PSP2_GXM_REC_OP_SET_VERTEX_DEFAULT_UNIFORM_BUFFER:
+	case PSP2_GXM_REC_OP_SET_FRAGMENT_DEFAULT_UNIFORM_BUFFER:
+	case PSP2_GXM_REC_OP_SET_PRECOMPUTED_VERTEX_STATE:
+	case PSP2_GXM_REC_OP_SET_PRECOMPUTED_FRAGMENT_STATE:
+		if (size >= 2)
+			printf(" 0x%llx", (unsigned long long)getPointer(words));
+		return;
+	case PSP2_GXM_REC_OP_SET_VERTEX_STREAM:
+	case PSP2_GXM_REC_OP_SET_VERTEX_UNIFORM_BUFFER:
+	case PSP2_GXM_REC_OP_SET_FRAGMENT_UNIFORM_BUFFER:
+		if (size >= 3)
+			printf(" %u 0x%llx", words[0],
+				(unsigned long long)getPointer(words + 1));
+		return;
+	case PSP2_GXM_REC_OP_SET_STATE:
+		if (size >= 1 && words[0] < PSP2_GXM_REC_STATE_COUNT) {
+			printf(" %s", stateNames[words[0]]);
+			words++;
+			size--;
+		}
+		break;
+	case PSP2_GXM_REC_OP_DRAW:
+		if (size >= 6)
+			printf(" type 0x%08X index 0x%08X indices 0x%llx count %u wrap %u",
+				words[0], words[1], (unsigned long long)getPointer(words + 2),
+				words[4], words[5]);
+		return;
+	case PSP2_GXM_REC_OP_DRAW_PRECOMPUTED:
+		if (size >= 10)
+			printf(" 0x%llx program 0x%llx type 0x%08X index 0x%08X"
+				" indices 0x%llx count %u wrap %u",
+				(unsigned long long)getPointer(words),
+				(unsigned long long)getPointer(words + 2), words[4], words[5],
+				(unsigned long long)getPointer(words + 6), words[8], words[9]);
+		return;
+	case PSP2_GXM_REC_OP_PUSH_USER_MARKER:
+	case PSP2_GXM_REC_OP_SET_USER_MARKER:
+		printf(" \"%.*s\"", (int)(size * sizeof(*words)),
+			(const char *)words);
+		return;
+	}
+
+	for (i = 0; i < size; i++)
+		printf(" 0x%X", words[i]);
+}
+
+int main(int argc, char *argv[])
+{
+	uint64_t counts[PSP2_GXM_REC_OP_COUNT], records;
+	Psp2GxmRecLogHeader header;
+	uint32_t record, op, size, *words, capacity;
+	int summary, arg, ret;
+	FILE *fp;
+
+	summary = 0;
+	arg = 1;
+	if (arg < argc && strcmp(argv[arg], "-s") == 0) {
+		summary = 1;
+		arg++;
+	}
+
+	if (arg + 1 != argc) {
+		fprintf(stderr, "usage: %s [-s] log\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	fp = fopen(argv[arg], "rb");
+	if (fp == NULL) {
+		perror(argv[arg]);
+		return EXIT_FAILURE;
+	}
+
+	if (fread(&header, sizeof(header), 1, fp) != 1
+		|| header.magic != PSP2_GXM_REC_LOG_MAGIC
+		|| header.version != PSP2_GXM_REC_LOG_VERSION) {
+		fprintf(stderr, "%s: not a GXM recorder log\n", argv[arg]);
+		fclose(fp);
+		return EXIT_FAILURE;
+	}
+
+	memset(counts, 0, sizeof(counts));
+	records = 0;
+	words = NULL;
+	capacity = 0;
+	ret = EXIT_SUCCESS;
+
+	while (fread(&record, sizeof(record), 1, fp) == 1) {
+		op = PSP2_GXM_REC_RECORD_OP(record);
+		size = PSP2_GXM_REC_RECORD_SIZE(record);
+		if (size > capacity) {
+			free(words);
+			capacity = size;
+			words = malloc(capacity * sizeof(*words));
+			if (words == NULL) {
+				perror(argv[0]);
+				ret = EXIT_FAILURE;
+				break;
+			}
+		}
+
+		if (fread(words, sizeof(*words), size, fp) != size) {
+			fprintf(stderr, "%s: truncated record %llu\n", argv[arg],
+				(unsigned long long)records);
+			ret = EXIT_FAILURE;
+			break;
+		}
+
+		if (op >= PSP2_GXM_REC_OP_COUNT) {
+			fprintf(stderr, "%s: unknown operation %u in record %llu\n",
+				argv[arg], op, (unsigned long long)records);
+			ret = EXIT_FAILURE;
+			break;
+		}
+
+		records++;
+		counts[op]++;
+		if (summary)
+			continue;
+
+		printf("%3u %s", PSP2_GXM_REC_RECORD_CONTEXT(record), opNames[op]);
+		printRecord(op, words, size);
+		putchar('\n');
+	}
+
+	if (summary) {
+		for (op = 0; op < PSP2_GXM_REC_OP_COUNT; op++)
+			if (counts[op] != 0)
+				printf("%-32s %llu\n", opNames[op],
+					(unsigned long long)counts[op]);
+		printf("%-32s %llu\n", "Records", (unsigned long long)records);
+	}
+
+	free(words);
+	fclose(fp);
+
+	return ret;
+}
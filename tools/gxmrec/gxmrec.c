@@ -0,0 +1,3702 @@
+/**
+ * \file gxmrec.c
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "gxmrec.h"
+
+#define PSP2_GXM_REC_MAGIC_CONTEXT				0x54435847U	// "GXCT"
+#define PSP2_GXM_REC_MAGIC_RENDER_TARGET		0x54525847U	// "GXRT"
+#define PSP2_GXM_REC_MAGIC_SYNC_OBJECT			0x4F535847U	// "GXSO"
+#define PSP2_GXM_REC_MAGIC_SHADER_PATCHER		0x50535847U	// "GXSP"
+#define PSP2_GXM_REC_MAGIC_REGISTERED_PROGRAM	0x50525847U	// "GXRP"
+#define PSP2_GXM_REC_MAGIC_VERTEX_PROGRAM		0x50565847U	// "GXVP"
+#define PSP2_GXM_REC_MAGIC_FRAGMENT_PROGRAM		0x50465847U	// "GXFP"
+#define PSP2_GXM_REC_MAGIC_COMMAND_LIST			0x4C435847U	// "GXCL"
+#define PSP2_GXM_REC_MAGIC_PRECOMPUTED_DRAW		0x44505847U	// "GXPD"
+#define PSP2_GXM_REC_MAGIC_PRECOMPUTED_VERTEX	0x56505847U	// "GXPV"
+#define PSP2_GXM_REC_MAGIC_PRECOMPUTED_FRAGMENT	0x46505847U	// "GXPF"
+#define PSP2_GXM_REC_MAGIC_PARAMETER			0x50505847U	// "GXPP"
+#define PSP2_GXM_REC_MAGIC_COLOR_SURFACE		0x53435847U	// "GXCS"
+#define PSP2_GXM_REC_MAGIC_DEAD					0xDEADDEADU
+
+/* The magic of GXP programs */
+#define PSP2_GXM_REC_PROGRAM_MAGIC				"GXP"
+
+/* The offset of the size of a GXP program, after its magic and versions */
+#define PSP2_GXM_REC_PROGRAM_SIZE_OFFSET		8
+
+/* The words of the log buffer of the immediate context */
+#define PSP2_GXM_REC_LOG_BUFFER_WORDS			(16 * 1024)
+
+/* The size reserved for a default uniform buffer, as programs are not parsed */
+#define PSP2_GXM_REC_DEFAULT_UNIFORM_BUFFER_SIZE	1024U
+
+/* The operations that only appear in command lists */
+#define PSP2_GXM_REC_OP_LINK					0xFE	// The next chunk.
+#define PSP2_GXM_REC_OP_END						0xFF
+
+/* The words reserved at the end of a chunk for a link */
+#define PSP2_GXM_REC_LINK_WORDS					3
+
+/* The number of deferred contexts */
+#define PSP2_GXM_REC_MAX_DEFERRED_CONTEXTS		255
+
+enum {
+	PSP2_GXM_REC_VERTEX,
+	PSP2_GXM_REC_FRAGMENT
+};
+
+typedef struct Psp2GxmRecMapping {
+	uintptr_t base;
+	uintptr_t size;
+	uint32_t attribs;
+} Psp2GxmRecMapping;
+
+/* The memory of a ring, or of the buffers of a deferred context */
+typedef struct Psp2GxmRecBuffer {
+	uint8_t *mem;
+	uint32_t size;
+	uint32_t offset;
+	SceGxmDeferredContextCallback callback;
+} Psp2GxmRecBuffer;
+
+/* The start of a command list, in the VDM buffer */
+typedef struct Psp2GxmRecCommandList {
+	uint32_t magic;
+	uint32_t context;
+	Psp2GxmRecStats stats;
+} Psp2GxmRecCommandList;
+
+/* The memory block of precomputed states */
+typedef struct Psp2GxmRecPrecomputedStateMem {
+	const void *defaultUniformBuffer;
+	const void *uniformBuffers[SCE_GXM_MAX_UNIFORM_BUFFERS];
+	SceGxmTexture textures[SCE_GXM_MAX_TEXTURE_UNITS];
+} Psp2GxmRecPrecomputedStateMem;
+
+/* The contents of SceGxmPrecomputedVertexState and SceGxmPrecomputedFragmentState */
+typedef struct Psp2GxmRecPrecomputedState {
+	uint32_t magic;
+	const void *program;
+	Psp2GxmRecPrecomputedStateMem *mem;
+} Psp2GxmRecPrecomputedState;
+
+/* The contents of SceGxmPrecomputedDraw */
+typedef struct Psp2GxmRecPrecomputedDraw {
+	uint32_t magic;
+	uint32_t type;				// The primitive type and index format.
+	uint32_t indexCount;
+	uint32_t indexWrap;
+	const SceGxmVertexProgram *program;
+	const void **streams;
+	const void *indexData;
+} Psp2GxmRecPrecomputedDraw;
+
+#if __STDC_VERSION__ >= 201112L
+_Static_assert(sizeof(Psp2GxmRecPrecomputedState)
+		<= sizeof(SceGxmPrecomputedVertexState),
+	"Psp2GxmRecPrecomputedState does not fit");
+_Static_assert(sizeof(Psp2GxmRecPrecomputedDraw)
+		<= sizeof(SceGxmPrecomputedDraw),
+	"Psp2GxmRecPrecomputedDraw does not fit");
+_Static_assert(sizeof(Psp2GxmRecCommandList *) <= sizeof(SceGxmCommandList),
+	"SceGxmCommandList is too small");
+#endif
+
+struct SceGxmRenderTarget {
+	uint32_t magic;
+	SceGxmRenderTargetParams params;
+};
+
+struct SceGxmSyncObject {
+	uint32_t magic;
+};
+
+struct SceGxmRegisteredProgram {
+	uint32_t magic;
+	uint32_t refCount;
+	const SceGxmProgram *program;
+	SceGxmShaderPatcher *shaderPatcher;
+	SceGxmRegisteredProgram *next;
+};
+
+struct SceGxmVertexProgram {
+	uint32_t magic;
+	uint32_t refCount;
+	SceGxmRegisteredProgram *program;
+	SceGxmVertexProgram *next;
+	uint32_t attributeCount;
+	uint32_t streamCount;
+	SceGxmVertexAttribute attributes[SCE_GXM_MAX_VERTEX_ATTRIBUTES];
+	SceGxmVertexStream streams[SCE_GXM_MAX_VERTEX_STREAMS];
+};
+
+struct SceGxmFragmentProgram {
+	uint32_t magic;
+	uint32_t refCount;
+	SceGxmRegisteredProgram *program;		// NULL for the mask update program
+	SceGxmFragmentProgram *next;
+	SceGxmOutputRegisterFormat outputFormat;
+	SceGxmMultisampleMode multisampleMode;
+	int hasBlendInfo;
+	SceGxmBlendInfo blendInfo;
+	const SceGxmProgram *vertexProgram;
+};
+
+/* A parameter made up when it is looked up, as programs are not parsed */
+struct SceGxmProgramParameter {
+	uint32_t magic;
+	const SceGxmProgram *program;
+	SceGxmProgramParameter *next;
+	SceGxmParameterCategory category;
+	SceGxmParameterSemantic semantic;
+	uint32_t semanticIndex;
+	uint32_t index;					// Among those of the program and category.
+	char name[];
+};
+
+/* The fields of an enabled color surface, copied into its opaque words */
+typedef struct Psp2GxmRecColorSurface {
+	uint32_t magic;
+	SceGxmColorFormat format;
+	SceGxmColorSurfaceType type;
+	SceGxmColorSurfaceScaleMode scaleMode;
+	SceGxmOutputRegisterSize outputRegisterSize;
+	uint32_t width;
+	uint32_t height;
+	uint32_t strideInPixels;
+	void *data;
+} Psp2GxmRecColorSurface;
+
+#if __STDC_VERSION__ >= 201112L
+_Static_assert(sizeof(Psp2GxmRecColorSurface) <= sizeof(SceGxmColorSurface),
+	"Psp2GxmRecColorSurface does not fit");
+#endif
+
+struct SceGxmShaderPatcher {
+	uint32_t magic;
+	SceGxmShaderPatcherParams params;
+	SceGxmRegisteredProgram *programs;
+	SceGxmVertexProgram *vertexPrograms;
+	SceGxmFragmentProgram *fragmentPrograms;
+	uint32_t hostMemAllocated;
+};
+
+struct SceGxmContext {
+	uint32_t magic;
+	SceGxmContextType type;
+	uint32_t id;
+	int active;					// Within a scene, or within a command list.
+	int failed;					// The command list ran out of memory.
+	const SceGxmRenderTarget *renderTarget;
+	const SceGxmVertexProgram *vertexProgram;
+	const SceGxmFragmentProgram *fragmentProgram;
+	const SceGxmPrecomputedVertexState *precomputedVertexState;
+	const SceGxmPrecomputedFragmentState *precomputedFragmentState;
+	const void *vertexStreams[SCE_GXM_MAX_VERTEX_STREAMS];
+	SceGxmTexture textures[2][SCE_GXM_MAX_TEXTURE_UNITS];
+	const void *uniformBuffers[2][SCE_GXM_MAX_UNIFORM_BUFFERS];
+	const void *defaultUniformBuffers[2];
+	uint32_t states[PSP2_GXM_REC_STATE_COUNT][PSP2_GXM_REC_STATE_MAX_VALUES];
+	uint32_t statesSet[(PSP2_GXM_REC_STATE_COUNT + 31) / 32];
+	uint32_t markerDepth;
+	Psp2GxmRecStats stats;
+	Psp2GxmRecBuffer buffers[2];	// The default uniform buffers.
+
+	// The immediate context
+	uint32_t *log;
+	uint32_t logCount;
+
+	// Deferred contexts
+	SceGxmDeferredContextParams params;
+	Psp2GxmRecBuffer vdm;
+	uint8_t *commandList;
+};
+
+static struct {
+	pthread_mutex_t mutex;
+	int initialized;
+	SceGxmInitializeParams params;
+	FILE *log;
+	Psp2GxmRecStats frame;
+	Psp2GxmRecStats total;
+	Psp2GxmRecFrameCallback frameCallback;
+	void *frameUserData;
+	Psp2GxmRecErrorCallback errorCallback;
+	void *errorUserData;
+	SceGxmContext *immediateContext;
+	uint8_t deferredContexts[PSP2_GXM_REC_MAX_DEFERRED_CONTEXTS + 1];
+	uint32_t renderTargetCount;
+	pthread_rwlock_t mappingLock;
+	Psp2GxmRecMapping *mappings;
+	uint32_t mappingCount;
+	uint32_t mappingCapacity;
+	uint32_t usseOffset;
+	SceGxmProgramParameter *parameters;
+	volatile uint32_t notifications[SCE_GXM_NOTIFICATION_COUNT];
+} psp2GxmRec = {
+	.mutex = PTHREAD_MUTEX_INITIALIZER,
+	.mappingLock = PTHREAD_RWLOCK_INITIALIZER
+};
+
+static int psp2GxmRecError(const char *function, int error,
+	const char *format, ...)
+	__attribute__((format(printf, 3, 4)));
+
+static int psp2GxmRecError(const char *function, int error,
+	const char *format, ...)
+{
+	Psp2GxmRecErrorCallback callback;
+	va_list ap;
+	char message[256];
+	void *userData;
+
+	va_start(ap, format);
+	vsnprintf(message, sizeof(message), format, ap);
+	va_end(ap);
+
+	pthread_mutex_lock(&psp2GxmRec.mutex);
+	psp2GxmRec.frame.errors++;
+	psp2GxmRec.total.errors++;
+	callback = psp2GxmRec.errorCallback;
+	userData = psp2GxmRec.errorUserData;
+	pthread_mutex_unlock(&psp2GxmRec.mutex);
+
+	if (callback != NULL)
+		callback(function, error, message, userData);
+	else if (error != SCE_OK)
+		fprintf(stderr, "%s: %s (0x%08X)\n", function, message, error);
+	else
+		fprintf(stderr, "%s: %s\n", function, message);
+
+	return error;
+}
+
+static void psp2GxmRecAddStats(Psp2GxmRecStats *dst,
+	const Psp2GxmRecStats *src)
+{
+	dst->frames += src->frames;
+	dst->scenes += src->scenes;
+	dst->draws += src->draws;
+	dst->instancedDraws += src->instancedDraws;
+	dst->precomputedDraws += src->precomputedDraws;
+	dst->indices += src->indices;
+	dst->stateChanges += src->stateChanges;
+	dst->redundantStateChanges += src->redundantStateChanges;
+	dst->programChanges += src->programChanges;
+	dst->textureChanges += src->textureChanges;
+	dst->uniformBufferChanges += src->uniformBufferChanges;
+	dst->uniformBytes += src->uniformBytes;
+	dst->commandLists += src->commandLists;
+	dst->errors += src->errors;
+}
+
+/* Add statistics to those of the frame and the total; the mutex is locked */
+static void psp2GxmRecMergeStats(Psp2GxmRecStats *stats)
+{
+	psp2GxmRecAddStats(&psp2GxmRec.frame, stats);
+	psp2GxmRecAddStats(&psp2GxmRec.total, stats);
+	memset(stats, 0, sizeof(*stats));
+}
+
+/*
+ * Memory mappings
+ */
+
+/* Find the last mapping at or below an address; the lock is held */
+static int32_t psp2GxmRecFindMapping(uintptr_t address)
+{
+	int32_t low, high, mid;
+
+	low = 0;
+	high = (int32_t)psp2GxmRec.mappingCount - 1;
+	while (low <= high) {
+		mid = (low + high) / 2;
+		if (psp2GxmRec.mappings[mid].base <= address)
+			low = mid + 1;
+		else
+			high = mid - 1;
+	}
+
+	return high;
+}
+
+static int psp2GxmRecIsMapped(const void *data, uint32_t size,
+	uint32_t attribs)
+{
+	const Psp2GxmRecMapping *mapping;
+	uintptr_t address;
+	int32_t i;
+	int mapped;
+
+	address = (uintptr_t)data;
+	mapped = 0;
+	pthread_rwlock_rdlock(&psp2GxmRec.mappingLock);
+	i = psp2GxmRecFindMapping(address);
+	if (i >= 0) {
+		mapping = psp2GxmRec.mappings + i;
+		mapped = address - mapping->base < mapping->size
+			&& size <= mapping->size - (address - mapping->base)
+			&& (mapping->attribs & attribs) == attribs;
+	}
+	pthread_rwlock_unlock(&psp2GxmRec.mappingLock);
+
+	return mapped;
+}
+
+static SceGxmErrorCode psp2GxmRecMap(const char *function, void *base,
+	uint32_t size, uint32_t attribs)
+{
+	Psp2GxmRecMapping *mappings;
+	uintptr_t address;
+	uint32_t capacity;
+	int32_t i;
+
+	address = (uintptr_t)base;
+	if (base == NULL)
+		return psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_POINTER,
+			"NULL base");
+	if (address % 4096 != 0 || size % 4096 != 0 || size == 0)
+		return psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_ALIGNMENT,
+			"%p and 0x%X are not 4K-aligned", base, size);
+
+	pthread_rwlock_wrlock(&psp2GxmRec.mappingLock);
+	i = psp2GxmRecFindMapping(address + size - 1);
+	if (i >= 0 && psp2GxmRec.mappings[i].base
+			+ psp2GxmRec.mappings[i].size > address) {
+		pthread_rwlock_unlock(&psp2GxmRec.mappingLock);
+		return psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_VALUE,
+			"%p overlaps a mapping", base);
+	}
+
+	if (psp2GxmRec.mappingCount == psp2GxmRec.mappingCapacity) {
+		capacity = psp2GxmRec.mappingCapacity ?
+			psp2GxmRec.mappingCapacity * 2 : 16;
+		mappings = realloc(psp2GxmRec.mappings,
+			capacity * sizeof(*mappings));
+		if (mappings == NULL) {
+			pthread_rwlock_unlock(&psp2GxmRec.mappingLock);
+			return SCE_GXM_ERROR_OUT_OF_MEMORY;
+		}
+		psp2GxmRec.mappings = mappings;
+		psp2GxmRec.mappingCapacity = capacity;
+	}
+
+	i++;
+	memmove(psp2GxmRec.mappings + i + 1, psp2GxmRec.mappings + i,
+		(psp2GxmRec.mappingCount - i) * sizeof(*psp2GxmRec.mappings));
+	psp2GxmRec.mappings[i].base = address;
+	psp2GxmRec.mappings[i].size = size;
+	psp2GxmRec.mappings[i].attribs = attribs;
+	psp2GxmRec.mappingCount++;
+	pthread_rwlock_unlock(&psp2GxmRec.mappingLock);
+
+	return SCE_OK;
+}
+
+static SceGxmErrorCode psp2GxmRecUnmap(const char *function, void *base)
+{
+	int32_t i;
+
+	pthread_rwlock_wrlock(&psp2GxmRec.mappingLock);
+	i = psp2GxmRecFindMapping((uintptr_t)base);
+	if (i < 0 || psp2GxmRec.mappings[i].base != (uintptr_t)base) {
+		pthread_rwlock_unlock(&psp2GxmRec.mappingLock);
+		return psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_VALUE,
+			"%p is not the base of a mapping", base);
+	}
+
+	psp2GxmRec.mappingCount--;
+	memmove(psp2GxmRec.mappings + i, psp2GxmRec.mappings + i + 1,
+		(psp2GxmRec.mappingCount - i) * sizeof(*psp2GxmRec.mappings));
+	pthread_rwlock_unlock(&psp2GxmRec.mappingLock);
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmMapMemory(void *base, uint32_t size, uint32_t attribs)
+{
+	if (attribs == 0 || (attribs & ~(SCE_GXM_MEMORY_ATTRIB_READ
+			| SCE_GXM_MEMORY_ATTRIB_WRITE)) != 0)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_VALUE,
+			"bad attributes 0x%X", attribs);
+
+	return psp2GxmRecMap(__func__, base, size, attribs);
+}
+
+SceGxmErrorCode sceGxmUnmapMemory(void *base)
+{
+	return psp2GxmRecUnmap(__func__, base);
+}
+
+SceGxmErrorCode sceGxmMapVertexUsseMemory(void *base, uint32_t size,
+	uint32_t *offset)
+{
+	SceGxmErrorCode error;
+
+	if (offset == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"NULL offset");
+
+	error = psp2GxmRecMap(__func__, base, size, 0);
+	if (error == SCE_OK) {
+		pthread_mutex_lock(&psp2GxmRec.mutex);
+		*offset = psp2GxmRec.usseOffset;
+		psp2GxmRec.usseOffset += size;
+		pthread_mutex_unlock(&psp2GxmRec.mutex);
+	}
+
+	return error;
+}
+
+SceGxmErrorCode sceGxmUnmapVertexUsseMemory(void *base)
+{
+	return psp2GxmRecUnmap(__func__, base);
+}
+
+SceGxmErrorCode sceGxmMapFragmentUsseMemory(void *base, uint32_t size,
+	uint32_t *offset)
+{
+	SceGxmErrorCode error;
+
+	if (offset == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"NULL offset");
+
+	error = psp2GxmRecMap(__func__, base, size, 0);
+	if (error == SCE_OK) {
+		pthread_mutex_lock(&psp2GxmRec.mutex);
+		*offset = psp2GxmRec.usseOffset;
+		psp2GxmRec.usseOffset += size;
+		pthread_mutex_unlock(&psp2GxmRec.mutex);
+	}
+
+	return error;
+}
+
+SceGxmErrorCode sceGxmUnmapFragmentUsseMemory(void *base)
+{
+	return psp2GxmRecUnmap(__func__, base);
+}
+
+/*
+ * Log
+ */
+
+static void psp2GxmRecFlushLog(SceGxmContext *context)
+{
+	if (context->logCount == 0)
+		return;
+
+	pthread_mutex_lock(&psp2GxmRec.mutex);
+	if (psp2GxmRec.log != NULL)
+		fwrite(context->log, sizeof(*context->log), context->logCount,
+			psp2GxmRec.log);
+	pthread_mutex_unlock(&psp2GxmRec.mutex);
+
+	context->logCount = 0;
+}
+
+/* Append words to the log buffer of the immediate context */
+static void psp2GxmRecLog(SceGxmContext *context, const uint32_t *words,
+	uint32_t count)
+{
+	if (context->log == NULL)
+		return;
+
+	if (context->logCount + count > PSP2_GXM_REC_LOG_BUFFER_WORDS)
+		psp2GxmRecFlushLog(context);
+
+	if (count > PSP2_GXM_REC_LOG_BUFFER_WORDS) {
+		pthread_mutex_lock(&psp2GxmRec.mutex);
+		if (psp2GxmRec.log != NULL)
+			fwrite(words, sizeof(*words), count, psp2GxmRec.log);
+		pthread_mutex_unlock(&psp2GxmRec.mutex);
+		return;
+	}
+
+	memcpy(context->log + context->logCount, words, count * sizeof(*words));
+	context->logCount += count;
+}
+
+/* Get memory from a buffer of a deferred context */
+static void *psp2GxmRecReserve(SceGxmContext *context,
+	Psp2GxmRecBuffer *buffer, uint32_t size)
+{
+	void *mem;
+	uint32_t newSize;
+
+	if (buffer->mem == NULL || buffer->size - buffer->offset < size) {
+		if (buffer->callback == NULL)
+			return NULL;
+
+		newSize = 0;
+		mem = buffer->callback(context->params.userData, size, &newSize);
+		if (mem == NULL || newSize < size)
+			return NULL;
+
+		buffer->mem = mem;
+		buffer->size = newSize;
+		buffer->offset = 0;
+	}
+
+	mem = buffer->mem + buffer->offset;
+	buffer->offset += (size + 3) & ~3U;
+
+	return mem;
+}
+
+/* Record a command */
+static void psp2GxmRecEmit(SceGxmContext *context, uint32_t op,
+	const uint32_t *payload, uint32_t count)
+{
+	uint32_t *words, *link, record, size;
+	Psp2GxmRecBuffer *vdm;
+	uint8_t *mem;
+
+	record = PSP2_GXM_REC_RECORD(op, context->id, count);
+	if (context->type == SCE_GXM_CONTEXT_TYPE_IMMEDIATE) {
+		if (context->log != NULL) {
+			psp2GxmRecLog(context, &record, 1);
+			if (count != 0)
+				psp2GxmRecLog(context, payload, count);
+		}
+		return;
+	}
+
+	if (context->failed)
+		return;
+
+	// Keep room in each chunk for a link to the next one.
+	vdm = &context->vdm;
+	size = (count + 1 + PSP2_GXM_REC_LINK_WORDS) * sizeof(uint32_t);
+	if (vdm->mem == NULL || vdm->size - vdm->offset < size) {
+		link = vdm->mem != NULL && vdm->size - vdm->offset
+				>= PSP2_GXM_REC_LINK_WORDS * sizeof(uint32_t) ?
+			(uint32_t *)(vdm->mem + vdm->offset) : NULL;
+		vdm->mem = NULL;
+		mem = psp2GxmRecReserve(context, vdm,
+			size > SCE_GXM_MINIMUM_DEFERRED_CONTEXT_BUFFER_SIZE ?
+				size : SCE_GXM_MINIMUM_DEFERRED_CONTEXT_BUFFER_SIZE);
+		if (mem == NULL || link == NULL) {
+			context->failed = 1;
+			psp2GxmRecError(__func__, SCE_GXM_ERROR_RESERVE_FAILED,
+				"out of VDM buffer memory for the command list");
+			return;
+		}
+
+		// The chunk starts at the reserved memory.
+		vdm->offset = 0;
+		link[0] = PSP2_GXM_REC_RECORD(PSP2_GXM_REC_OP_LINK, context->id, 2);
+		memcpy(link + 1, &mem, sizeof(mem));
+	}
+
+	words = (uint32_t *)(vdm->mem + vdm->offset);
+	words[0] = record;
+	if (count != 0)
+		memcpy(words + 1, payload, count * sizeof(*payload));
+	vdm->offset += (count + 1) * sizeof(uint32_t);
+}
+
+static void psp2GxmRecPutPointer(uint32_t *words, const void *p)
+{
+	uint64_t value;
+
+	value = (uintptr_t)p;
+	words[0] = (uint32_t)value;
+	words[1] = (uint32_t)(value >> 32);
+}
+
+static void psp2GxmRecEmitPointer(SceGxmContext *context, uint32_t op,
+	const void *p)
+{
+	uint32_t words[2];
+
+	psp2GxmRecPutPointer(words, p);
+	psp2GxmRecEmit(context, op, words, 2);
+}
+
+static void psp2GxmRecEmitString(SceGxmContext *context, uint32_t op,
+	const char *s)
+{
+	uint32_t words[64];
+	size_t length;
+
+	length = strlen(s);
+	if (length >= sizeof(words))
+		length = sizeof(words) - 1;
+
+	memset(words, 0, sizeof(words));
+	memcpy(words, s, length);
+	psp2GxmRecEmit(context, op, words, length / 4 + 1);
+}
+
+int psp2GxmRecOpenLog(const char *path)
+{
+	Psp2GxmRecLogHeader header;
+	SceGxmContext *context;
+	uint32_t *log;
+	FILE *fp;
+
+	fp = fopen(path, "wb");
+	if (fp == NULL)
+		return -1;
+
+	header.magic = PSP2_GXM_REC_LOG_MAGIC;
+	header.version = PSP2_GXM_REC_LOG_VERSION;
+	if (fwrite(&header, sizeof(header), 1, fp) != 1) {
+		fclose(fp);
+		return -1;
+	}
+
+	psp2GxmRecCloseLog();
+
+	pthread_mutex_lock(&psp2GxmRec.mutex);
+	psp2GxmRec.log = fp;
+	context = psp2GxmRec.immediateContext;
+	pthread_mutex_unlock(&psp2GxmRec.mutex);
+
+	if (context != NULL && context->log == NULL) {
+		log = malloc(PSP2_GXM_REC_LOG_BUFFER_WORDS * sizeof(*log));
+		if (log == NULL) {
+			psp2GxmRecCloseLog();
+			errno = ENOMEM;
+			return -1;
+		}
+		context->log = log;
+	}
+
+	return 0;
+}
+
+int psp2GxmRecCloseLog(void)
+{
+	SceGxmContext *context;
+	FILE *fp;
+
+	pthread_mutex_lock(&psp2GxmRec.mutex);
+	context = psp2GxmRec.immediateContext;
+	pthread_mutex_unlock(&psp2GxmRec.mutex);
+
+	if (context != NULL && context->log != NULL) {
+		psp2GxmRecFlushLog(context);
+		free(context->log);
+		context->log = NULL;
+	}
+
+	pthread_mutex_lock(&psp2GxmRec.mutex);
+	fp = psp2GxmRec.log;
+	psp2GxmRec.log = NULL;
+	pthread_mutex_unlock(&psp2GxmRec.mutex);
+
+	return fp != NULL && fclose(fp) != 0 ? -1 : 0;
+}
+
+void psp2GxmRecSetFrameCallback(Psp2GxmRecFrameCallback callback,
+	void *userData)
+{
+	pthread_mutex_lock(&psp2GxmRec.mutex);
+	psp2GxmRec.frameCallback = callback;
+	psp2GxmRec.frameUserData = userData;
+	pthread_mutex_unlock(&psp2GxmRec.mutex);
+}
+
+void psp2GxmRecSetErrorCallback(Psp2GxmRecErrorCallback callback,
+	void *userData)
+{
+	pthread_mutex_lock(&psp2GxmRec.mutex);
+	psp2GxmRec.errorCallback = callback;
+	psp2GxmRec.errorUserData = userData;
+	pthread_mutex_unlock(&psp2GxmRec.mutex);
+}
+
+void psp2GxmRecGetStats(Psp2GxmRecStats *frame, Psp2GxmRecStats *total)
+{
+	pthread_mutex_lock(&psp2GxmRec.mutex);
+	if (frame != NULL)
+		*frame = psp2GxmRec.frame;
+	if (total != NULL)
+		*total = psp2GxmRec.total;
+	pthread_mutex_unlock(&psp2GxmRec.mutex);
+}
+
+/* End a frame */
+static void psp2GxmRecEndFrame(void)
+{
+	Psp2GxmRecFrameCallback callback;
+	Psp2GxmRecStats stats;
+	SceGxmContext *context;
+	uint32_t frame;
+	void *userData;
+
+	pthread_mutex_lock(&psp2GxmRec.mutex);
+	context = psp2GxmRec.immediateContext;
+	frame = psp2GxmRec.total.frames;
+	pthread_mutex_unlock(&psp2GxmRec.mutex);
+
+	if (context != NULL) {
+		psp2GxmRecEmit(context, PSP2_GXM_REC_OP_FRAME, &frame, 1);
+		psp2GxmRecFlushLog(context);
+	}
+
+	pthread_mutex_lock(&psp2GxmRec.mutex);
+	if (context != NULL)
+		psp2GxmRecMergeStats(&context->stats);
+	psp2GxmRec.frame.frames++;
+	psp2GxmRec.total.frames++;
+	stats = psp2GxmRec.frame;
+	memset(&psp2GxmRec.frame, 0, sizeof(psp2GxmRec.frame));
+	callback = psp2GxmRec.frameCallback;
+	userData = psp2GxmRec.frameUserData;
+	pthread_mutex_unlock(&psp2GxmRec.mutex);
+
+	if (callback != NULL)
+		callback(&stats, userData);
+}
+
+/*
+ * Initialization, notifications and the display queue
+ */
+
+SceGxmErrorCode sceGxmInitialize(const SceGxmInitializeParams *params)
+{
+	if (params == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"NULL parameters");
+	if (params->displayQueueMaxPendingCount == 0
+		|| params->displayQueueMaxPendingCount
+			* params->displayQueueCallbackDataSize > 512)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_VALUE,
+			"the display queue needs %u pending entries of %u bytes",
+			params->displayQueueMaxPendingCount,
+			params->displayQueueCallbackDataSize);
+
+	pthread_mutex_lock(&psp2GxmRec.mutex);
+	if (psp2GxmRec.initialized) {
+		pthread_mutex_unlock(&psp2GxmRec.mutex);
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_ALREADY_INITIALIZED,
+			"already initialized");
+	}
+
+	psp2GxmRec.initialized = 1;
+	psp2GxmRec.params = *params;
+	memset(&psp2GxmRec.frame, 0, sizeof(psp2GxmRec.frame));
+	memset(&psp2GxmRec.total, 0, sizeof(psp2GxmRec.total));
+	pthread_mutex_unlock(&psp2GxmRec.mutex);
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmTerminate(void)
+{
+	SceGxmContext *context;
+	uint32_t renderTargetCount;
+	int initialized;
+
+	pthread_mutex_lock(&psp2GxmRec.mutex);
+	initialized = psp2GxmRec.initialized;
+	context = psp2GxmRec.immediateContext;
+	renderTargetCount = psp2GxmRec.renderTargetCount;
+	psp2GxmRec.initialized = 0;
+	pthread_mutex_unlock(&psp2GxmRec.mutex);
+
+	if (!initialized)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_UNINITIALIZED,
+			"not initialized");
+	if (context != NULL)
+		psp2GxmRecError(__func__, SCE_OK,
+			"the immediate context was not destroyed");
+	if (renderTargetCount != 0)
+		psp2GxmRecError(__func__, SCE_OK,
+			"%u render targets were not destroyed", renderTargetCount);
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmGetParameterBufferThreshold(
+	uint32_t *parameterBufferSize)
+{
+	if (parameterBufferSize == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"NULL size");
+
+	*parameterBufferSize = 0;
+
+	return SCE_OK;
+}
+
+volatile uint32_t *sceGxmGetNotificationRegion(void)
+{
+	return psp2GxmRec.notifications;
+}
+
+static int psp2GxmRecIsNotification(const SceGxmNotification *notification)
+{
+	return notification->address >= psp2GxmRec.notifications
+		&& notification->address
+			< psp2GxmRec.notifications + SCE_GXM_NOTIFICATION_COUNT;
+}
+
+/* Scenes complete as soon as they end, so the notifications are written then */
+static SceGxmErrorCode psp2GxmRecCheckNotification(const char *function,
+	const SceGxmNotification *notification)
+{
+	if (notification != NULL && !psp2GxmRecIsNotification(notification))
+		return psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_POINTER,
+			"notification %p is not in the notification region",
+			(const void *)notification->address);
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmNotificationWait(
+	const SceGxmNotification *notification)
+{
+	if (notification == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"NULL notification");
+	if (!psp2GxmRecIsNotification(notification))
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"notification %p is not in the notification region",
+			(const void *)notification->address);
+	if (*notification->address != notification->value)
+		psp2GxmRecError(__func__, SCE_OK,
+			"waiting for 0x%X at %p, which no scene writes",
+			notification->value, (const void *)notification->address);
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmWaitEvent(void)
+{
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmSetWarningEnabled(SceGxmWarning warning, bool enable)
+{
+	(void)warning;
+	(void)enable;
+
+	return SCE_OK;
+}
+
+bool sceGxmIsDebugVersion(void)
+{
+	return true;
+}
+
+SceGxmErrorCode sceGxmDisplayQueueAddEntry(SceGxmSyncObject *oldBuffer,
+	SceGxmSyncObject *newBuffer, const void *callbackData)
+{
+	SceGxmDisplayQueueCallback callback;
+
+	if (!psp2GxmRec.initialized)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_UNINITIALIZED,
+			"not initialized");
+	if (oldBuffer == NULL || oldBuffer->magic != PSP2_GXM_REC_MAGIC_SYNC_OBJECT
+		|| newBuffer == NULL
+		|| newBuffer->magic != PSP2_GXM_REC_MAGIC_SYNC_OBJECT)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad sync object");
+	if (callbackData == NULL
+		&& psp2GxmRec.params.displayQueueCallbackDataSize != 0)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"NULL callback data");
+
+	callback = psp2GxmRec.params.displayQueueCallback;
+	if (callback != NULL)
+		callback(callbackData);
+
+	psp2GxmRecEndFrame();
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmDisplayQueueFinish(void)
+{
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmPadHeartbeat(const SceGxmColorSurface *displaySurface,
+	SceGxmSyncObject *displaySyncObject)
+{
+	if (displaySurface == NULL || displaySyncObject == NULL
+		|| displaySyncObject->magic != PSP2_GXM_REC_MAGIC_SYNC_OBJECT)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad surface or sync object");
+
+	psp2GxmRecEndFrame();
+
+	return SCE_OK;
+}
+
+/*
+ * Sync objects and render targets
+ */
+
+SceGxmErrorCode sceGxmSyncObjectCreate(SceGxmSyncObject **syncObject)
+{
+	SceGxmSyncObject *object;
+
+	if (syncObject == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"NULL sync object");
+
+	object = malloc(sizeof(*object));
+	if (object == NULL)
+		return SCE_GXM_ERROR_OUT_OF_MEMORY;
+
+	object->magic = PSP2_GXM_REC_MAGIC_SYNC_OBJECT;
+	*syncObject = object;
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmSyncObjectDestroy(SceGxmSyncObject *syncObject)
+{
+	if (syncObject == NULL
+		|| syncObject->magic != PSP2_GXM_REC_MAGIC_SYNC_OBJECT)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad sync object");
+
+	syncObject->magic = PSP2_GXM_REC_MAGIC_DEAD;
+	free(syncObject);
+
+	return SCE_OK;
+}
+
+static SceGxmErrorCode psp2GxmRecCheckRenderTargetParams(const char *function,
+	const SceGxmRenderTargetParams *params)
+{
+	if (params == NULL)
+		return psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_POINTER,
+			"NULL parameters");
+	if (params->width == 0 || params->width > 4096
+		|| params->height == 0 || params->height > 4096)
+		return psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_VALUE,
+			"bad size %ux%u", params->width, params->height);
+	if (params->scenesPerFrame == 0
+		|| params->scenesPerFrame > SCE_GXM_MAX_SCENES_PER_RENDERTARGET)
+		return psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_VALUE,
+			"bad scene count %u", params->scenesPerFrame);
+	if (params->multisampleMode > SCE_GXM_MULTISAMPLE_4X)
+		return psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_VALUE,
+			"bad multisample mode %u", params->multisampleMode);
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmGetRenderTargetMemSize(
+	const SceGxmRenderTargetParams *params, uint32_t *driverMemSize)
+{
+	SceGxmErrorCode error;
+	uint32_t tiles;
+
+	error = psp2GxmRecCheckRenderTargetParams(__func__, params);
+	if (error != SCE_OK)
+		return error;
+	if (driverMemSize == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"NULL size");
+
+	// A nominal size that grows with the tiles and the scenes.
+	tiles = ((params->width + 31) / 32) * ((params->height + 31) / 32);
+	*driverMemSize = (tiles * 64 * params->scenesPerFrame + 0xFFFF)
+		& ~0xFFFFU;
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmCreateRenderTarget(
+	const SceGxmRenderTargetParams *params, SceGxmRenderTarget **renderTarget)
+{
+	SceGxmRenderTarget *target;
+	SceGxmErrorCode error;
+
+	error = psp2GxmRecCheckRenderTargetParams(__func__, params);
+	if (error != SCE_OK)
+		return error;
+	if (renderTarget == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"NULL render target");
+
+	pthread_mutex_lock(&psp2GxmRec.mutex);
+	if (!psp2GxmRec.initialized) {
+		pthread_mutex_unlock(&psp2GxmRec.mutex);
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_UNINITIALIZED,
+			"not initialized");
+	}
+	if (psp2GxmRec.renderTargetCount >= SCE_GXM_MAX_RENDER_TARGETS) {
+		pthread_mutex_unlock(&psp2GxmRec.mutex);
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_OUT_OF_RENDER_TARGETS,
+			"more than %u render targets", SCE_GXM_MAX_RENDER_TARGETS);
+	}
+	psp2GxmRec.renderTargetCount++;
+	pthread_mutex_unlock(&psp2GxmRec.mutex);
+
+	target = malloc(sizeof(*target));
+	if (target == NULL) {
+		pthread_mutex_lock(&psp2GxmRec.mutex);
+		psp2GxmRec.renderTargetCount--;
+		pthread_mutex_unlock(&psp2GxmRec.mutex);
+		return SCE_GXM_ERROR_OUT_OF_MEMORY;
+	}
+
+	target->magic = PSP2_GXM_REC_MAGIC_RENDER_TARGET;
+	target->params = *params;
+	*renderTarget = target;
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmRenderTargetGetDriverMemBlock(
+	const SceGxmRenderTarget *renderTarget, SceUID *driverMemBlock)
+{
+	if (renderTarget == NULL
+		|| renderTarget->magic != PSP2_GXM_REC_MAGIC_RENDER_TARGET
+		|| driverMemBlock == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad render target");
+
+	*driverMemBlock = renderTarget->params.driverMemBlock;
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmDestroyRenderTarget(SceGxmRenderTarget *renderTarget)
+{
+	if (renderTarget == NULL
+		|| renderTarget->magic != PSP2_GXM_REC_MAGIC_RENDER_TARGET)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad render target");
+
+	pthread_mutex_lock(&psp2GxmRec.mutex);
+	psp2GxmRec.renderTargetCount--;
+	pthread_mutex_unlock(&psp2GxmRec.mutex);
+
+	renderTarget->magic = PSP2_GXM_REC_MAGIC_DEAD;
+	free(renderTarget);
+
+	return SCE_OK;
+}
+
+/*
+ * Contexts
+ */
+
+static int psp2GxmRecIsContext(const SceGxmContext *context)
+{
+	return context != NULL && context->magic == PSP2_GXM_REC_MAGIC_CONTEXT;
+}
+
+static void psp2GxmRecResetState(SceGxmContext *context)
+{
+	context->vertexProgram = NULL;
+	context->fragmentProgram = NULL;
+	context->precomputedVertexState = NULL;
+	context->precomputedFragmentState = NULL;
+	memset(context->vertexStreams, 0, sizeof(context->vertexStreams));
+	memset(context->textures, 0, sizeof(context->textures));
+	memset(context->uniformBuffers, 0, sizeof(context->uniformBuffers));
+	memset(context->defaultUniformBuffers, 0,
+		sizeof(context->defaultUniformBuffers));
+	memset(context->statesSet, 0, sizeof(context->statesSet));
+}
+
+SceGxmErrorCode sceGxmCreateContext(const SceGxmContextParams *params,
+	SceGxmContext **immediateContext)
+{
+	SceGxmContext *context;
+
+	if (params == NULL || immediateContext == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"NULL parameters or context");
+	if (params->hostMem == NULL
+		|| params->hostMemSize < SCE_GXM_MINIMUM_CONTEXT_HOST_MEM_SIZE)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_VALUE,
+			"host memory of %u bytes", params->hostMemSize);
+	if (params->vdmRingBufferMem == NULL
+		|| params->vertexRingBufferMem == NULL
+		|| params->fragmentRingBufferMem == NULL
+		|| params->fragmentUsseRingBufferMem == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"NULL ring buffer");
+	if (!psp2GxmRecIsMapped(params->vertexRingBufferMem,
+			params->vertexRingBufferMemSize, SCE_GXM_MEMORY_ATTRIB_READ)
+		|| !psp2GxmRecIsMapped(params->fragmentRingBufferMem,
+			params->fragmentRingBufferMemSize, SCE_GXM_MEMORY_ATTRIB_READ))
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_VALUE,
+			"the uniform ring buffers are not mapped");
+
+	context = calloc(1, sizeof(*context));
+	if (context == NULL)
+		return SCE_GXM_ERROR_OUT_OF_MEMORY;
+
+	context->magic = PSP2_GXM_REC_MAGIC_CONTEXT;
+	context->type = SCE_GXM_CONTEXT_TYPE_IMMEDIATE;
+	context->buffers[PSP2_GXM_REC_VERTEX].mem = params->vertexRingBufferMem;
+	context->buffers[PSP2_GXM_REC_VERTEX].size =
+		params->vertexRingBufferMemSize;
+	context->buffers[PSP2_GXM_REC_FRAGMENT].mem =
+		params->fragmentRingBufferMem;
+	context->buffers[PSP2_GXM_REC_FRAGMENT].size =
+		params->fragmentRingBufferMemSize;
+
+	pthread_mutex_lock(&psp2GxmRec.mutex);
+	if (!psp2GxmRec.initialized || psp2GxmRec.immediateContext != NULL) {
+		pthread_mutex_unlock(&psp2GxmRec.mutex);
+		free(context);
+		return psp2GxmRecError(__func__, psp2GxmRec.initialized ?
+				SCE_GXM_ERROR_ALREADY_INITIALIZED : SCE_GXM_ERROR_UNINITIALIZED,
+			psp2GxmRec.initialized ? "an immediate context exists" :
+				"not initialized");
+	}
+
+	if (psp2GxmRec.log != NULL) {
+		context->log = malloc(PSP2_GXM_REC_LOG_BUFFER_WORDS
+			* sizeof(*context->log));
+		if (context->log == NULL) {
+			pthread_mutex_unlock(&psp2GxmRec.mutex);
+			free(context);
+			return SCE_GXM_ERROR_OUT_OF_MEMORY;
+		}
+	}
+
+	psp2GxmRec.immediateContext = context;
+	pthread_mutex_unlock(&psp2GxmRec.mutex);
+
+	*immediateContext = context;
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmDestroyContext(SceGxmContext *immediateContext)
+{
+	if (!psp2GxmRecIsContext(immediateContext)
+		|| immediateContext->type != SCE_GXM_CONTEXT_TYPE_IMMEDIATE)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad immediate context");
+	if (immediateContext->active)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_WITHIN_SCENE,
+			"within a scene");
+
+	psp2GxmRecFlushLog(immediateContext);
+
+	pthread_mutex_lock(&psp2GxmRec.mutex);
+	psp2GxmRecMergeStats(&immediateContext->stats);
+	psp2GxmRec.immediateContext = NULL;
+	pthread_mutex_unlock(&psp2GxmRec.mutex);
+
+	immediateContext->magic = PSP2_GXM_REC_MAGIC_DEAD;
+	free(immediateContext->log);
+	free(immediateContext);
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmCreateDeferredContext(
+	SceGxmDeferredContextParams *params, SceGxmContext **deferredContext)
+{
+	SceGxmContext *context;
+	uint32_t id;
+
+	if (params == NULL || deferredContext == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"NULL parameters or context");
+	if (params->hostMem == NULL
+		|| params->hostMemSize < SCE_GXM_MINIMUM_CONTEXT_HOST_MEM_SIZE)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_VALUE,
+			"host memory of %u bytes", params->hostMemSize);
+	if ((params->vdmBufferMem != NULL && params->vdmBufferMemSize
+			< SCE_GXM_MINIMUM_DEFERRED_CONTEXT_BUFFER_SIZE)
+		|| (params->vertexBufferMem != NULL && params->vertexBufferMemSize
+			< SCE_GXM_MINIMUM_DEFERRED_CONTEXT_BUFFER_SIZE)
+		|| (params->fragmentBufferMem != NULL && params->fragmentBufferMemSize
+			< SCE_GXM_MINIMUM_DEFERRED_CONTEXT_BUFFER_SIZE))
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_VALUE,
+			"buffer smaller than %u bytes",
+			SCE_GXM_MINIMUM_DEFERRED_CONTEXT_BUFFER_SIZE);
+
+	context = calloc(1, sizeof(*context));
+	if (context == NULL)
+		return SCE_GXM_ERROR_OUT_OF_MEMORY;
+
+	pthread_mutex_lock(&psp2GxmRec.mutex);
+	for (id = 1; id <= PSP2_GXM_REC_MAX_DEFERRED_CONTEXTS; id++)
+		if (!psp2GxmRec.deferredContexts[id])
+			break;
+	if (!psp2GxmRec.initialized || id > PSP2_GXM_REC_MAX_DEFERRED_CONTEXTS) {
+		pthread_mutex_unlock(&psp2GxmRec.mutex);
+		free(context);
+		return psp2GxmRecError(__func__, psp2GxmRec.initialized ?
+				SCE_GXM_ERROR_OUT_OF_MEMORY : SCE_GXM_ERROR_UNINITIALIZED,
+			psp2GxmRec.initialized ? "too many deferred contexts" :
+				"not initialized");
+	}
+	psp2GxmRec.deferredContexts[id] = 1;
+	pthread_mutex_unlock(&psp2GxmRec.mutex);
+
+	context->magic = PSP2_GXM_REC_MAGIC_CONTEXT;
+	context->type = SCE_GXM_CONTEXT_TYPE_DEFERRED;
+	context->id = id;
+	context->params = *params;
+	context->vdm.mem = params->vdmBufferMem;
+	context->vdm.size = params->vdmBufferMemSize;
+	context->vdm.callback = params->vdmCallback;
+	context->buffers[PSP2_GXM_REC_VERTEX].mem = params->vertexBufferMem;
+	context->buffers[PSP2_GXM_REC_VERTEX].size = params->vertexBufferMemSize;
+	context->buffers[PSP2_GXM_REC_VERTEX].callback = params->vertexCallback;
+	context->buffers[PSP2_GXM_REC_FRAGMENT].mem = params->fragmentBufferMem;
+	context->buffers[PSP2_GXM_REC_FRAGMENT].size =
+		params->fragmentBufferMemSize;
+	context->buffers[PSP2_GXM_REC_FRAGMENT].callback =
+		params->fragmentCallback;
+	*deferredContext = context;
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmDestroyDeferredContext(SceGxmContext *deferredContext)
+{
+	if (!psp2GxmRecIsContext(deferredContext)
+		|| deferredContext->type != SCE_GXM_CONTEXT_TYPE_DEFERRED)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad deferred context");
+	if (deferredContext->active)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_WITHIN_COMMAND_LIST,
+			"within a command list");
+
+	pthread_mutex_lock(&psp2GxmRec.mutex);
+	psp2GxmRec.deferredContexts[deferredContext->id] = 0;
+	pthread_mutex_unlock(&psp2GxmRec.mutex);
+
+	deferredContext->magic = PSP2_GXM_REC_MAGIC_DEAD;
+	free(deferredContext);
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmGetContextType(const SceGxmContext *context,
+	SceGxmContextType *type)
+{
+	if (!psp2GxmRecIsContext(context) || type == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad context");
+
+	*type = context->type;
+
+	return SCE_OK;
+}
+
+#define PSP2_GXM_REC_DEFERRED_BUFFER(name, buffer)	\
+SceGxmErrorCode sceGxmGetDeferredContext##name##Buffer(	\
+	const SceGxmContext *deferredContext, void **mem)	\
+{	\
+	if (!psp2GxmRecIsContext(deferredContext)	\
+		|| deferredContext->type != SCE_GXM_CONTEXT_TYPE_DEFERRED	\
+		|| mem == NULL)	\
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,	\
+			"bad deferred context");	\
+	\
+	*mem = deferredContext->buffer.mem;	\
+	\
+	return SCE_OK;	\
+}	\
+	\
+SceGxmErrorCode sceGxmSetDeferredContext##name##Buffer(	\
+	SceGxmContext *deferredContext, void *mem, uint32_t size)	\
+{	\
+	if (!psp2GxmRecIsContext(deferredContext)	\
+		|| deferredContext->type != SCE_GXM_CONTEXT_TYPE_DEFERRED)	\
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,	\
+			"bad deferred context");	\
+	if (mem != NULL && size < SCE_GXM_MINIMUM_DEFERRED_CONTEXT_BUFFER_SIZE)	\
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_VALUE,	\
+			"buffer of %u bytes", size);	\
+	\
+	deferredContext->buffer.mem = (uint8_t *)mem;	\
+	deferredContext->buffer.size = mem != NULL ? size : 0;	\
+	deferredContext->buffer.offset = 0;	\
+	\
+	return SCE_OK;	\
+}
+
+PSP2_GXM_REC_DEFERRED_BUFFER(Vdm, vdm)
+PSP2_GXM_REC_DEFERRED_BUFFER(Vertex, buffers[PSP2_GXM_REC_VERTEX])
+PSP2_GXM_REC_DEFERRED_BUFFER(Fragment, buffers[PSP2_GXM_REC_FRAGMENT])
+
+#undef PSP2_GXM_REC_DEFERRED_BUFFER
+
+/*
+ * Scenes and command lists
+ */
+
+SceGxmErrorCode sceGxmBeginSceneEx(SceGxmContext *immediateContext,
+	uint32_t flags, const SceGxmRenderTarget *renderTarget,
+	const SceGxmValidRegion *validRegion, SceGxmSyncObject *vertexSyncObject,
+	SceGxmSyncObject *fragmentSyncObject,
+	const SceGxmColorSurface *colorSurface,
+	const SceGxmDepthStencilSurface *loadDepthStencilSurface,
+	const SceGxmDepthStencilSurface *storeDepthStencilSurface)
+{
+	uint32_t words[3];
+
+	if (!psp2GxmRecIsContext(immediateContext)
+		|| immediateContext->type != SCE_GXM_CONTEXT_TYPE_IMMEDIATE)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad immediate context");
+	if (immediateContext->active)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_WITHIN_SCENE,
+			"already within a scene");
+	if (renderTarget == NULL
+		|| renderTarget->magic != PSP2_GXM_REC_MAGIC_RENDER_TARGET)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad render target");
+	if ((vertexSyncObject != NULL
+			&& vertexSyncObject->magic != PSP2_GXM_REC_MAGIC_SYNC_OBJECT)
+		|| (fragmentSyncObject != NULL
+			&& fragmentSyncObject->magic != PSP2_GXM_REC_MAGIC_SYNC_OBJECT))
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad sync object");
+	if (validRegion != NULL && (validRegion->xMax >= renderTarget->params.width
+			|| validRegion->yMax >= renderTarget->params.height))
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_VALUE,
+			"the valid region is larger than the render target");
+	if (colorSurface == NULL && loadDepthStencilSurface == NULL
+		&& storeDepthStencilSurface == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"no surface");
+
+	immediateContext->active = 1;
+	immediateContext->renderTarget = renderTarget;
+	immediateContext->stats.scenes++;
+
+	words[0] = flags;
+	words[1] = renderTarget->params.width;
+	words[2] = renderTarget->params.height;
+	psp2GxmRecEmit(immediateContext, PSP2_GXM_REC_OP_BEGIN_SCENE, words, 3);
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmBeginScene(SceGxmContext *immediateContext,
+	uint32_t flags, const SceGxmRenderTarget *renderTarget,
+	const SceGxmValidRegion *validRegion, SceGxmSyncObject *vertexSyncObject,
+	SceGxmSyncObject *fragmentSyncObject,
+	const SceGxmColorSurface *colorSurface,
+	const SceGxmDepthStencilSurface *depthStencilSurface)
+{
+	return sceGxmBeginSceneEx(immediateContext, flags, renderTarget,
+		validRegion, vertexSyncObject, fragmentSyncObject, colorSurface,
+		depthStencilSurface, depthStencilSurface);
+}
+
+SceGxmErrorCode sceGxmMidSceneFlush(SceGxmContext *immediateContext,
+	uint32_t flags, SceGxmSyncObject *vertexSyncObject,
+	const SceGxmNotification *vertexNotification)
+{
+	SceGxmErrorCode error;
+
+	if (!psp2GxmRecIsContext(immediateContext)
+		|| immediateContext->type != SCE_GXM_CONTEXT_TYPE_IMMEDIATE)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad immediate context");
+	if (!immediateContext->active)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_NOT_WITHIN_SCENE,
+			"not within a scene");
+	if (vertexSyncObject != NULL
+		&& vertexSyncObject->magic != PSP2_GXM_REC_MAGIC_SYNC_OBJECT)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad sync object");
+
+	error = psp2GxmRecCheckNotification(__func__, vertexNotification);
+	if (error != SCE_OK)
+		return error;
+
+	psp2GxmRecEmit(immediateContext, PSP2_GXM_REC_OP_MID_SCENE_FLUSH,
+		&flags, 1);
+	if (vertexNotification != NULL)
+		*vertexNotification->address = vertexNotification->value;
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmEndScene(SceGxmContext *immediateContext,
+	const SceGxmNotification *vertexNotification,
+	const SceGxmNotification *fragmentNotification)
+{
+	SceGxmErrorCode error;
+
+	if (!psp2GxmRecIsContext(immediateContext)
+		|| immediateContext->type != SCE_GXM_CONTEXT_TYPE_IMMEDIATE)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad immediate context");
+	if (!immediateContext->active)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_NOT_WITHIN_SCENE,
+			"not within a scene");
+
+	error = psp2GxmRecCheckNotification(__func__, vertexNotification);
+	if (error == SCE_OK)
+		error = psp2GxmRecCheckNotification(__func__, fragmentNotification);
+	if (error != SCE_OK)
+		return error;
+
+	immediateContext->active = 0;
+	if (immediateContext->markerDepth != 0)
+		psp2GxmRecError(__func__, SCE_OK,
+			"%u user markers were not popped", immediateContext->markerDepth);
+
+	psp2GxmRecEmit(immediateContext, PSP2_GXM_REC_OP_END_SCENE, NULL, 0);
+	psp2GxmRecFlushLog(immediateContext);
+
+	pthread_mutex_lock(&psp2GxmRec.mutex);
+	psp2GxmRecMergeStats(&immediateContext->stats);
+	pthread_mutex_unlock(&psp2GxmRec.mutex);
+
+	if (vertexNotification != NULL)
+		*vertexNotification->address = vertexNotification->value;
+	if (fragmentNotification != NULL)
+		*fragmentNotification->address = fragmentNotification->value;
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmFinish(SceGxmContext *context)
+{
+	if (!psp2GxmRecIsContext(context)
+		|| context->type != SCE_GXM_CONTEXT_TYPE_IMMEDIATE)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad immediate context");
+	if (context->active)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_WITHIN_SCENE,
+			"within a scene");
+
+	psp2GxmRecEmit(context, PSP2_GXM_REC_OP_FINISH, NULL, 0);
+	psp2GxmRecFlushLog(context);
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmVertexFence(SceGxmContext *context)
+{
+	if (!psp2GxmRecIsContext(context))
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad context");
+
+	psp2GxmRecEmit(context, PSP2_GXM_REC_OP_VERTEX_FENCE, NULL, 0);
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmBeginCommandList(SceGxmContext *deferredContext)
+{
+	Psp2GxmRecCommandList header;
+
+	if (!psp2GxmRecIsContext(deferredContext)
+		|| deferredContext->type != SCE_GXM_CONTEXT_TYPE_DEFERRED)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad deferred context");
+	if (deferredContext->active)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_WITHIN_COMMAND_LIST,
+			"already within a command list");
+
+	// The list starts with its header, and a link can follow it.
+	deferredContext->commandList = psp2GxmRecReserve(deferredContext,
+		&deferredContext->vdm,
+		sizeof(header) + PSP2_GXM_REC_LINK_WORDS * sizeof(uint32_t));
+	if (deferredContext->commandList == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_RESERVE_FAILED,
+			"out of VDM buffer memory");
+	deferredContext->vdm.offset -= PSP2_GXM_REC_LINK_WORDS * sizeof(uint32_t);
+
+	deferredContext->active = 1;
+	deferredContext->failed = 0;
+	deferredContext->markerDepth = 0;
+	memset(&deferredContext->stats, 0, sizeof(deferredContext->stats));
+	psp2GxmRecResetState(deferredContext);
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmEndCommandList(SceGxmContext *deferredContext,
+	SceGxmCommandList *commandList)
+{
+	Psp2GxmRecCommandList header;
+
+	if (!psp2GxmRecIsContext(deferredContext)
+		|| deferredContext->type != SCE_GXM_CONTEXT_TYPE_DEFERRED
+		|| commandList == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad deferred context or command list");
+	if (!deferredContext->active)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_NOT_WITHIN_COMMAND_LIST,
+			"not within a command list");
+
+	psp2GxmRecEmit(deferredContext, PSP2_GXM_REC_OP_END, NULL, 0);
+	deferredContext->active = 0;
+	if (deferredContext->failed)
+		return SCE_GXM_ERROR_RESERVE_FAILED;
+	if (deferredContext->markerDepth != 0)
+		psp2GxmRecError(__func__, SCE_OK, "%u user markers were not popped",
+			deferredContext->markerDepth);
+
+	header.magic = PSP2_GXM_REC_MAGIC_COMMAND_LIST;
+	header.context = deferredContext->id;
+	header.stats = deferredContext->stats;
+	memcpy(deferredContext->commandList, &header, sizeof(header));
+
+	memset(commandList, 0, sizeof(*commandList));
+	memcpy(commandList->data, &deferredContext->commandList,
+		sizeof(deferredContext->commandList));
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmExecuteCommandList(SceGxmContext *immediateContext,
+	SceGxmCommandList *commandList)
+{
+	Psp2GxmRecCommandList header;
+	const uint32_t *words;
+	uint8_t *list;
+	uint32_t record, id;
+
+	if (!psp2GxmRecIsContext(immediateContext)
+		|| immediateContext->type != SCE_GXM_CONTEXT_TYPE_IMMEDIATE
+		|| commandList == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad immediate context or command list");
+	if (!immediateContext->active)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_NOT_WITHIN_SCENE,
+			"not within a scene");
+
+	memcpy(&list, commandList->data, sizeof(list));
+	if (list != NULL)
+		memcpy(&header, list, sizeof(header));
+	if (list == NULL || header.magic != PSP2_GXM_REC_MAGIC_COMMAND_LIST)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_VALUE,
+			"bad command list");
+
+	id = header.context;
+	psp2GxmRecEmit(immediateContext, PSP2_GXM_REC_OP_EXECUTE_COMMAND_LIST,
+		&id, 1);
+
+	// Copy the records of the list to the log.
+	words = (const uint32_t *)(list + sizeof(header));
+	if (immediateContext->log != NULL)
+		for (;;) {
+			record = words[0];
+			if (PSP2_GXM_REC_RECORD_OP(record) == PSP2_GXM_REC_OP_END)
+				break;
+			if (PSP2_GXM_REC_RECORD_OP(record) == PSP2_GXM_REC_OP_LINK) {
+				memcpy(&words, words + 1, sizeof(words));
+				continue;
+			}
+			psp2GxmRecLog(immediateContext, words,
+				PSP2_GXM_REC_RECORD_SIZE(record) + 1);
+			words += PSP2_GXM_REC_RECORD_SIZE(record) + 1;
+		}
+
+	header.stats.commandLists++;
+	psp2GxmRecAddStats(&immediateContext->stats, &header.stats);
+
+	// The state of the immediate context is undefined after the list.
+	psp2GxmRecResetState(immediateContext);
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmPushUserMarker(SceGxmContext *context, const char *tag)
+{
+	if (!psp2GxmRecIsContext(context) || tag == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad context or tag");
+
+	context->markerDepth++;
+	psp2GxmRecEmitString(context, PSP2_GXM_REC_OP_PUSH_USER_MARKER, tag);
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmPopUserMarker(SceGxmContext *context)
+{
+	if (!psp2GxmRecIsContext(context))
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad context");
+	if (context->markerDepth == 0)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_VALUE,
+			"no user marker to pop");
+
+	context->markerDepth--;
+	psp2GxmRecEmit(context, PSP2_GXM_REC_OP_POP_USER_MARKER, NULL, 0);
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmSetUserMarker(SceGxmContext *context, const char *tag)
+{
+	if (!psp2GxmRecIsContext(context) || tag == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad context or tag");
+
+	psp2GxmRecEmitString(context, PSP2_GXM_REC_OP_SET_USER_MARKER, tag);
+
+	return SCE_OK;
+}
+
+/*
+ * Programs and resources
+ */
+
+/* Count a state change, and return whether it changes anything */
+static int psp2GxmRecChange(SceGxmContext *context, int changed)
+{
+	if (changed)
+		context->stats.stateChanges++;
+	else
+		context->stats.redundantStateChanges++;
+
+	return changed;
+}
+
+void sceGxmSetVertexProgram(SceGxmContext *context,
+	const SceGxmVertexProgram *vertexProgram)
+{
+	if (!psp2GxmRecIsContext(context) || vertexProgram == NULL
+		|| vertexProgram->magic != PSP2_GXM_REC_MAGIC_VERTEX_PROGRAM) {
+		psp2GxmRecError(__func__, SCE_OK, "bad context or vertex program");
+		return;
+	}
+
+	if (psp2GxmRecChange(context, context->vertexProgram != vertexProgram)) {
+		context->stats.programChanges++;
+		context->vertexProgram = vertexProgram;
+		psp2GxmRecEmitPointer(context, PSP2_GXM_REC_OP_SET_VERTEX_PROGRAM,
+			vertexProgram);
+	}
+}
+
+void sceGxmSetFragmentProgram(SceGxmContext *context,
+	const SceGxmFragmentProgram *fragmentProgram)
+{
+	if (!psp2GxmRecIsContext(context) || fragmentProgram == NULL
+		|| fragmentProgram->magic != PSP2_GXM_REC_MAGIC_FRAGMENT_PROGRAM) {
+		psp2GxmRecError(__func__, SCE_OK, "bad context or fragment program");
+		return;
+	}
+
+	if (psp2GxmRecChange(context,
+			context->fragmentProgram != fragmentProgram)) {
+		context->stats.programChanges++;
+		context->fragmentProgram = fragmentProgram;
+		psp2GxmRecEmitPointer(context, PSP2_GXM_REC_OP_SET_FRAGMENT_PROGRAM,
+			fragmentProgram);
+	}
+}
+
+static SceGxmErrorCode psp2GxmRecReserveDefaultUniformBuffer(
+	const char *function, SceGxmContext *context, int stage,
+	void **uniformBuffer)
+{
+	Psp2GxmRecBuffer *buffer;
+	void *mem;
+
+	if (!psp2GxmRecIsContext(context) || uniformBuffer == NULL)
+		return psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad context or buffer");
+	if (!context->active)
+		return psp2GxmRecError(function,
+			context->type == SCE_GXM_CONTEXT_TYPE_IMMEDIATE ?
+				SCE_GXM_ERROR_NOT_WITHIN_SCENE :
+				SCE_GXM_ERROR_NOT_WITHIN_COMMAND_LIST,
+			"not within a scene or command list");
+	if ((stage == PSP2_GXM_REC_VERTEX ? (const void *)context->vertexProgram :
+			(const void *)context->fragmentProgram) == NULL)
+		return psp2GxmRecError(function, SCE_GXM_ERROR_NULL_PROGRAM,
+			"no program");
+
+	// The immediate context uses its ring, wrapping around.
+	buffer = context->buffers + stage;
+	if (context->type == SCE_GXM_CONTEXT_TYPE_IMMEDIATE) {
+		if (buffer->size < PSP2_GXM_REC_DEFAULT_UNIFORM_BUFFER_SIZE)
+			return psp2GxmRecError(function, SCE_GXM_ERROR_RESERVE_FAILED,
+				"the ring buffer is too small");
+		if (buffer->size - buffer->offset
+				< PSP2_GXM_REC_DEFAULT_UNIFORM_BUFFER_SIZE)
+			buffer->offset = 0;
+	}
+
+	mem = psp2GxmRecReserve(context, buffer,
+		PSP2_GXM_REC_DEFAULT_UNIFORM_BUFFER_SIZE);
+	if (mem == NULL)
+		return psp2GxmRecError(function, SCE_GXM_ERROR_RESERVE_FAILED,
+			"out of %s buffer memory",
+			stage == PSP2_GXM_REC_VERTEX ? "vertex" : "fragment");
+
+	context->stats.stateChanges++;
+	context->stats.uniformBufferChanges++;
+	context->defaultUniformBuffers[stage] = mem;
+	psp2GxmRecEmitPointer(context, stage == PSP2_GXM_REC_VERTEX ?
+			PSP2_GXM_REC_OP_SET_VERTEX_DEFAULT_UNIFORM_BUFFER :
+			PSP2_GXM_REC_OP_SET_FRAGMENT_DEFAULT_UNIFORM_BUFFER,
+		NULL);
+	*uniformBuffer = mem;
+
+	return SCE_OK;
+}
+
+static SceGxmErrorCode psp2GxmRecSetDefaultUniformBuffer(
+	const char *function, SceGxmContext *context, int stage,
+	const void *bufferData)
+{
+	if (!psp2GxmRecIsContext(context) || bufferData == NULL)
+		return psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad context or buffer");
+	if (!psp2GxmRecIsMapped(bufferData, 4, SCE_GXM_MEMORY_ATTRIB_READ))
+		return psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_POINTER,
+			"the buffer %p is not mapped", bufferData);
+
+	if (psp2GxmRecChange(context,
+			context->defaultUniformBuffers[stage] != bufferData)) {
+		context->stats.uniformBufferChanges++;
+		context->defaultUniformBuffers[stage] = bufferData;
+		psp2GxmRecEmitPointer(context, stage == PSP2_GXM_REC_VERTEX ?
+				PSP2_GXM_REC_OP_SET_VERTEX_DEFAULT_UNIFORM_BUFFER :
+				PSP2_GXM_REC_OP_SET_FRAGMENT_DEFAULT_UNIFORM_BUFFER,
+			bufferData);
+	}
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmReserveVertexDefaultUniformBuffer(
+	SceGxmContext *context, void **uniformBuffer)
+{
+	return psp2GxmRecReserveDefaultUniformBuffer(__func__, context,
+		PSP2_GXM_REC_VERTEX, uniformBuffer);
+}
+
+SceGxmErrorCode sceGxmSetVertexDefaultUniformBuffer(SceGxmContext *context,
+	const void *bufferData)
+{
+	return psp2GxmRecSetDefaultUniformBuffer(__func__, context,
+		PSP2_GXM_REC_VERTEX, bufferData);
+}
+
+SceGxmErrorCode sceGxmReserveFragmentDefaultUniformBuffer(
+	SceGxmContext *context, void **uniformBuffer)
+{
+	return psp2GxmRecReserveDefaultUniformBuffer(__func__, context,
+		PSP2_GXM_REC_FRAGMENT, uniformBuffer);
+}
+
+SceGxmErrorCode sceGxmSetFragmentDefaultUniformBuffer(SceGxmContext *context,
+	const void *bufferData)
+{
+	return psp2GxmRecSetDefaultUniformBuffer(__func__, context,
+		PSP2_GXM_REC_FRAGMENT, bufferData);
+}
+
+SceGxmErrorCode sceGxmSetVertexStream(SceGxmContext *context,
+	uint32_t streamIndex, const void *streamData)
+{
+	uint32_t words[3];
+
+	if (!psp2GxmRecIsContext(context) || streamData == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad context or stream");
+	if (streamIndex >= SCE_GXM_MAX_VERTEX_STREAMS)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_VALUE,
+			"bad stream index %u", streamIndex);
+
+	if (psp2GxmRecChange(context,
+			context->vertexStreams[streamIndex] != streamData)) {
+		context->vertexStreams[streamIndex] = streamData;
+		words[0] = streamIndex;
+		psp2GxmRecPutPointer(words + 1, streamData);
+		psp2GxmRecEmit(context, PSP2_GXM_REC_OP_SET_VERTEX_STREAM, words, 3);
+	}
+
+	return SCE_OK;
+}
+
+static SceGxmErrorCode psp2GxmRecSetTexture(const char *function,
+	SceGxmContext *context, int stage, uint32_t textureIndex,
+	const SceGxmTexture *texture)
+{
+	uint32_t words[1 + SCE_GXM_NUM_TEXTURE_CONTROL_WORDS];
+
+	if (!psp2GxmRecIsContext(context) || texture == NULL)
+		return psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad context or texture");
+	if (textureIndex >= SCE_GXM_MAX_TEXTURE_UNITS)
+		return psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_VALUE,
+			"bad texture index %u", textureIndex);
+
+	if (psp2GxmRecChange(context, memcmp(context->textures[stage] + textureIndex,
+			texture, sizeof(*texture)) != 0)) {
+		context->stats.textureChanges++;
+		context->textures[stage][textureIndex] = *texture;
+		words[0] = textureIndex;
+		memcpy(words + 1, texture->controlWords, sizeof(*texture));
+		psp2GxmRecEmit(context, stage == PSP2_GXM_REC_VERTEX ?
+				PSP2_GXM_REC_OP_SET_VERTEX_TEXTURE :
+				PSP2_GXM_REC_OP_SET_FRAGMENT_TEXTURE,
+			words, 1 + SCE_GXM_NUM_TEXTURE_CONTROL_WORDS);
+	}
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmSetVertexTexture(SceGxmContext *context,
+	uint32_t textureIndex, const SceGxmTexture *texture)
+{
+	return psp2GxmRecSetTexture(__func__, context, PSP2_GXM_REC_VERTEX,
+		textureIndex, texture);
+}
+
+SceGxmErrorCode sceGxmSetFragmentTexture(SceGxmContext *context,
+	uint32_t textureIndex, const SceGxmTexture *texture)
+{
+	return psp2GxmRecSetTexture(__func__, context, PSP2_GXM_REC_FRAGMENT,
+		textureIndex, texture);
+}
+
+static SceGxmErrorCode psp2GxmRecSetUniformBuffer(const char *function,
+	SceGxmContext *context, int stage, uint32_t bufferIndex,
+	const void *bufferData)
+{
+	uint32_t words[3];
+
+	if (!psp2GxmRecIsContext(context) || bufferData == NULL)
+		return psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad context or buffer");
+	if (bufferIndex >= SCE_GXM_MAX_UNIFORM_BUFFERS)
+		return psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_VALUE,
+			"bad buffer index %u", bufferIndex);
+	if (!psp2GxmRecIsMapped(bufferData, 4, SCE_GXM_MEMORY_ATTRIB_READ))
+		return psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_POINTER,
+			"the buffer %p is not mapped", bufferData);
+
+	if (psp2GxmRecChange(context,
+			context->uniformBuffers[stage][bufferIndex] != bufferData)) {
+		context->stats.uniformBufferChanges++;
+		context->uniformBuffers[stage][bufferIndex] = bufferData;
+		words[0] = bufferIndex;
+		psp2GxmRecPutPointer(words + 1, bufferData);
+		psp2GxmRecEmit(context, stage == PSP2_GXM_REC_VERTEX ?
+				PSP2_GXM_REC_OP_SET_VERTEX_UNIFORM_BUFFER :
+				PSP2_GXM_REC_OP_SET_FRAGMENT_UNIFORM_BUFFER,
+			words, 3);
+	}
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmSetVertexUniformBuffer(SceGxmContext *context,
+	uint32_t bufferIndex, const void *bufferData)
+{
+	return psp2GxmRecSetUniformBuffer(__func__, context, PSP2_GXM_REC_VERTEX,
+		bufferIndex, bufferData);
+}
+
+SceGxmErrorCode sceGxmSetFragmentUniformBuffer(SceGxmContext *context,
+	uint32_t bufferIndex, const void *bufferData)
+{
+	return psp2GxmRecSetUniformBuffer(__func__, context,
+		PSP2_GXM_REC_FRAGMENT, bufferIndex, bufferData);
+}
+
+SceGxmErrorCode sceGxmSetUniformDataF(void *uniformBuffer,
+	const SceGxmProgramParameter *parameter, uint32_t componentOffset,
+	uint32_t componentCount, const float *sourceData)
+{
+	(void)componentOffset;
+
+	if (uniformBuffer == NULL || parameter == NULL || sourceData == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"NULL buffer, parameter or data");
+	if (componentCount == 0)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_VALUE,
+			"no component");
+
+	pthread_mutex_lock(&psp2GxmRec.mutex);
+	psp2GxmRec.frame.uniformBytes += componentCount * sizeof(float);
+	psp2GxmRec.total.uniformBytes += componentCount * sizeof(float);
+	pthread_mutex_unlock(&psp2GxmRec.mutex);
+
+	return SCE_OK;
+}
+
+/*
+ * Render states
+ */
+
+static void psp2GxmRecSetState(SceGxmContext *context, uint32_t state,
+	const uint32_t *values, uint32_t count)
+{
+	uint32_t words[1 + PSP2_GXM_REC_STATE_MAX_VALUES];
+	uint32_t bit;
+
+	bit = 1U << (state % 32);
+	if (!psp2GxmRecChange(context, !(context->statesSet[state / 32] & bit)
+			|| memcmp(context->states[state], values,
+				count * sizeof(*values)) != 0))
+		return;
+
+	context->statesSet[state / 32] |= bit;
+	memcpy(context->states[state], values, count * sizeof(*values));
+	words[0] = state;
+	memcpy(words + 1, values, count * sizeof(*values));
+	psp2GxmRecEmit(context, PSP2_GXM_REC_OP_SET_STATE, words, count + 1);
+}
+
+#define PSP2_GXM_REC_SETTER(function, state, type)	\
+void function(SceGxmContext *context, type value)	\
+{	\
+	uint32_t word;	\
+	\
+	if (!psp2GxmRecIsContext(context)) {	\
+		psp2GxmRecError(__func__, SCE_OK, "bad context");	\
+		return;	\
+	}	\
+	\
+	word = (uint32_t)value;	\
+	psp2GxmRecSetState(context, state, &word, 1);	\
+}
+
+PSP2_GXM_REC_SETTER(sceGxmSetFrontDepthFunc,
+	PSP2_GXM_REC_STATE_FRONT_DEPTH_FUNC, SceGxmDepthFunc)
+PSP2_GXM_REC_SETTER(sceGxmSetBackDepthFunc,
+	PSP2_GXM_REC_STATE_BACK_DEPTH_FUNC, SceGxmDepthFunc)
+PSP2_GXM_REC_SETTER(sceGxmSetFrontFragmentProgramEnable,
+	PSP2_GXM_REC_STATE_FRONT_FRAGMENT_PROGRAM_ENABLE,
+	SceGxmFragmentProgramMode)
+PSP2_GXM_REC_SETTER(sceGxmSetBackFragmentProgramEnable,
+	PSP2_GXM_REC_STATE_BACK_FRAGMENT_PROGRAM_ENABLE,
+	SceGxmFragmentProgramMode)
+PSP2_GXM_REC_SETTER(sceGxmSetFrontDepthWriteEnable,
+	PSP2_GXM_REC_STATE_FRONT_DEPTH_WRITE_ENABLE, SceGxmDepthWriteMode)
+PSP2_GXM_REC_SETTER(sceGxmSetBackDepthWriteEnable,
+	PSP2_GXM_REC_STATE_BACK_DEPTH_WRITE_ENABLE, SceGxmDepthWriteMode)
+PSP2_GXM_REC_SETTER(sceGxmSetFrontLineFillLastPixelEnable,
+	PSP2_GXM_REC_STATE_FRONT_LINE_FILL_LAST_PIXEL_ENABLE,
+	SceGxmLineFillLastPixelMode)
+PSP2_GXM_REC_SETTER(sceGxmSetBackLineFillLastPixelEnable,
+	PSP2_GXM_REC_STATE_BACK_LINE_FILL_LAST_PIXEL_ENABLE,
+	SceGxmLineFillLastPixelMode)
+PSP2_GXM_REC_SETTER(sceGxmSetFrontStencilRef,
+	PSP2_GXM_REC_STATE_FRONT_STENCIL_REF, uint8_t)
+PSP2_GXM_REC_SETTER(sceGxmSetBackStencilRef,
+	PSP2_GXM_REC_STATE_BACK_STENCIL_REF, uint8_t)
+PSP2_GXM_REC_SETTER(sceGxmSetFrontPointLineWidth,
+	PSP2_GXM_REC_STATE_FRONT_POINT_LINE_WIDTH, uint32_t)
+PSP2_GXM_REC_SETTER(sceGxmSetBackPointLineWidth,
+	PSP2_GXM_REC_STATE_BACK_POINT_LINE_WIDTH, uint32_t)
+PSP2_GXM_REC_SETTER(sceGxmSetFrontPolygonMode,
+	PSP2_GXM_REC_STATE_FRONT_POLYGON_MODE, SceGxmPolygonMode)
+PSP2_GXM_REC_SETTER(sceGxmSetBackPolygonMode,
+	PSP2_GXM_REC_STATE_BACK_POLYGON_MODE, SceGxmPolygonMode)
+PSP2_GXM_REC_SETTER(sceGxmSetTwoSidedEnable,
+	PSP2_GXM_REC_STATE_TWO_SIDED_ENABLE, SceGxmTwoSidedMode)
+PSP2_GXM_REC_SETTER(sceGxmSetWClampEnable,
+	PSP2_GXM_REC_STATE_W_CLAMP_ENABLE, SceGxmWClampMode)
+PSP2_GXM_REC_SETTER(sceGxmSetCullMode,
+	PSP2_GXM_REC_STATE_CULL_MODE, SceGxmCullMode)
+PSP2_GXM_REC_SETTER(sceGxmSetViewportEnable,
+	PSP2_GXM_REC_STATE_VIEWPORT_ENABLE, SceGxmViewportMode)
+PSP2_GXM_REC_SETTER(sceGxmSetWBufferEnable,
+	PSP2_GXM_REC_STATE_W_BUFFER_ENABLE, SceGxmWBufferMode)
+PSP2_GXM_REC_SETTER(sceGxmSetFrontVisibilityTestIndex,
+	PSP2_GXM_REC_STATE_FRONT_VISIBILITY_TEST_INDEX, uint32_t)
+PSP2_GXM_REC_SETTER(sceGxmSetBackVisibilityTestIndex,
+	PSP2_GXM_REC_STATE_BACK_VISIBILITY_TEST_INDEX, uint32_t)
+PSP2_GXM_REC_SETTER(sceGxmSetFrontVisibilityTestOp,
+	PSP2_GXM_REC_STATE_FRONT_VISIBILITY_TEST_OP, SceGxmVisibilityTestOp)
+PSP2_GXM_REC_SETTER(sceGxmSetBackVisibilityTestOp,
+	PSP2_GXM_REC_STATE_BACK_VISIBILITY_TEST_OP, SceGxmVisibilityTestOp)
+PSP2_GXM_REC_SETTER(sceGxmSetFrontVisibilityTestEnable,
+	PSP2_GXM_REC_STATE_FRONT_VISIBILITY_TEST_ENABLE,
+	SceGxmVisibilityTestMode)
+PSP2_GXM_REC_SETTER(sceGxmSetBackVisibilityTestEnable,
+	PSP2_GXM_REC_STATE_BACK_VISIBILITY_TEST_ENABLE,
+	SceGxmVisibilityTestMode)
+
+#undef PSP2_GXM_REC_SETTER
+
+static void psp2GxmRecSetStencilFunc(const char *function,
+	SceGxmContext *context, uint32_t state, SceGxmStencilFunc func,
+	SceGxmStencilOp stencilFail, SceGxmStencilOp depthFail,
+	SceGxmStencilOp depthPass, uint8_t compareMask, uint8_t writeMask)
+{
+	uint32_t values[6];
+
+	if (!psp2GxmRecIsContext(context)) {
+		psp2GxmRecError(function, SCE_OK, "bad context");
+		return;
+	}
+
+	values[0] = func;
+	values[1] = stencilFail;
+	values[2] = depthFail;
+	values[3] = depthPass;
+	values[4] = compareMask;
+	values[5] = writeMask;
+	psp2GxmRecSetState(context, state, values, 6);
+}
+
+void sceGxmSetFrontStencilFunc(SceGxmContext *context,
+	SceGxmStencilFunc func, SceGxmStencilOp stencilFail,
+	SceGxmStencilOp depthFail, SceGxmStencilOp depthPass,
+	uint8_t compareMask, uint8_t writeMask)
+{
+	psp2GxmRecSetStencilFunc(__func__, context,
+		PSP2_GXM_REC_STATE_FRONT_STENCIL_FUNC, func, stencilFail, depthFail,
+		depthPass, compareMask, writeMask);
+}
+
+void sceGxmSetBackStencilFunc(SceGxmContext *context,
+	SceGxmStencilFunc func, SceGxmStencilOp stencilFail,
+	SceGxmStencilOp depthFail, SceGxmStencilOp depthPass,
+	uint8_t compareMask, uint8_t writeMask)
+{
+	psp2GxmRecSetStencilFunc(__func__, context,
+		PSP2_GXM_REC_STATE_BACK_STENCIL_FUNC, func, stencilFail, depthFail,
+		depthPass, compareMask, writeMask);
+}
+
+static void psp2GxmRecSetDepthBias(const char *function,
+	SceGxmContext *context, uint32_t state, int32_t factor, int32_t units)
+{
+	uint32_t values[2];
+
+	if (!psp2GxmRecIsContext(context)) {
+		psp2GxmRecError(function, SCE_OK, "bad context");
+		return;
+	}
+
+	values[0] = (uint32_t)factor;
+	values[1] = (uint32_t)units;
+	psp2GxmRecSetState(context, state, values, 2);
+}
+
+void sceGxmSetFrontDepthBias(SceGxmContext *context, int32_t factor,
+	int32_t units)
+{
+	psp2GxmRecSetDepthBias(__func__, context,
+		PSP2_GXM_REC_STATE_FRONT_DEPTH_BIAS, factor, units);
+}
+
+void sceGxmSetBackDepthBias(SceGxmContext *context, int32_t factor,
+	int32_t units)
+{
+	psp2GxmRecSetDepthBias(__func__, context,
+		PSP2_GXM_REC_STATE_BACK_DEPTH_BIAS, factor, units);
+}
+
+void sceGxmSetViewport(SceGxmContext *context, float xOffset, float xScale,
+	float yOffset, float yScale, float zOffset, float zScale)
+{
+	float values[6];
+
+	if (!psp2GxmRecIsContext(context)) {
+		psp2GxmRecError(__func__, SCE_OK, "bad context");
+		return;
+	}
+
+	values[0] = xOffset;
+	values[1] = xScale;
+	values[2] = yOffset;
+	values[3] = yScale;
+	values[4] = zOffset;
+	values[5] = zScale;
+	psp2GxmRecSetState(context, PSP2_GXM_REC_STATE_VIEWPORT,
+		(const uint32_t *)values, 6);
+}
+
+void sceGxmSetWClampValue(SceGxmContext *context, float clampValue)
+{
+	uint32_t value;
+
+	if (!psp2GxmRecIsContext(context)) {
+		psp2GxmRecError(__func__, SCE_OK, "bad context");
+		return;
+	}
+
+	memcpy(&value, &clampValue, sizeof(value));
+	psp2GxmRecSetState(context, PSP2_GXM_REC_STATE_W_CLAMP_VALUE, &value, 1);
+}
+
+void sceGxmSetRegionClip(SceGxmContext *context, SceGxmRegionClipMode mode,
+	uint32_t xMin, uint32_t yMin, uint32_t xMax, uint32_t yMax)
+{
+	uint32_t values[5];
+
+	if (!psp2GxmRecIsContext(context)) {
+		psp2GxmRecError(__func__, SCE_OK, "bad context");
+		return;
+	}
+	if (xMin > xMax || yMin > yMax)
+		psp2GxmRecError(__func__, SCE_OK, "empty region (%u, %u)-(%u, %u)",
+			xMin, yMin, xMax, yMax);
+
+	values[0] = mode;
+	values[1] = xMin;
+	values[2] = yMin;
+	values[3] = xMax;
+	values[4] = yMax;
+	psp2GxmRecSetState(context, PSP2_GXM_REC_STATE_REGION_CLIP, values, 5);
+}
+
+void sceGxmSetDefaultRegionClipAndViewport(SceGxmContext *context,
+	uint32_t xMax, uint32_t yMax)
+{
+	sceGxmSetRegionClip(context, SCE_GXM_REGION_CLIP_OUTSIDE, 0, 0,
+		xMax, yMax);
+	sceGxmSetViewport(context, 0.5f * (1.0f + xMax), 0.5f * (1.0f + xMax),
+		0.5f * (1.0f + yMax), -0.5f * (1.0f + yMax), 0.5f, 0.5f);
+}
+
+SceGxmErrorCode sceGxmSetVisibilityBuffer(SceGxmContext *immediateContext,
+	void *bufferBase, uint32_t stridePerCore)
+{
+	if (!psp2GxmRecIsContext(immediateContext)
+		|| immediateContext->type != SCE_GXM_CONTEXT_TYPE_IMMEDIATE)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad immediate context");
+	if (immediateContext->active)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_WITHIN_SCENE,
+			"within a scene");
+	if (bufferBase != NULL && !psp2GxmRecIsMapped(bufferBase, stridePerCore,
+			SCE_GXM_MEMORY_ATTRIB_WRITE))
+		return psp2GxmRecError(__func__,
+			SCE_GXM_ERROR_INVALID_VISIBILITY_BUFFER_POINTER,
+			"the buffer %p is not mapped for writing", bufferBase);
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmSetYuvProfile(SceGxmContext *immediateContext,
+	uint32_t cscIndex, SceGxmYuvProfile profile)
+{
+	(void)profile;
+
+	if (!psp2GxmRecIsContext(immediateContext)
+		|| immediateContext->type != SCE_GXM_CONTEXT_TYPE_IMMEDIATE)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad immediate context");
+	if (cscIndex > 1)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_VALUE,
+			"bad index %u", cscIndex);
+
+	return SCE_OK;
+}
+
+/*
+ * Draws
+ */
+
+static SceGxmErrorCode psp2GxmRecCheckPrecomputedState(const char *function,
+	const void *state, uint32_t magic, const void *program)
+{
+	Psp2GxmRecPrecomputedState contents;
+
+	if (state == NULL)
+		return SCE_OK;
+
+	memcpy(&contents, state, sizeof(contents));
+	if (contents.magic != magic)
+		return psp2GxmRecError(function,
+			magic == PSP2_GXM_REC_MAGIC_PRECOMPUTED_VERTEX ?
+				SCE_GXM_ERROR_INVALID_PRECOMPUTED_VERTEX_STATE :
+				SCE_GXM_ERROR_INVALID_PRECOMPUTED_FRAGMENT_STATE,
+			"the precomputed state %p is not initialized", state);
+	if (contents.program != program)
+		return psp2GxmRecError(function,
+			magic == PSP2_GXM_REC_MAGIC_PRECOMPUTED_VERTEX ?
+				SCE_GXM_ERROR_INVALID_PRECOMPUTED_VERTEX_STATE :
+				SCE_GXM_ERROR_INVALID_PRECOMPUTED_FRAGMENT_STATE,
+			"the precomputed state %p is for another program", state);
+
+	return SCE_OK;
+}
+
+static SceGxmErrorCode psp2GxmRecCheckDraw(const char *function,
+	SceGxmContext *context, SceGxmPrimitiveType primType,
+	SceGxmIndexFormat indexType, const void *indexData, uint32_t indexCount,
+	uint32_t indexWrap, const void *const *streams)
+{
+	const SceGxmVertexProgram *program;
+	SceGxmErrorCode error;
+	uint32_t i, stream;
+
+	if (!psp2GxmRecIsContext(context))
+		return psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad context");
+	if (!context->active)
+		return psp2GxmRecError(function,
+			context->type == SCE_GXM_CONTEXT_TYPE_IMMEDIATE ?
+				SCE_GXM_ERROR_NOT_WITHIN_SCENE :
+				SCE_GXM_ERROR_NOT_WITHIN_COMMAND_LIST,
+			"not within a scene or command list");
+
+	program = context->vertexProgram;
+	if (program == NULL || context->fragmentProgram == NULL)
+		return psp2GxmRecError(function, SCE_GXM_ERROR_NULL_PROGRAM,
+			"no %s program", program == NULL ? "vertex" : "fragment");
+
+	switch (primType) {
+	case SCE_GXM_PRIMITIVE_TRIANGLES:
+	case SCE_GXM_PRIMITIVE_TRIANGLE_EDGES:
+		error = indexCount % 3 != 0;
+		break;
+	case SCE_GXM_PRIMITIVE_LINES:
+		error = indexCount % 2 != 0;
+		break;
+	case SCE_GXM_PRIMITIVE_POINTS:
+		error = 0;
+		break;
+	case SCE_GXM_PRIMITIVE_TRIANGLE_STRIP:
+	case SCE_GXM_PRIMITIVE_TRIANGLE_FAN:
+		error = indexCount < 3;
+		break;
+	default:
+		return psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_PRIMITIVE_TYPE,
+			"bad primitive type 0x%08X", primType);
+	}
+	if (error || indexCount == 0)
+		return psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_INDEX_COUNT,
+			"bad index count %u for primitive type 0x%08X",
+			indexCount, primType);
+	if (indexWrap != 0 && indexCount % indexWrap != 0)
+		return psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_INDEX_COUNT,
+			"index count %u is not a multiple of the wrap %u",
+			indexCount, indexWrap);
+
+	if (indexType != SCE_GXM_INDEX_FORMAT_U16
+		&& indexType != SCE_GXM_INDEX_FORMAT_U32)
+		return psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_VALUE,
+			"bad index format 0x%08X", indexType);
+	if (indexData == NULL || !psp2GxmRecIsMapped(indexData,
+			indexCount * (indexType == SCE_GXM_INDEX_FORMAT_U16 ? 2 : 4),
+			SCE_GXM_MEMORY_ATTRIB_READ))
+		return psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_POINTER,
+			"the %u indices at %p are not in mapped memory",
+			indexCount, indexData);
+
+	for (i = 0; i < program->attributeCount; i++) {
+		stream = program->attributes[i].streamIndex;
+		if (streams[stream] == NULL)
+			return psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_POINTER,
+				"vertex stream %u is not set", stream);
+		if (!psp2GxmRecIsMapped(streams[stream], 4,
+				SCE_GXM_MEMORY_ATTRIB_READ))
+			return psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_POINTER,
+				"vertex stream %u at %p is not in mapped memory",
+				stream, streams[stream]);
+	}
+
+	error = psp2GxmRecCheckPrecomputedState(function,
+		context->precomputedVertexState, PSP2_GXM_REC_MAGIC_PRECOMPUTED_VERTEX,
+		program);
+	if (error == SCE_OK)
+		error = psp2GxmRecCheckPrecomputedState(function,
+			context->precomputedFragmentState,
+			PSP2_GXM_REC_MAGIC_PRECOMPUTED_FRAGMENT,
+			context->fragmentProgram);
+
+	return error;
+}
+
+static void psp2GxmRecCountDraw(SceGxmContext *context, uint32_t indexCount,
+	uint32_t indexWrap)
+{
+	context->stats.draws++;
+	context->stats.indices += indexCount;
+	if (indexWrap != 0)
+		context->stats.instancedDraws++;
+}
+
+static void psp2GxmRecPutDraw(uint32_t *words, SceGxmPrimitiveType primType,
+	SceGxmIndexFormat indexType, const void *indexData, uint32_t indexCount,
+	uint32_t indexWrap)
+{
+	words[0] = primType;
+	words[1] = indexType;
+	psp2GxmRecPutPointer(words + 2, indexData);
+	words[4] = indexCount;
+	words[5] = indexWrap;
+}
+
+SceGxmErrorCode sceGxmDrawInstanced(SceGxmContext *context,
+	SceGxmPrimitiveType primType, SceGxmIndexFormat indexType,
+	const void *indexData, uint32_t indexCount, uint32_t indexWrap)
+{
+	SceGxmErrorCode error;
+	uint32_t words[6];
+
+	if (indexWrap == 0)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_VALUE,
+			"index wrap of 0");
+
+	error = psp2GxmRecCheckDraw(__func__, context, primType, indexType,
+		indexData, indexCount, indexWrap, context != NULL ?
+			context->vertexStreams : NULL);
+	if (error != SCE_OK)
+		return error;
+
+	psp2GxmRecCountDraw(context, indexCount, indexWrap);
+	psp2GxmRecPutDraw(words, primType, indexType, indexData, indexCount,
+		indexWrap);
+	psp2GxmRecEmit(context, PSP2_GXM_REC_OP_DRAW, words, 6);
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmDraw(SceGxmContext *context,
+	SceGxmPrimitiveType primType, SceGxmIndexFormat indexType,
+	const void *indexData, uint32_t indexCount)
+{
+	SceGxmErrorCode error;
+	uint32_t words[6];
+
+	error = psp2GxmRecCheckDraw(__func__, context, primType, indexType,
+		indexData, indexCount, 0, context != NULL ?
+			context->vertexStreams : NULL);
+	if (error != SCE_OK)
+		return error;
+
+	psp2GxmRecCountDraw(context, indexCount, 0);
+	psp2GxmRecPutDraw(words, primType, indexType, indexData, indexCount, 0);
+	psp2GxmRecEmit(context, PSP2_GXM_REC_OP_DRAW, words, 6);
+
+	return SCE_OK;
+}
+
+/*
+ * Precomputed draws and states
+ */
+
+static Psp2GxmRecPrecomputedDraw psp2GxmRecLoadDraw(
+	const SceGxmPrecomputedDraw *precomputedDraw)
+{
+	Psp2GxmRecPrecomputedDraw contents;
+
+	memcpy(&contents, precomputedDraw, sizeof(contents));
+
+	return contents;
+}
+
+static void psp2GxmRecStoreDraw(SceGxmPrecomputedDraw *precomputedDraw,
+	const Psp2GxmRecPrecomputedDraw *contents)
+{
+	memcpy(precomputedDraw, contents, sizeof(*contents));
+}
+
+SceGxmErrorCode sceGxmDrawPrecomputed(SceGxmContext *context,
+	const SceGxmPrecomputedDraw *precomputedDraw)
+{
+	Psp2GxmRecPrecomputedDraw draw;
+	SceGxmErrorCode error;
+	uint32_t words[10];
+
+	if (precomputedDraw == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"NULL precomputed draw");
+
+	draw = psp2GxmRecLoadDraw(precomputedDraw);
+	if (draw.magic != PSP2_GXM_REC_MAGIC_PRECOMPUTED_DRAW)
+		return psp2GxmRecError(__func__,
+			SCE_GXM_ERROR_INVALID_PRECOMPUTED_DRAW,
+			"the precomputed draw %p is not initialized",
+			(const void *)precomputedDraw);
+	if (psp2GxmRecIsContext(context) && context->vertexProgram != NULL
+		&& context->vertexProgram != draw.program)
+		return psp2GxmRecError(__func__,
+			SCE_GXM_ERROR_INVALID_PRECOMPUTED_DRAW,
+			"the precomputed draw %p is for another vertex program",
+			(const void *)precomputedDraw);
+
+	error = psp2GxmRecCheckDraw(__func__, context,
+		draw.type & ~SCE_GXM_INDEX_FORMAT_U32,
+		draw.type & SCE_GXM_INDEX_FORMAT_U32, draw.indexData,
+		draw.indexCount, draw.indexWrap, draw.streams);
+	if (error != SCE_OK)
+		return error;
+
+	psp2GxmRecCountDraw(context, draw.indexCount, draw.indexWrap);
+	context->stats.precomputedDraws++;
+	psp2GxmRecPutPointer(words, precomputedDraw);
+	psp2GxmRecPutPointer(words + 2, draw.program);
+	psp2GxmRecPutDraw(words + 4, draw.type & ~SCE_GXM_INDEX_FORMAT_U32,
+		draw.type & SCE_GXM_INDEX_FORMAT_U32, draw.indexData,
+		draw.indexCount, draw.indexWrap);
+	psp2GxmRecEmit(context, PSP2_GXM_REC_OP_DRAW_PRECOMPUTED, words, 10);
+
+	return SCE_OK;
+}
+
+uint32_t sceGxmGetPrecomputedDrawSize(
+	const SceGxmVertexProgram *vertexProgram)
+{
+	if (vertexProgram == NULL
+		|| vertexProgram->magic != PSP2_GXM_REC_MAGIC_VERTEX_PROGRAM)
+		return 0;
+
+	return vertexProgram->streamCount * sizeof(const void *);
+}
+
+SceGxmErrorCode sceGxmPrecomputedDrawInit(
+	SceGxmPrecomputedDraw *precomputedDraw,
+	const SceGxmVertexProgram *vertexProgram, void *memBlock)
+{
+	Psp2GxmRecPrecomputedDraw draw;
+
+	if (precomputedDraw == NULL || vertexProgram == NULL
+		|| vertexProgram->magic != PSP2_GXM_REC_MAGIC_VERTEX_PROGRAM)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad precomputed draw or vertex program");
+	if (memBlock == NULL && vertexProgram->streamCount != 0)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"NULL memory block");
+	if ((uintptr_t)memBlock % sizeof(const void *) != 0)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_ALIGNMENT,
+			"the memory block %p is not aligned", memBlock);
+
+	memset(&draw, 0, sizeof(draw));
+	draw.magic = PSP2_GXM_REC_MAGIC_PRECOMPUTED_DRAW;
+	draw.program = vertexProgram;
+	draw.streams = (const void **)memBlock;
+	if (memBlock != NULL)
+		memset(memBlock, 0, sceGxmGetPrecomputedDrawSize(vertexProgram));
+
+	memset(precomputedDraw, 0, sizeof(*precomputedDraw));
+	psp2GxmRecStoreDraw(precomputedDraw, &draw);
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmPrecomputedDrawSetAllVertexStreams(
+	SceGxmPrecomputedDraw *precomputedDraw, const void *const *streamDataArray)
+{
+	Psp2GxmRecPrecomputedDraw draw;
+	uint32_t i;
+
+	if (precomputedDraw == NULL || streamDataArray == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"NULL precomputed draw or streams");
+
+	draw = psp2GxmRecLoadDraw(precomputedDraw);
+	if (draw.magic != PSP2_GXM_REC_MAGIC_PRECOMPUTED_DRAW)
+		return psp2GxmRecError(__func__,
+			SCE_GXM_ERROR_INVALID_PRECOMPUTED_DRAW, "not initialized");
+
+	for (i = 0; i < draw.program->streamCount; i++)
+		draw.streams[i] = streamDataArray[i];
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmPrecomputedDrawSetVertexStream(
+	SceGxmPrecomputedDraw *precomputedDraw, uint32_t streamIndex,
+	const void *streamData)
+{
+	Psp2GxmRecPrecomputedDraw draw;
+
+	if (precomputedDraw == NULL || streamData == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"NULL precomputed draw or stream");
+
+	draw = psp2GxmRecLoadDraw(precomputedDraw);
+	if (draw.magic != PSP2_GXM_REC_MAGIC_PRECOMPUTED_DRAW)
+		return psp2GxmRecError(__func__,
+			SCE_GXM_ERROR_INVALID_PRECOMPUTED_DRAW, "not initialized");
+	if (streamIndex >= draw.program->streamCount)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_VALUE,
+			"stream %u of %u", streamIndex, draw.program->streamCount);
+
+	draw.streams[streamIndex] = streamData;
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmPrecomputedDrawSetParamsInstanced(
+	SceGxmPrecomputedDraw *precomputedDraw, SceGxmPrimitiveType primType,
+	SceGxmIndexFormat indexType, const void *indexData, uint32_t indexCount,
+	uint32_t indexWrap)
+{
+	Psp2GxmRecPrecomputedDraw draw;
+
+	if (precomputedDraw == NULL || indexData == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"NULL precomputed draw or indices");
+
+	draw = psp2GxmRecLoadDraw(precomputedDraw);
+	if (draw.magic != PSP2_GXM_REC_MAGIC_PRECOMPUTED_DRAW)
+		return psp2GxmRecError(__func__,
+			SCE_GXM_ERROR_INVALID_PRECOMPUTED_DRAW, "not initialized");
+
+	draw.type = primType | indexType;
+	draw.indexData = indexData;
+	draw.indexCount = indexCount;
+	draw.indexWrap = indexWrap;
+	psp2GxmRecStoreDraw(precomputedDraw, &draw);
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmPrecomputedDrawSetParams(
+	SceGxmPrecomputedDraw *precomputedDraw, SceGxmPrimitiveType primType,
+	SceGxmIndexFormat indexType, const void *indexData, uint32_t indexCount)
+{
+	return sceGxmPrecomputedDrawSetParamsInstanced(precomputedDraw, primType,
+		indexType, indexData, indexCount, 0);
+}
+
+static SceGxmErrorCode psp2GxmRecInitPrecomputedState(const char *function,
+	void *precomputedState, uint32_t magic, const void *program,
+	void *memBlock)
+{
+	Psp2GxmRecPrecomputedState state;
+
+	if (precomputedState == NULL || program == NULL || memBlock == NULL)
+		return psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_POINTER,
+			"NULL precomputed state, program or memory block");
+	if ((uintptr_t)memBlock % sizeof(const void *) != 0)
+		return psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_ALIGNMENT,
+			"the memory block %p is not aligned", memBlock);
+
+	state.magic = magic;
+	state.program = program;
+	state.mem = (Psp2GxmRecPrecomputedStateMem *)memBlock;
+	memset(memBlock, 0, sizeof(*state.mem));
+	memcpy(precomputedState, &state, sizeof(state));
+
+	return SCE_OK;
+}
+
+/* Get the memory block of a precomputed state */
+static Psp2GxmRecPrecomputedStateMem *psp2GxmRecGetPrecomputedStateMem(
+	const char *function, const void *precomputedState, uint32_t magic)
+{
+	Psp2GxmRecPrecomputedState state;
+
+	if (precomputedState == NULL) {
+		psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_POINTER,
+			"NULL precomputed state");
+		return NULL;
+	}
+
+	memcpy(&state, precomputedState, sizeof(state));
+	if (state.magic != magic) {
+		psp2GxmRecError(function,
+			magic == PSP2_GXM_REC_MAGIC_PRECOMPUTED_VERTEX ?
+				SCE_GXM_ERROR_INVALID_PRECOMPUTED_VERTEX_STATE :
+				SCE_GXM_ERROR_INVALID_PRECOMPUTED_FRAGMENT_STATE,
+			"not initialized");
+		return NULL;
+	}
+
+	return state.mem;
+}
+
+#define PSP2_GXM_REC_PRECOMPUTED_STATE(Stage, Program, MAGIC, ERROR)	\
+uint32_t sceGxmGetPrecomputed##Stage##StateSize(	\
+	const SceGxm##Program *program)	\
+{	\
+	(void)program;	\
+	\
+	return sizeof(Psp2GxmRecPrecomputedStateMem);	\
+}	\
+	\
+SceGxmErrorCode sceGxmPrecomputed##Stage##StateInit(	\
+	SceGxmPrecomputed##Stage##State *precomputedState,	\
+	const SceGxm##Program *program, void *memBlock)	\
+{	\
+	if (program != NULL && program->magic != PSP2_GXM_REC_MAGIC_##MAGIC)	\
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,	\
+			"bad program");	\
+	\
+	return psp2GxmRecInitPrecomputedState(__func__, precomputedState,	\
+		PSP2_GXM_REC_MAGIC_PRECOMPUTED_##Stage##_STATE, program, memBlock);	\
+}	\
+	\
+SceGxmErrorCode sceGxmPrecomputed##Stage##StateSetDefaultUniformBuffer(	\
+	SceGxmPrecomputed##Stage##State *precomputedState,	\
+	const void *defaultBuffer)	\
+{	\
+	Psp2GxmRecPrecomputedStateMem *mem;	\
+	\
+	mem = psp2GxmRecGetPrecomputedStateMem(__func__, precomputedState,	\
+		PSP2_GXM_REC_MAGIC_PRECOMPUTED_##Stage##_STATE);	\
+	if (mem == NULL)	\
+		return ERROR;	\
+	\
+	mem->defaultUniformBuffer = defaultBuffer;	\
+	\
+	return SCE_OK;	\
+}	\
+	\
+void *sceGxmPrecomputed##Stage##StateGetDefaultUniformBuffer(	\
+	const SceGxmPrecomputed##Stage##State *precomputedState)	\
+{	\
+	Psp2GxmRecPrecomputedStateMem *mem;	\
+	\
+	mem = psp2GxmRecGetPrecomputedStateMem(__func__, precomputedState,	\
+		PSP2_GXM_REC_MAGIC_PRECOMPUTED_##Stage##_STATE);	\
+	\
+	return mem != NULL ? (void *)mem->defaultUniformBuffer : NULL;	\
+}	\
+	\
+SceGxmErrorCode sceGxmPrecomputed##Stage##StateSetAllTextures(	\
+	SceGxmPrecomputed##Stage##State *precomputedState,	\
+	const SceGxmTexture *textureArray)	\
+{	\
+	Psp2GxmRecPrecomputedStateMem *mem;	\
+	\
+	mem = psp2GxmRecGetPrecomputedStateMem(__func__, precomputedState,	\
+		PSP2_GXM_REC_MAGIC_PRECOMPUTED_##Stage##_STATE);	\
+	if (mem == NULL)	\
+		return ERROR;	\
+	if (textureArray == NULL)	\
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,	\
+			"NULL textures");	\
+	\
+	memcpy(mem->textures, textureArray, sizeof(mem->textures));	\
+	\
+	return SCE_OK;	\
+}	\
+	\
+SceGxmErrorCode sceGxmPrecomputed##Stage##StateSetTexture(	\
+	SceGxmPrecomputed##Stage##State *precomputedState,	\
+	uint32_t textureIndex, const SceGxmTexture *texture)	\
+{	\
+	Psp2GxmRecPrecomputedStateMem *mem;	\
+	\
+	mem = psp2GxmRecGetPrecomputedStateMem(__func__, precomputedState,	\
+		PSP2_GXM_REC_MAGIC_PRECOMPUTED_##Stage##_STATE);	\
+	if (mem == NULL)	\
+		return ERROR;	\
+	if (texture == NULL)	\
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,	\
+			"NULL texture");	\
+	if (textureIndex >= SCE_GXM_MAX_TEXTURE_UNITS)	\
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_VALUE,	\
+			"bad texture index %u", textureIndex);	\
+	\
+	mem->textures[textureIndex] = *texture;	\
+	\
+	return SCE_OK;	\
+}	\
+	\
+SceGxmErrorCode sceGxmPrecomputed##Stage##StateSetAllUniformBuffers(	\
+	SceGxmPrecomputed##Stage##State *precomputedState,	\
+	const void *const *bufferDataArray)	\
+{	\
+	Psp2GxmRecPrecomputedStateMem *mem;	\
+	uint32_t i;	\
+	\
+	mem = psp2GxmRecGetPrecomputedStateMem(__func__, precomputedState,	\
+		PSP2_GXM_REC_MAGIC_PRECOMPUTED_##Stage##_STATE);	\
+	if (mem == NULL)	\
+		return ERROR;	\
+	if (bufferDataArray == NULL)	\
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,	\
+			"NULL buffers");	\
+	\
+	for (i = 0; i < SCE_GXM_MAX_UNIFORM_BUFFERS; i++)	\
+		mem->uniformBuffers[i] = bufferDataArray[i];	\
+	\
+	return SCE_OK;	\
+}	\
+	\
+SceGxmErrorCode sceGxmPrecomputed##Stage##StateSetUniformBuffer(	\
+	SceGxmPrecomputed##Stage##State *precomputedState,	\
+	uint32_t bufferIndex, const void *bufferData)	\
+{	\
+	Psp2GxmRecPrecomputedStateMem *mem;	\
+	\
+	mem = psp2GxmRecGetPrecomputedStateMem(__func__, precomputedState,	\
+		PSP2_GXM_REC_MAGIC_PRECOMPUTED_##Stage##_STATE);	\
+	if (mem == NULL)	\
+		return ERROR;	\
+	if (bufferIndex >= SCE_GXM_MAX_UNIFORM_BUFFERS)	\
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_VALUE,	\
+			"bad buffer index %u", bufferIndex);	\
+	\
+	mem->uniformBuffers[bufferIndex] = bufferData;	\
+	\
+	return SCE_OK;	\
+}
+
+#define PSP2_GXM_REC_MAGIC_PRECOMPUTED_Vertex_STATE	\
+	PSP2_GXM_REC_MAGIC_PRECOMPUTED_VERTEX
+#define PSP2_GXM_REC_MAGIC_PRECOMPUTED_Fragment_STATE	\
+	PSP2_GXM_REC_MAGIC_PRECOMPUTED_FRAGMENT
+
+PSP2_GXM_REC_PRECOMPUTED_STATE(Vertex, VertexProgram, VERTEX_PROGRAM,
+	SCE_GXM_ERROR_INVALID_PRECOMPUTED_VERTEX_STATE)
+PSP2_GXM_REC_PRECOMPUTED_STATE(Fragment, FragmentProgram, FRAGMENT_PROGRAM,
+	SCE_GXM_ERROR_INVALID_PRECOMPUTED_FRAGMENT_STATE)
+
+#undef PSP2_GXM_REC_PRECOMPUTED_STATE
+
+void sceGxmSetPrecomputedVertexState(SceGxmContext *context,
+	const SceGxmPrecomputedVertexState *precomputedState)
+{
+	if (!psp2GxmRecIsContext(context)) {
+		psp2GxmRecError(__func__, SCE_OK, "bad context");
+		return;
+	}
+	if (precomputedState != NULL && psp2GxmRecGetPrecomputedStateMem(__func__,
+			precomputedState, PSP2_GXM_REC_MAGIC_PRECOMPUTED_VERTEX) == NULL)
+		return;
+
+	if (psp2GxmRecChange(context,
+			context->precomputedVertexState != precomputedState)) {
+		context->precomputedVertexState = precomputedState;
+		psp2GxmRecEmitPointer(context,
+			PSP2_GXM_REC_OP_SET_PRECOMPUTED_VERTEX_STATE, precomputedState);
+	}
+}
+
+void sceGxmSetPrecomputedFragmentState(SceGxmContext *context,
+	const SceGxmPrecomputedFragmentState *precomputedState)
+{
+	if (!psp2GxmRecIsContext(context)) {
+		psp2GxmRecError(__func__, SCE_OK, "bad context");
+		return;
+	}
+	if (precomputedState != NULL && psp2GxmRecGetPrecomputedStateMem(__func__,
+			precomputedState, PSP2_GXM_REC_MAGIC_PRECOMPUTED_FRAGMENT) == NULL)
+		return;
+
+	if (psp2GxmRecChange(context,
+			context->precomputedFragmentState != precomputedState)) {
+		context->precomputedFragmentState = precomputedState;
+		psp2GxmRecEmitPointer(context,
+			PSP2_GXM_REC_OP_SET_PRECOMPUTED_FRAGMENT_STATE, precomputedState);
+	}
+}
+
+/*
+ * Shader patcher
+ */
+
+static void *psp2GxmRecPatcherAlloc(SceGxmShaderPatcher *shaderPatcher,
+	uint32_t size)
+{
+	void *mem;
+
+	mem = shaderPatcher->params.hostAllocCallback(
+		shaderPatcher->params.userData, size);
+	if (mem != NULL) {
+		memset(mem, 0, size);
+		shaderPatcher->hostMemAllocated += size;
+	}
+
+	return mem;
+}
+
+static void psp2GxmRecPatcherFree(SceGxmShaderPatcher *shaderPatcher,
+	void *mem, uint32_t size)
+{
+	shaderPatcher->hostMemAllocated -= size;
+	shaderPatcher->params.hostFreeCallback(shaderPatcher->params.userData,
+		mem);
+}
+
+static int psp2GxmRecIsPatcher(const SceGxmShaderPatcher *shaderPatcher)
+{
+	return shaderPatcher != NULL
+		&& shaderPatcher->magic == PSP2_GXM_REC_MAGIC_SHADER_PATCHER;
+}
+
+SceGxmErrorCode sceGxmShaderPatcherCreate(
+	const SceGxmShaderPatcherParams *params,
+	SceGxmShaderPatcher **shaderPatcher)
+{
+	SceGxmShaderPatcher *patcher;
+
+	if (params == NULL || shaderPatcher == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"NULL parameters or shader patcher");
+	if (params->hostAllocCallback == NULL || params->hostFreeCallback == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_VALUE,
+			"no host memory callbacks");
+
+	patcher = params->hostAllocCallback(params->userData, sizeof(*patcher));
+	if (patcher == NULL)
+		return SCE_GXM_ERROR_OUT_OF_HOST_MEMORY;
+
+	memset(patcher, 0, sizeof(*patcher));
+	patcher->magic = PSP2_GXM_REC_MAGIC_SHADER_PATCHER;
+	patcher->params = *params;
+	patcher->hostMemAllocated = sizeof(*patcher);
+	*shaderPatcher = patcher;
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmShaderPatcherSetUserData(
+	SceGxmShaderPatcher *shaderPatcher, void *userData)
+{
+	if (!psp2GxmRecIsPatcher(shaderPatcher))
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad shader patcher");
+
+	shaderPatcher->params.userData = userData;
+
+	return SCE_OK;
+}
+
+void *sceGxmShaderPatcherGetUserData(const SceGxmShaderPatcher *shaderPatcher)
+{
+	return psp2GxmRecIsPatcher(shaderPatcher) ?
+		shaderPatcher->params.userData : NULL;
+}
+
+static void psp2GxmRecFreeVertexProgram(SceGxmShaderPatcher *shaderPatcher,
+	SceGxmVertexProgram *vertexProgram)
+{
+	SceGxmVertexProgram **p;
+
+	for (p = &shaderPatcher->vertexPrograms; *p != vertexProgram;
+			p = &(*p)->next)
+		;
+	*p = vertexProgram->next;
+
+	vertexProgram->program->refCount--;
+	vertexProgram->magic = PSP2_GXM_REC_MAGIC_DEAD;
+	psp2GxmRecPatcherFree(shaderPatcher, vertexProgram,
+		sizeof(*vertexProgram));
+}
+
+static void psp2GxmRecFreeFragmentProgram(SceGxmShaderPatcher *shaderPatcher,
+	SceGxmFragmentProgram *fragmentProgram)
+{
+	SceGxmFragmentProgram **p;
+
+	for (p = &shaderPatcher->fragmentPrograms; *p != fragmentProgram;
+			p = &(*p)->next)
+		;
+	*p = fragmentProgram->next;
+
+	if (fragmentProgram->program != NULL)
+		fragmentProgram->program->refCount--;
+	fragmentProgram->magic = PSP2_GXM_REC_MAGIC_DEAD;
+	psp2GxmRecPatcherFree(shaderPatcher, fragmentProgram,
+		sizeof(*fragmentProgram));
+}
+
+static void psp2GxmRecFreeProgram(SceGxmShaderPatcher *shaderPatcher,
+	SceGxmRegisteredProgram *program)
+{
+	SceGxmRegisteredProgram **p;
+
+	for (p = &shaderPatcher->programs; *p != program; p = &(*p)->next)
+		;
+	*p = program->next;
+
+	program->magic = PSP2_GXM_REC_MAGIC_DEAD;
+	psp2GxmRecPatcherFree(shaderPatcher, program, sizeof(*program));
+}
+
+SceGxmErrorCode sceGxmShaderPatcherDestroy(SceGxmShaderPatcher *shaderPatcher)
+{
+	if (!psp2GxmRecIsPatcher(shaderPatcher))
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad shader patcher");
+	if (shaderPatcher->vertexPrograms != NULL
+		|| shaderPatcher->fragmentPrograms != NULL)
+		psp2GxmRecError(__func__, SCE_OK, "programs were not released");
+
+	while (shaderPatcher->vertexPrograms != NULL)
+		psp2GxmRecFreeVertexProgram(shaderPatcher,
+			shaderPatcher->vertexPrograms);
+	while (shaderPatcher->fragmentPrograms != NULL)
+		psp2GxmRecFreeFragmentProgram(shaderPatcher,
+			shaderPatcher->fragmentPrograms);
+	while (shaderPatcher->programs != NULL)
+		psp2GxmRecFreeProgram(shaderPatcher, shaderPatcher->programs);
+
+	shaderPatcher->magic = PSP2_GXM_REC_MAGIC_DEAD;
+	shaderPatcher->params.hostFreeCallback(shaderPatcher->params.userData,
+		shaderPatcher);
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmShaderPatcherRegisterProgram(
+	SceGxmShaderPatcher *shaderPatcher, const SceGxmProgram *programHeader,
+	SceGxmShaderPatcherId *programId)
+{
+	SceGxmRegisteredProgram *program;
+
+	if (!psp2GxmRecIsPatcher(shaderPatcher) || programHeader == NULL
+		|| programId == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad shader patcher, program or identifier");
+	if (memcmp(programHeader, PSP2_GXM_REC_PROGRAM_MAGIC,
+			sizeof(PSP2_GXM_REC_PROGRAM_MAGIC)) != 0)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_VALUE,
+			"%p is not a GXP program", (const void *)programHeader);
+
+	// A program registered twice has the same identifier.
+	for (program = shaderPatcher->programs; program != NULL;
+			program = program->next)
+		if (program->program == programHeader) {
+			*programId = program;
+			return SCE_OK;
+		}
+
+	program = psp2GxmRecPatcherAlloc(shaderPatcher, sizeof(*program));
+	if (program == NULL)
+		return SCE_GXM_ERROR_OUT_OF_HOST_MEMORY;
+
+	program->magic = PSP2_GXM_REC_MAGIC_REGISTERED_PROGRAM;
+	program->program = programHeader;
+	program->shaderPatcher = shaderPatcher;
+	program->next = shaderPatcher->programs;
+	shaderPatcher->programs = program;
+	*programId = program;
+
+	return SCE_OK;
+}
+
+static int psp2GxmRecIsProgramId(const SceGxmShaderPatcher *shaderPatcher,
+	SceGxmShaderPatcherId programId)
+{
+	return programId != NULL
+		&& programId->magic == PSP2_GXM_REC_MAGIC_REGISTERED_PROGRAM
+		&& programId->shaderPatcher == shaderPatcher;
+}
+
+SceGxmErrorCode sceGxmShaderPatcherUnregisterProgram(
+	SceGxmShaderPatcher *shaderPatcher, SceGxmShaderPatcherId programId)
+{
+	if (!psp2GxmRecIsPatcher(shaderPatcher)
+		|| !psp2GxmRecIsProgramId(shaderPatcher, programId))
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad shader patcher or program");
+	if (programId->refCount != 0)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_PROGRAM_IN_USE,
+			"%u programs use it", programId->refCount);
+
+	psp2GxmRecFreeProgram(shaderPatcher, programId);
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmShaderPatcherForceUnregisterProgram(
+	SceGxmShaderPatcher *shaderPatcher, SceGxmShaderPatcherId programId)
+{
+	SceGxmVertexProgram *vertexProgram, *nextVertexProgram;
+	SceGxmFragmentProgram *fragmentProgram, *nextFragmentProgram;
+
+	if (!psp2GxmRecIsPatcher(shaderPatcher)
+		|| !psp2GxmRecIsProgramId(shaderPatcher, programId))
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad shader patcher or program");
+
+	for (vertexProgram = shaderPatcher->vertexPrograms;
+			vertexProgram != NULL; vertexProgram = nextVertexProgram) {
+		nextVertexProgram = vertexProgram->next;
+		if (vertexProgram->program == programId)
+			psp2GxmRecFreeVertexProgram(shaderPatcher, vertexProgram);
+	}
+
+	for (fragmentProgram = shaderPatcher->fragmentPrograms;
+			fragmentProgram != NULL; fragmentProgram = nextFragmentProgram) {
+		nextFragmentProgram = fragmentProgram->next;
+		if (fragmentProgram->program == programId)
+			psp2GxmRecFreeFragmentProgram(shaderPatcher, fragmentProgram);
+	}
+
+	psp2GxmRecFreeProgram(shaderPatcher, programId);
+
+	return SCE_OK;
+}
+
+const SceGxmProgram *sceGxmShaderPatcherGetProgramFromId(
+	SceGxmShaderPatcherId programId)
+{
+	if (programId == NULL
+		|| programId->magic != PSP2_GXM_REC_MAGIC_REGISTERED_PROGRAM)
+		return NULL;
+
+	return programId->program;
+}
+
+const SceGxmProgram *sceGxmVertexProgramGetProgram(
+	const SceGxmVertexProgram *vertexProgram)
+{
+	if (vertexProgram == NULL
+		|| vertexProgram->magic != PSP2_GXM_REC_MAGIC_VERTEX_PROGRAM)
+		return NULL;
+
+	return vertexProgram->program->program;
+}
+
+const SceGxmProgram *sceGxmFragmentProgramGetProgram(
+	const SceGxmFragmentProgram *fragmentProgram)
+{
+	if (fragmentProgram == NULL
+		|| fragmentProgram->magic != PSP2_GXM_REC_MAGIC_FRAGMENT_PROGRAM
+		|| fragmentProgram->program == NULL)
+		return NULL;
+
+	return fragmentProgram->program->program;
+}
+
+/* Programs are not parsed, so they all shade fragments */
+bool sceGxmFragmentProgramIsEnabled(
+	const SceGxmFragmentProgram *fragmentProgram)
+{
+	(void)fragmentProgram;
+
+	return true;
+}
+
+SceGxmErrorCode sceGxmShaderPatcherCreateVertexProgram(
+	SceGxmShaderPatcher *shaderPatcher, SceGxmShaderPatcherId programId,
+	const SceGxmVertexAttribute *attributes, uint32_t attributeCount,
+	const SceGxmVertexStream *streams, uint32_t streamCount,
+	SceGxmVertexProgram **vertexProgram)
+{
+	SceGxmVertexProgram *program;
+	uint32_t i;
+
+	if (!psp2GxmRecIsPatcher(shaderPatcher)
+		|| !psp2GxmRecIsProgramId(shaderPatcher, programId)
+		|| vertexProgram == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad shader patcher, program or vertex program");
+	if (attributeCount > SCE_GXM_MAX_VERTEX_ATTRIBUTES
+		|| streamCount > SCE_GXM_MAX_VERTEX_STREAMS
+		|| (attributeCount != 0 && attributes == NULL)
+		|| (streamCount != 0 && streams == NULL))
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_VALUE,
+			"%u attributes and %u streams", attributeCount, streamCount);
+
+	for (i = 0; i < attributeCount; i++)
+		if (attributes[i].streamIndex >= streamCount
+			|| attributes[i].componentCount == 0)
+			return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_VALUE,
+				"attribute %u reads stream %u with %u components", i,
+				attributes[i].streamIndex, attributes[i].componentCount);
+
+	// The patcher returns the same program for the same inputs.
+	for (program = shaderPatcher->vertexPrograms; program != NULL;
+			program = program->next)
+		if (program->program == programId
+			&& program->attributeCount == attributeCount
+			&& program->streamCount == streamCount
+			&& memcmp(program->attributes, attributes,
+				attributeCount * sizeof(*attributes)) == 0
+			&& memcmp(program->streams, streams,
+				streamCount * sizeof(*streams)) == 0) {
+			program->refCount++;
+			*vertexProgram = program;
+			return SCE_OK;
+		}
+
+	program = psp2GxmRecPatcherAlloc(shaderPatcher, sizeof(*program));
+	if (program == NULL)
+		return SCE_GXM_ERROR_OUT_OF_HOST_MEMORY;
+
+	program->magic = PSP2_GXM_REC_MAGIC_VERTEX_PROGRAM;
+	program->refCount = 1;
+	program->program = programId;
+	program->attributeCount = attributeCount;
+	program->streamCount = streamCount;
+	if (attributeCount != 0)
+		memcpy(program->attributes, attributes,
+			attributeCount * sizeof(*attributes));
+	if (streamCount != 0)
+		memcpy(program->streams, streams, streamCount * sizeof(*streams));
+	program->next = shaderPatcher->vertexPrograms;
+	shaderPatcher->vertexPrograms = program;
+	programId->refCount++;
+	*vertexProgram = program;
+
+	return SCE_OK;
+}
+
+static SceGxmErrorCode psp2GxmRecCreateFragmentProgram(const char *function,
+	SceGxmShaderPatcher *shaderPatcher, SceGxmShaderPatcherId programId,
+	SceGxmOutputRegisterFormat outputFormat,
+	SceGxmMultisampleMode multisampleMode, const SceGxmBlendInfo *blendInfo,
+	const SceGxmProgram *vertexProgram,
+	SceGxmFragmentProgram **fragmentProgram)
+{
+	SceGxmFragmentProgram *program;
+
+	if (multisampleMode > SCE_GXM_MULTISAMPLE_4X)
+		return psp2GxmRecError(function, SCE_GXM_ERROR_INVALID_VALUE,
+			"bad multisample mode %u", multisampleMode);
+
+	for (program = shaderPatcher->fragmentPrograms; program != NULL;
+			program = program->next)
+		if (program->program == programId
+			&& program->outputFormat == outputFormat
+			&& program->multisampleMode == multisampleMode
+			&& program->hasBlendInfo == (blendInfo != NULL)
+			&& (blendInfo == NULL || memcmp(&program->blendInfo, blendInfo,
+				sizeof(*blendInfo)) == 0)
+			&& program->vertexProgram == vertexProgram) {
+			program->refCount++;
+			*fragmentProgram = program;
+			return SCE_OK;
+		}
+
+	program = psp2GxmRecPatcherAlloc(shaderPatcher, sizeof(*program));
+	if (program == NULL)
+		return SCE_GXM_ERROR_OUT_OF_HOST_MEMORY;
+
+	program->magic = PSP2_GXM_REC_MAGIC_FRAGMENT_PROGRAM;
+	program->refCount = 1;
+	program->program = programId;
+	program->outputFormat = outputFormat;
+	program->multisampleMode = multisampleMode;
+	program->hasBlendInfo = blendInfo != NULL;
+	if (blendInfo != NULL)
+		program->blendInfo = *blendInfo;
+	program->vertexProgram = vertexProgram;
+	program->next = shaderPatcher->fragmentPrograms;
+	shaderPatcher->fragmentPrograms = program;
+	if (programId != NULL)
+		programId->refCount++;
+	*fragmentProgram = program;
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmShaderPatcherCreateFragmentProgram(
+	SceGxmShaderPatcher *shaderPatcher, SceGxmShaderPatcherId programId,
+	SceGxmOutputRegisterFormat outputFormat,
+	SceGxmMultisampleMode multisampleMode, const SceGxmBlendInfo *blendInfo,
+	const SceGxmProgram *vertexProgram,
+	SceGxmFragmentProgram **fragmentProgram)
+{
+	if (!psp2GxmRecIsPatcher(shaderPatcher)
+		|| !psp2GxmRecIsProgramId(shaderPatcher, programId)
+		|| fragmentProgram == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad shader patcher, program or fragment program");
+	if (vertexProgram != NULL && memcmp(vertexProgram,
+			PSP2_GXM_REC_PROGRAM_MAGIC, sizeof(PSP2_GXM_REC_PROGRAM_MAGIC)) != 0)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_VALUE,
+			"%p is not a GXP program", (const void *)vertexProgram);
+
+	return psp2GxmRecCreateFragmentProgram(__func__, shaderPatcher, programId,
+		outputFormat, multisampleMode, blendInfo, vertexProgram,
+		fragmentProgram);
+}
+
+SceGxmErrorCode sceGxmShaderPatcherCreateMaskUpdateFragmentProgram(
+	SceGxmShaderPatcher *shaderPatcher,
+	SceGxmFragmentProgram **fragmentProgram)
+{
+	if (!psp2GxmRecIsPatcher(shaderPatcher) || fragmentProgram == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad shader patcher or fragment program");
+
+	return psp2GxmRecCreateFragmentProgram(__func__, shaderPatcher, NULL,
+		SCE_GXM_OUTPUT_REGISTER_FORMAT_DECLARED, SCE_GXM_MULTISAMPLE_NONE,
+		NULL, NULL, fragmentProgram);
+}
+
+SceGxmErrorCode sceGxmShaderPatcherAddRefVertexProgram(
+	SceGxmShaderPatcher *shaderPatcher, SceGxmVertexProgram *vertexProgram)
+{
+	if (!psp2GxmRecIsPatcher(shaderPatcher) || vertexProgram == NULL
+		|| vertexProgram->magic != PSP2_GXM_REC_MAGIC_VERTEX_PROGRAM)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad shader patcher or vertex program");
+
+	vertexProgram->refCount++;
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmShaderPatcherAddRefFragmentProgram(
+	SceGxmShaderPatcher *shaderPatcher, SceGxmFragmentProgram *fragmentProgram)
+{
+	if (!psp2GxmRecIsPatcher(shaderPatcher) || fragmentProgram == NULL
+		|| fragmentProgram->magic != PSP2_GXM_REC_MAGIC_FRAGMENT_PROGRAM)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad shader patcher or fragment program");
+
+	fragmentProgram->refCount++;
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmShaderPatcherReleaseVertexProgram(
+	SceGxmShaderPatcher *shaderPatcher, SceGxmVertexProgram *vertexProgram)
+{
+	if (!psp2GxmRecIsPatcher(shaderPatcher) || vertexProgram == NULL
+		|| vertexProgram->magic != PSP2_GXM_REC_MAGIC_VERTEX_PROGRAM)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad shader patcher or vertex program");
+
+	if (--vertexProgram->refCount == 0)
+		psp2GxmRecFreeVertexProgram(shaderPatcher, vertexProgram);
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmShaderPatcherReleaseFragmentProgram(
+	SceGxmShaderPatcher *shaderPatcher, SceGxmFragmentProgram *fragmentProgram)
+{
+	if (!psp2GxmRecIsPatcher(shaderPatcher) || fragmentProgram == NULL
+		|| fragmentProgram->magic != PSP2_GXM_REC_MAGIC_FRAGMENT_PROGRAM)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad shader patcher or fragment program");
+
+	if (--fragmentProgram->refCount == 0)
+		psp2GxmRecFreeFragmentProgram(shaderPatcher, fragmentProgram);
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmShaderPatcherGetVertexProgramRefCount(
+	const SceGxmShaderPatcher *shaderPatcher,
+	const SceGxmVertexProgram *vertexProgram, uint32_t *refCount)
+{
+	if (!psp2GxmRecIsPatcher(shaderPatcher) || vertexProgram == NULL
+		|| vertexProgram->magic != PSP2_GXM_REC_MAGIC_VERTEX_PROGRAM
+		|| refCount == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad shader patcher or vertex program");
+
+	*refCount = vertexProgram->refCount;
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmShaderPatcherGetFragmentProgramRefCount(
+	const SceGxmShaderPatcher *shaderPatcher,
+	const SceGxmFragmentProgram *fragmentProgram, uint32_t *refCount)
+{
+	if (!psp2GxmRecIsPatcher(shaderPatcher) || fragmentProgram == NULL
+		|| fragmentProgram->magic != PSP2_GXM_REC_MAGIC_FRAGMENT_PROGRAM
+		|| refCount == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad shader patcher or fragment program");
+
+	*refCount = fragmentProgram->refCount;
+
+	return SCE_OK;
+}
+
+uint32_t sceGxmShaderPatcherGetHostMemAllocated(
+	const SceGxmShaderPatcher *shaderPatcher)
+{
+	return psp2GxmRecIsPatcher(shaderPatcher) ?
+		shaderPatcher->hostMemAllocated : 0;
+}
+
+/* The recorder generates no code, so it uses no GPU memory */
+uint32_t sceGxmShaderPatcherGetBufferMemAllocated(
+	const SceGxmShaderPatcher *shaderPatcher)
+{
+	(void)shaderPatcher;
+
+	return 0;
+}
+
+uint32_t sceGxmShaderPatcherGetVertexUsseMemAllocated(
+	const SceGxmShaderPatcher *shaderPatcher)
+{
+	(void)shaderPatcher;
+
+	return 0;
+}
+
+uint32_t sceGxmShaderPatcherGetFragmentUsseMemAllocated(
+	const SceGxmShaderPatcher *shaderPatcher)
+{
+	(void)shaderPatcher;
+
+	return 0;
+}
+
+/*
+ * Program queries
+ */
+
+static int psp2GxmRecIsProgram(const SceGxmProgram *program)
+{
+	return program != NULL && memcmp(program, PSP2_GXM_REC_PROGRAM_MAGIC,
+		sizeof(PSP2_GXM_REC_PROGRAM_MAGIC)) == 0;
+}
+
+static int psp2GxmRecIsParameter(const SceGxmProgramParameter *parameter)
+{
+	return parameter != NULL
+		&& parameter->magic == PSP2_GXM_REC_MAGIC_PARAMETER;
+}
+
+/*
+ * Find a parameter of a program, or make it up: each parameter is a vec4 of
+ * floats in the next four registers, of the default uniform buffer for a
+ * uniform.  Parameters are kept until the process exits, as their programs
+ * are not registered with anything that could free them.
+ */
+static const SceGxmProgramParameter *psp2GxmRecFindParameter(
+	const char *function, const SceGxmProgram *program,
+	SceGxmParameterCategory category, const char *name,
+	SceGxmParameterSemantic semantic, uint32_t semanticIndex)
+{
+	SceGxmProgramParameter *parameter;
+	uint32_t index;
+	size_t size;
+
+	pthread_mutex_lock(&psp2GxmRec.mutex);
+
+	index = 0;
+	for (parameter = psp2GxmRec.parameters; parameter != NULL;
+			parameter = parameter->next) {
+		if (parameter->program != program || parameter->category != category)
+			continue;
+		if (parameter->semantic == semantic
+			&& parameter->semanticIndex == semanticIndex
+			&& strcmp(parameter->name, name) == 0)
+			break;
+		index++;
+	}
+
+	if (parameter == NULL) {
+		size = strlen(name) + 1;
+		parameter = malloc(sizeof(*parameter) + size);
+		if (parameter != NULL) {
+			parameter->magic = PSP2_GXM_REC_MAGIC_PARAMETER;
+			parameter->program = program;
+			parameter->next = psp2GxmRec.parameters;
+			parameter->category = category;
+			parameter->semantic = semantic;
+			parameter->semanticIndex = semanticIndex;
+			parameter->index = index;
+			memcpy(parameter->name, name, size);
+			psp2GxmRec.parameters = parameter;
+		}
+	}
+
+	pthread_mutex_unlock(&psp2GxmRec.mutex);
+
+	if (parameter == NULL)
+		psp2GxmRecError(function, SCE_GXM_ERROR_OUT_OF_MEMORY,
+			"cannot allocate parameter %s", name);
+
+	return parameter;
+}
+
+SceGxmErrorCode sceGxmProgramCheck(const SceGxmProgram *program)
+{
+	if (program == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"NULL program");
+	if (!psp2GxmRecIsProgram(program))
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_VALUE,
+			"%p is not a GXP program", (const void *)program);
+
+	return SCE_OK;
+}
+
+uint32_t sceGxmProgramGetSize(const SceGxmProgram *program)
+{
+	uint32_t size;
+
+	if (!psp2GxmRecIsProgram(program))
+		return 0;
+
+	memcpy(&size, (const uint8_t *)program + PSP2_GXM_REC_PROGRAM_SIZE_OFFSET,
+		sizeof(size));
+
+	return size;
+}
+
+bool sceGxmProgramIsEquivalent(const SceGxmProgram *programA,
+	const SceGxmProgram *programB)
+{
+	uint32_t size;
+
+	size = sceGxmProgramGetSize(programA);
+
+	return size != 0 && size == sceGxmProgramGetSize(programB)
+		&& memcmp(programA, programB, size) == 0;
+}
+
+/* The size reserved by sceGxmReserveVertexDefaultUniformBuffer */
+uint32_t sceGxmProgramGetDefaultUniformBufferSize(
+	const SceGxmProgram *program)
+{
+	return psp2GxmRecIsProgram(program) ?
+		PSP2_GXM_REC_DEFAULT_UNIFORM_BUFFER_SIZE : 0;
+}
+
+/* Parameters are only made up when they are looked up */
+uint32_t sceGxmProgramGetParameterCount(const SceGxmProgram *program)
+{
+	(void)program;
+
+	return 0;
+}
+
+const SceGxmProgramParameter *sceGxmProgramGetParameter(
+	const SceGxmProgram *program, uint32_t index)
+{
+	(void)program;
+	(void)index;
+
+	return NULL;
+}
+
+const SceGxmProgramParameter *sceGxmProgramFindParameterByName(
+	const SceGxmProgram *program, const char *name)
+{
+	if (!psp2GxmRecIsProgram(program) || name == NULL) {
+		psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad program or name");
+		return NULL;
+	}
+
+	return psp2GxmRecFindParameter(__func__, program,
+		SCE_GXM_PARAMETER_CATEGORY_UNIFORM, name,
+		SCE_GXM_PARAMETER_SEMANTIC_NONE, 0);
+}
+
+const SceGxmProgramParameter *sceGxmProgramFindParameterBySemantic(
+	const SceGxmProgram *program, SceGxmParameterSemantic semantic,
+	uint32_t index)
+{
+	if (!psp2GxmRecIsProgram(program)) {
+		psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"bad program");
+		return NULL;
+	}
+	if (semantic == SCE_GXM_PARAMETER_SEMANTIC_NONE)
+		return NULL;
+
+	return psp2GxmRecFindParameter(__func__, program,
+		SCE_GXM_PARAMETER_CATEGORY_ATTRIBUTE, "", semantic, index);
+}
+
+uint32_t sceGxmProgramParameterGetIndex(const SceGxmProgram *program,
+	const SceGxmProgramParameter *parameter)
+{
+	if (!psp2GxmRecIsParameter(parameter) || parameter->program != program)
+		return 0;
+
+	return parameter->index;
+}
+
+SceGxmParameterCategory sceGxmProgramParameterGetCategory(
+	const SceGxmProgramParameter *parameter)
+{
+	return psp2GxmRecIsParameter(parameter) ?
+		parameter->category : SCE_GXM_PARAMETER_CATEGORY_UNIFORM;
+}
+
+const char *sceGxmProgramParameterGetName(
+	const SceGxmProgramParameter *parameter)
+{
+	return psp2GxmRecIsParameter(parameter) ? parameter->name : NULL;
+}
+
+SceGxmParameterSemantic sceGxmProgramParameterGetSemantic(
+	const SceGxmProgramParameter *parameter)
+{
+	return psp2GxmRecIsParameter(parameter) ?
+		parameter->semantic : SCE_GXM_PARAMETER_SEMANTIC_NONE;
+}
+
+uint32_t sceGxmProgramParameterGetSemanticIndex(
+	const SceGxmProgramParameter *parameter)
+{
+	return psp2GxmRecIsParameter(parameter) ? parameter->semanticIndex : 0;
+}
+
+SceGxmParameterType sceGxmProgramParameterGetType(
+	const SceGxmProgramParameter *parameter)
+{
+	(void)parameter;
+
+	return SCE_GXM_PARAMETER_TYPE_F32;
+}
+
+uint32_t sceGxmProgramParameterGetComponentCount(
+	const SceGxmProgramParameter *parameter)
+{
+	(void)parameter;
+
+	return 4;
+}
+
+uint32_t sceGxmProgramParameterGetArraySize(
+	const SceGxmProgramParameter *parameter)
+{
+	(void)parameter;
+
+	return 1;
+}
+
+/* Uniforms wrap around in the default uniform buffer */
+uint32_t sceGxmProgramParameterGetResourceIndex(
+	const SceGxmProgramParameter *parameter)
+{
+	if (!psp2GxmRecIsParameter(parameter))
+		return 0;
+
+	if (parameter->category == SCE_GXM_PARAMETER_CATEGORY_UNIFORM)
+		return parameter->index * 4
+			% (PSP2_GXM_REC_DEFAULT_UNIFORM_BUFFER_SIZE / sizeof(float));
+
+	return parameter->index * 4;
+}
+
+uint32_t sceGxmProgramParameterGetContainerIndex(
+	const SceGxmProgramParameter *parameter)
+{
+	return psp2GxmRecIsParameter(parameter)
+		&& parameter->category == SCE_GXM_PARAMETER_CATEGORY_UNIFORM ?
+		SCE_GXM_MAX_UNIFORM_BUFFERS : 0;
+}
+
+bool sceGxmProgramParameterIsSamplerCube(
+	const SceGxmProgramParameter *parameter)
+{
+	(void)parameter;
+
+	return false;
+}
+
+bool sceGxmProgramParameterIsRegFormat(const SceGxmProgram *program,
+	const SceGxmProgramParameter *parameter)
+{
+	(void)program;
+	(void)parameter;
+
+	return false;
+}
+
+/*
+ * Surfaces
+ */
+
+SceGxmErrorCode sceGxmColorSurfaceInit(SceGxmColorSurface *surface,
+	SceGxmColorFormat colorFormat, SceGxmColorSurfaceType surfaceType,
+	SceGxmColorSurfaceScaleMode scaleMode,
+	SceGxmOutputRegisterSize outputRegisterSize,
+	uint32_t width, uint32_t height, uint32_t strideInPixels, void *data)
+{
+	Psp2GxmRecColorSurface fields;
+
+	if (surface == NULL || data == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"NULL surface or data");
+	if (width == 0 || height == 0 || width > 4096 || height > 4096
+		|| strideInPixels < width)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_VALUE,
+			"bad size %ux%u or stride %u", width, height, strideInPixels);
+
+	fields.magic = PSP2_GXM_REC_MAGIC_COLOR_SURFACE;
+	fields.format = colorFormat;
+	fields.type = surfaceType;
+	fields.scaleMode = scaleMode;
+	fields.outputRegisterSize = outputRegisterSize;
+	fields.width = width;
+	fields.height = height;
+	fields.strideInPixels = strideInPixels;
+	fields.data = data;
+
+	memset(surface, 0, sizeof(*surface));
+	memcpy(surface, &fields, sizeof(fields));
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmColorSurfaceInitDisabled(SceGxmColorSurface *surface)
+{
+	if (surface == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"NULL surface");
+
+	memset(surface, 0, sizeof(*surface));
+
+	return SCE_OK;
+}
+
+bool sceGxmColorSurfaceIsEnabled(const SceGxmColorSurface *surface)
+{
+	uint32_t magic;
+
+	memcpy(&magic, surface, sizeof(magic));
+
+	return magic == PSP2_GXM_REC_MAGIC_COLOR_SURFACE;
+}
+
+void *sceGxmColorSurfaceGetData(const SceGxmColorSurface *surface)
+{
+	Psp2GxmRecColorSurface fields;
+
+	memcpy(&fields, surface, sizeof(fields));
+
+	return fields.magic == PSP2_GXM_REC_MAGIC_COLOR_SURFACE ?
+		fields.data : NULL;
+}
+
+/* The control word holds the format and type, and is 0 once disabled */
+SceGxmErrorCode sceGxmDepthStencilSurfaceInit(
+	SceGxmDepthStencilSurface *surface,
+	SceGxmDepthStencilFormat depthStencilFormat,
+	SceGxmDepthStencilSurfaceType surfaceType, uint32_t strideInSamples,
+	void *depthData, void *stencilData)
+{
+	if (surface == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"NULL surface");
+	if (strideInSamples == 0)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_VALUE,
+			"no stride");
+
+	surface->zlsControl = depthStencilFormat | surfaceType;
+	surface->depthData = depthData;
+	surface->stencilData = stencilData;
+	surface->backgroundDepth = 1.0f;
+	surface->backgroundControl = strideInSamples;
+
+	return SCE_OK;
+}
+
+SceGxmErrorCode sceGxmDepthStencilSurfaceInitDisabled(
+	SceGxmDepthStencilSurface *surface)
+{
+	if (surface == NULL)
+		return psp2GxmRecError(__func__, SCE_GXM_ERROR_INVALID_POINTER,
+			"NULL surface");
+
+	memset(surface, 0, sizeof(*surface));
+	surface->backgroundDepth = 1.0f;
+
+	return SCE_OK;
+}
+
+bool sceGxmDepthStencilSurfaceIsEnabled(
+	const SceGxmDepthStencilSurface *surface)
+{
+	return surface->zlsControl != 0;
+}
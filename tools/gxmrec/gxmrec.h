@@ -0,0 +1,242 @@
+/**
+ * \file gxmrec.h
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+
+#ifndef _PSP2_GXMREC_H_
+#define _PSP2_GXMREC_H_
+
+/**
+ * @file
+ *
+ * Host library that implements the libgxm API as a recorder, so that render
+ * loops can run, be validated and be benchmarked off the device.
+ *
+ * The library defines the functions of contexts, scenes, draws, precomputed
+ * draws and states, render targets, sync objects, the shader patcher, memory
+ * mapping, notifications and the display queue, and those of programs and
+ * surfaces that render loops set up with.  Nothing is rendered: every
+ * scene completes as soon as it ends.  Instead, the recorder:
+ *
+ * - validates the calls, reporting misuse to the error callback with the
+ *   error code the call returns;
+ * - counts draws, state changes and uniform data for each frame, a frame
+ *   ending at each #sceGxmDisplayQueueAddEntry() or #sceGxmPadHeartbeat();
+ * - optionally writes the commands to a binary log, described below.
+ *
+ * The data of vertex streams, indices and uniform buffers must be in memory
+ * mapped with #sceGxmMapMemory(), as for the GPU.  Programs are not parsed
+ * beyond their magic and size, so #sceGxmSetUniformDataF() only counts the
+ * data it would write, and the parameters found by name or semantic are made
+ * up: each is a float vec4 in the next free registers, uniforms in the
+ * default uniform buffer.  Programs list no parameters, and the queries that
+ * need a parsed program, such as #sceGxmProgramGetType(), are not defined.
+ * Surfaces can be initialized and checked for being enabled; the other
+ * surface functions and the texture functions are not part of the recorder.
+ *
+ * The log starts with a #Psp2GxmRecLogHeader.  Each record is then a
+ * 32-bit word made with #PSP2_GXM_REC_RECORD(), followed by its payload of
+ * 32-bit words in host byte order.  Pointers take two words, the low one
+ * first.  The records of a command list are written when it is executed,
+ * with the identifier of its deferred context.
+ */
+#include <stdint.h>
+#include <psp2/gxm.h>
+
+#ifdef	__cplusplus
+extern "C" {
+#endif	// def __cplusplus
+
+/** The magic of a log */
+#define PSP2_GXM_REC_LOG_MAGIC		0x524D5847U	// "GXMR"
+
+/** The version of the log format */
+#define PSP2_GXM_REC_LOG_VERSION	1U
+
+/** Makes a record word */
+#define PSP2_GXM_REC_RECORD(op, context, size)	\
+	((uint32_t)(op) | (uint32_t)(context) << 8 | (uint32_t)(size) << 16)
+
+/** Gets the operation of a record word */
+#define PSP2_GXM_REC_RECORD_OP(record)		((record) & 0xFF)
+
+/** Gets the context identifier of a record word, 0 for the immediate context */
+#define PSP2_GXM_REC_RECORD_CONTEXT(record)	((record) >> 8 & 0xFF)
+
+/** Gets the number of payload words of a record word */
+#define PSP2_GXM_REC_RECORD_SIZE(record)	((record) >> 16)
+
+/**
+ * The header of a log.
+ */
+typedef struct Psp2GxmRecLogHeader {
+	uint32_t magic;				//!< #PSP2_GXM_REC_LOG_MAGIC.
+	uint32_t version;			//!< #PSP2_GXM_REC_LOG_VERSION.
+} Psp2GxmRecLogHeader;
+
+/**
+ * The operations of the records, with their payloads.
+ */
+typedef enum Psp2GxmRecOp {
+	PSP2_GXM_REC_OP_FRAME,						//!< The frame number, at the end of a frame.
+	PSP2_GXM_REC_OP_BEGIN_SCENE,				//!< The flags, width and height of the render target.
+	PSP2_GXM_REC_OP_END_SCENE,
+	PSP2_GXM_REC_OP_MID_SCENE_FLUSH,			//!< The flags.
+	PSP2_GXM_REC_OP_SET_VERTEX_PROGRAM,			//!< The program.
+	PSP2_GXM_REC_OP_SET_FRAGMENT_PROGRAM,		//!< The program.
+	PSP2_GXM_REC_OP_SET_VERTEX_STREAM,			//!< The index and the data.
+	PSP2_GXM_REC_OP_SET_VERTEX_TEXTURE,			//!< The index and the 4 control words.
+	PSP2_GXM_REC_OP_SET_FRAGMENT_TEXTURE,		//!< The index and the 4 control words.
+	PSP2_GXM_REC_OP_SET_VERTEX_UNIFORM_BUFFER,	//!< The index and the data.
+	PSP2_GXM_REC_OP_SET_FRAGMENT_UNIFORM_BUFFER,	//!< The index and the data.
+	PSP2_GXM_REC_OP_SET_VERTEX_DEFAULT_UNIFORM_BUFFER,		//!< The data, or 0 when reserved.
+	PSP2_GXM_REC_OP_SET_FRAGMENT_DEFAULT_UNIFORM_BUFFER,	//!< The data, or 0 when reserved.
+	PSP2_GXM_REC_OP_SET_PRECOMPUTED_VERTEX_STATE,	//!< The state.
+	PSP2_GXM_REC_OP_SET_PRECOMPUTED_FRAGMENT_STATE,	//!< The state.
+	PSP2_GXM_REC_OP_SET_STATE,					//!< The #Psp2GxmRecState, then its values.
+	PSP2_GXM_REC_OP_DRAW,						//!< The primitive type, index format, indices, index count and index wrap, 0 if not instanced.
+	PSP2_GXM_REC_OP_DRAW_PRECOMPUTED,			//!< The precomputed draw, its vertex program, then the words of #PSP2_GXM_REC_OP_DRAW.
+	PSP2_GXM_REC_OP_EXECUTE_COMMAND_LIST,		//!< The identifier of the deferred context.
+	PSP2_GXM_REC_OP_VERTEX_FENCE,
+	PSP2_GXM_REC_OP_FINISH,
+	PSP2_GXM_REC_OP_PUSH_USER_MARKER,			//!< The tag, nul-terminated and padded to a word.
+	PSP2_GXM_REC_OP_POP_USER_MARKER,
+	PSP2_GXM_REC_OP_SET_USER_MARKER,			//!< The tag, nul-terminated and padded to a word.
+	PSP2_GXM_REC_OP_COUNT
+} Psp2GxmRecOp;
+
+/**
+ * The render states of #PSP2_GXM_REC_OP_SET_STATE, with their values.
+ */
+typedef enum Psp2GxmRecState {
+	PSP2_GXM_REC_STATE_FRONT_DEPTH_FUNC,
+	PSP2_GXM_REC_STATE_BACK_DEPTH_FUNC,
+	PSP2_GXM_REC_STATE_FRONT_FRAGMENT_PROGRAM_ENABLE,
+	PSP2_GXM_REC_STATE_BACK_FRAGMENT_PROGRAM_ENABLE,
+	PSP2_GXM_REC_STATE_FRONT_DEPTH_WRITE_ENABLE,
+	PSP2_GXM_REC_STATE_BACK_DEPTH_WRITE_ENABLE,
+	PSP2_GXM_REC_STATE_FRONT_LINE_FILL_LAST_PIXEL_ENABLE,
+	PSP2_GXM_REC_STATE_BACK_LINE_FILL_LAST_PIXEL_ENABLE,
+	PSP2_GXM_REC_STATE_FRONT_STENCIL_REF,
+	PSP2_GXM_REC_STATE_BACK_STENCIL_REF,
+	PSP2_GXM_REC_STATE_FRONT_POINT_LINE_WIDTH,
+	PSP2_GXM_REC_STATE_BACK_POINT_LINE_WIDTH,
+	PSP2_GXM_REC_STATE_FRONT_POLYGON_MODE,
+	PSP2_GXM_REC_STATE_BACK_POLYGON_MODE,
+	PSP2_GXM_REC_STATE_FRONT_STENCIL_FUNC,		//!< The function, the 3 operations and the 2 masks.
+	PSP2_GXM_REC_STATE_BACK_STENCIL_FUNC,		//!< The function, the 3 operations and the 2 masks.
+	PSP2_GXM_REC_STATE_FRONT_DEPTH_BIAS,		//!< The factor and the units.
+	PSP2_GXM_REC_STATE_BACK_DEPTH_BIAS,			//!< The factor and the units.
+	PSP2_GXM_REC_STATE_TWO_SIDED_ENABLE,
+	PSP2_GXM_REC_STATE_VIEWPORT,				//!< The 6 floats.
+	PSP2_GXM_REC_STATE_W_CLAMP_VALUE,			//!< A float.
+	PSP2_GXM_REC_STATE_W_CLAMP_ENABLE,
+	PSP2_GXM_REC_STATE_REGION_CLIP,				//!< The mode and the 4 bounds.
+	PSP2_GXM_REC_STATE_CULL_MODE,
+	PSP2_GXM_REC_STATE_VIEWPORT_ENABLE,
+	PSP2_GXM_REC_STATE_W_BUFFER_ENABLE,
+	PSP2_GXM_REC_STATE_FRONT_VISIBILITY_TEST_INDEX,
+	PSP2_GXM_REC_STATE_BACK_VISIBILITY_TEST_INDEX,
+	PSP2_GXM_REC_STATE_FRONT_VISIBILITY_TEST_OP,
+	PSP2_GXM_REC_STATE_BACK_VISIBILITY_TEST_OP,
+	PSP2_GXM_REC_STATE_FRONT_VISIBILITY_TEST_ENABLE,
+	PSP2_GXM_REC_STATE_BACK_VISIBILITY_TEST_ENABLE,
+	PSP2_GXM_REC_STATE_COUNT
+} Psp2GxmRecState;
+
+/** The largest number of values of a render state */
+#define PSP2_GXM_REC_STATE_MAX_VALUES	6
+
+/**
+ * Statistics of the commands.
+ */
+typedef struct Psp2GxmRecStats {
+	uint32_t frames;
+	uint32_t scenes;
+	uint32_t draws;						//!< Draws of any kind.
+	uint32_t instancedDraws;
+	uint32_t precomputedDraws;
+	uint64_t indices;					//!< The index count of the draws.
+	uint32_t stateChanges;				//!< Calls that changed a program, resource or render state.
+	uint32_t redundantStateChanges;		//!< Calls that set the current value again.
+	uint32_t programChanges;
+	uint32_t textureChanges;
+	uint32_t uniformBufferChanges;		//!< Including default uniform buffers.
+	uint64_t uniformBytes;				//!< Written with #sceGxmSetUniformDataF().
+	uint32_t commandLists;				//!< Command lists executed.
+	uint32_t errors;					//!< Calls reported to the error callback.
+} Psp2GxmRecStats;
+
+/**
+ * Called at the end of each frame.
+ *
+ * @param[in]	stats		The statistics of the frame.
+ * @param[in]	userData	The user data of #psp2GxmRecSetFrameCallback().
+ */
+typedef void (*Psp2GxmRecFrameCallback)(const Psp2GxmRecStats *stats,
+	void *userData);
+
+/**
+ * Called for each misuse of the API.
+ *
+ * @param[in]	function	The name of the libgxm function.
+ * @param[in]	error		The error the function returns, or #SCE_OK if it
+ * 							returns nothing.
+ * @param[in]	message		What is wrong.
+ * @param[in]	userData	The user data of #psp2GxmRecSetErrorCallback().
+ */
+typedef void (*Psp2GxmRecErrorCallback)(const char *function, int error,
+	const char *message, void *userData);
+
+/**
+ * Starts writing the commands to a log.
+ *
+ * @param[in]	path	The path of the log.
+ *
+ * @return
+ * 0 on success, or -1 with errno set on failure.
+ */
+int psp2GxmRecOpenLog(const char *path);
+
+/**
+ * Flushes and closes the log.
+ *
+ * @return
+ * 0 on success, or -1 with errno set on failure.
+ */
+int psp2GxmRecCloseLog(void);
+
+/**
+ * Sets the function called at the end of each frame, or NULL.
+ */
+void psp2GxmRecSetFrameCallback(Psp2GxmRecFrameCallback callback,
+	void *userData);
+
+/**
+ * Sets the function called for each misuse, or NULL to print them to the
+ * standard error, which is the default.
+ */
+void psp2GxmRecSetErrorCallback(Psp2GxmRecErrorCallback callback,
+	void *userData);
+
+/**
+ * Gets the statistics of the current frame and of all the frames.  The
+ * statistics of the immediate context are added when a scene ends, and those
+ * of a command list when it is executed.
+ *
+ * @param[out]	frame	The statistics of the current frame, or NULL.
+ * @param[out]	total	The statistics since #sceGxmInitialize(), or NULL.
+ */
+void psp2GxmRecGetStats(Psp2GxmRecStats *frame, Psp2GxmRecStats *total);
+
+#ifdef	__cplusplus
+}
+#endif	// def __cplusplus
+
+#endif /* _PSP2_GXMREC_H_ */
@@ -0,0 +1,327 @@
+/**
+ * \file formats.h
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+/*
+ * The names of the texture formats of <psp2/gxm/constants.h>, without their
+ * SCE_GXM_TEXTURE_FORMAT_ prefix.  Define PSP2_GXT_CONV_FORMAT(name) before
+ * including this file.
+ */
+
+PSP2_GXT_CONV_FORMAT(U8_000R)
+PSP2_GXT_CONV_FORMAT(U8_111R)
+PSP2_GXT_CONV_FORMAT(U8_RRRR)
+PSP2_GXT_CONV_FORMAT(U8_0RRR)
+PSP2_GXT_CONV_FORMAT(U8_1RRR)
+PSP2_GXT_CONV_FORMAT(U8_R000)
+PSP2_GXT_CONV_FORMAT(U8_R111)
+PSP2_GXT_CONV_FORMAT(U8_R)
+PSP2_GXT_CONV_FORMAT(S8_000R)
+PSP2_GXT_CONV_FORMAT(S8_111R)
+PSP2_GXT_CONV_FORMAT(S8_RRRR)
+PSP2_GXT_CONV_FORMAT(S8_0RRR)
+PSP2_GXT_CONV_FORMAT(S8_1RRR)
+PSP2_GXT_CONV_FORMAT(S8_R000)
+PSP2_GXT_CONV_FORMAT(S8_R111)
+PSP2_GXT_CONV_FORMAT(S8_R)
+PSP2_GXT_CONV_FORMAT(U4U4U4U4_ABGR)
+PSP2_GXT_CONV_FORMAT(U4U4U4U4_ARGB)
+PSP2_GXT_CONV_FORMAT(U4U4U4U4_RGBA)
+PSP2_GXT_CONV_FORMAT(U4U4U4U4_BGRA)
+PSP2_GXT_CONV_FORMAT(X4U4U4U4_1BGR)
+PSP2_GXT_CONV_FORMAT(X4U4U4U4_1RGB)
+PSP2_GXT_CONV_FORMAT(U4U4U4X4_RGB1)
+PSP2_GXT_CONV_FORMAT(U4U4U4X4_BGR1)
+PSP2_GXT_CONV_FORMAT(U8U3U3U2_ARGB)
+PSP2_GXT_CONV_FORMAT(U1U5U5U5_ABGR)
+PSP2_GXT_CONV_FORMAT(U1U5U5U5_ARGB)
+PSP2_GXT_CONV_FORMAT(U5U5U5U1_RGBA)
+PSP2_GXT_CONV_FORMAT(U5U5U5U1_BGRA)
+PSP2_GXT_CONV_FORMAT(X1U5U5U5_1BGR)
+PSP2_GXT_CONV_FORMAT(X1U5U5U5_1RGB)
+PSP2_GXT_CONV_FORMAT(U5U5U5X1_RGB1)
+PSP2_GXT_CONV_FORMAT(U5U5U5X1_BGR1)
+PSP2_GXT_CONV_FORMAT(U5U6U5_BGR)
+PSP2_GXT_CONV_FORMAT(U5U6U5_RGB)
+PSP2_GXT_CONV_FORMAT(U6S5S5_BGR)
+PSP2_GXT_CONV_FORMAT(S5S5U6_RGB)
+PSP2_GXT_CONV_FORMAT(U8U8_00GR)
+PSP2_GXT_CONV_FORMAT(U8U8_GRRR)
+PSP2_GXT_CONV_FORMAT(U8U8_RGGG)
+PSP2_GXT_CONV_FORMAT(U8U8_GRGR)
+PSP2_GXT_CONV_FORMAT(U8U8_00RG)
+PSP2_GXT_CONV_FORMAT(U8U8_GR)
+PSP2_GXT_CONV_FORMAT(S8S8_00GR)
+PSP2_GXT_CONV_FORMAT(S8S8_GRRR)
+PSP2_GXT_CONV_FORMAT(S8S8_RGGG)
+PSP2_GXT_CONV_FORMAT(S8S8_GRGR)
+PSP2_GXT_CONV_FORMAT(S8S8_00RG)
+PSP2_GXT_CONV_FORMAT(S8S8_GR)
+PSP2_GXT_CONV_FORMAT(U16_000R)
+PSP2_GXT_CONV_FORMAT(U16_111R)
+PSP2_GXT_CONV_FORMAT(U16_RRRR)
+PSP2_GXT_CONV_FORMAT(U16_0RRR)
+PSP2_GXT_CONV_FORMAT(U16_1RRR)
+PSP2_GXT_CONV_FORMAT(U16_R000)
+PSP2_GXT_CONV_FORMAT(U16_R111)
+PSP2_GXT_CONV_FORMAT(U16_R)
+PSP2_GXT_CONV_FORMAT(S16_000R)
+PSP2_GXT_CONV_FORMAT(S16_111R)
+PSP2_GXT_CONV_FORMAT(S16_RRRR)
+PSP2_GXT_CONV_FORMAT(S16_0RRR)
+PSP2_GXT_CONV_FORMAT(S16_1RRR)
+PSP2_GXT_CONV_FORMAT(S16_R000)
+PSP2_GXT_CONV_FORMAT(S16_R111)
+PSP2_GXT_CONV_FORMAT(S16_R)
+PSP2_GXT_CONV_FORMAT(F16_000R)
+PSP2_GXT_CONV_FORMAT(F16_111R)
+PSP2_GXT_CONV_FORMAT(F16_RRRR)
+PSP2_GXT_CONV_FORMAT(F16_0RRR)
+PSP2_GXT_CONV_FORMAT(F16_1RRR)
+PSP2_GXT_CONV_FORMAT(F16_R000)
+PSP2_GXT_CONV_FORMAT(F16_R111)
+PSP2_GXT_CONV_FORMAT(F16_R)
+PSP2_GXT_CONV_FORMAT(U8U8U8U8_ABGR)
+PSP2_GXT_CONV_FORMAT(U8U8U8U8_ARGB)
+PSP2_GXT_CONV_FORMAT(U8U8U8U8_RGBA)
+PSP2_GXT_CONV_FORMAT(U8U8U8U8_BGRA)
+PSP2_GXT_CONV_FORMAT(X8U8U8U8_1BGR)
+PSP2_GXT_CONV_FORMAT(X8U8U8U8_1RGB)
+PSP2_GXT_CONV_FORMAT(U8U8U8X8_RGB1)
+PSP2_GXT_CONV_FORMAT(U8U8U8X8_BGR1)
+PSP2_GXT_CONV_FORMAT(S8S8S8S8_ABGR)
+PSP2_GXT_CONV_FORMAT(S8S8S8S8_ARGB)
+PSP2_GXT_CONV_FORMAT(S8S8S8S8_RGBA)
+PSP2_GXT_CONV_FORMAT(S8S8S8S8_BGRA)
+PSP2_GXT_CONV_FORMAT(X8S8S8S8_1BGR)
+PSP2_GXT_CONV_FORMAT(X8S8S8S8_1RGB)
+PSP2_GXT_CONV_FORMAT(S8S8S8X8_RGB1)
+PSP2_GXT_CONV_FORMAT(S8S8S8X8_BGR1)
+PSP2_GXT_CONV_FORMAT(U2U10U10U10_ABGR)
+PSP2_GXT_CONV_FORMAT(U2U10U10U10_ARGB)
+PSP2_GXT_CONV_FORMAT(U10U10U10U2_RGBA)
+PSP2_GXT_CONV_FORMAT(U10U10U10U2_BGRA)
+PSP2_GXT_CONV_FORMAT(X2U10U10U10_1BGR)
+PSP2_GXT_CONV_FORMAT(X2U10U10U10_1RGB)
+PSP2_GXT_CONV_FORMAT(U10U10U10X2_RGB1)
+PSP2_GXT_CONV_FORMAT(U10U10U10X2_BGR1)
+PSP2_GXT_CONV_FORMAT(U16U16_00GR)
+PSP2_GXT_CONV_FORMAT(U16U16_GRRR)
+PSP2_GXT_CONV_FORMAT(U16U16_RGGG)
+PSP2_GXT_CONV_FORMAT(U16U16_GRGR)
+PSP2_GXT_CONV_FORMAT(U16U16_00RG)
+PSP2_GXT_CONV_FORMAT(U16U16_GR)
+PSP2_GXT_CONV_FORMAT(S16S16_00GR)
+PSP2_GXT_CONV_FORMAT(S16S16_GRRR)
+PSP2_GXT_CONV_FORMAT(S16S16_RGGG)
+PSP2_GXT_CONV_FORMAT(S16S16_GRGR)
+PSP2_GXT_CONV_FORMAT(S16S16_00RG)
+PSP2_GXT_CONV_FORMAT(S16S16_GR)
+PSP2_GXT_CONV_FORMAT(F16F16_00GR)
+PSP2_GXT_CONV_FORMAT(F16F16_GRRR)
+PSP2_GXT_CONV_FORMAT(F16F16_RGGG)
+PSP2_GXT_CONV_FORMAT(F16F16_GRGR)
+PSP2_GXT_CONV_FORMAT(F16F16_00RG)
+PSP2_GXT_CONV_FORMAT(F16F16_GR)
+PSP2_GXT_CONV_FORMAT(F32_000R)
+PSP2_GXT_CONV_FORMAT(F32_111R)
+PSP2_GXT_CONV_FORMAT(F32_RRRR)
+PSP2_GXT_CONV_FORMAT(F32_0RRR)
+PSP2_GXT_CONV_FORMAT(F32_1RRR)
+PSP2_GXT_CONV_FORMAT(F32_R000)
+PSP2_GXT_CONV_FORMAT(F32_R111)
+PSP2_GXT_CONV_FORMAT(F32_R)
+PSP2_GXT_CONV_FORMAT(F32M_000R)
+PSP2_GXT_CONV_FORMAT(F32M_111R)
+PSP2_GXT_CONV_FORMAT(F32M_RRRR)
+PSP2_GXT_CONV_FORMAT(F32M_0RRR)
+PSP2_GXT_CONV_FORMAT(F32M_1RRR)
+PSP2_GXT_CONV_FORMAT(F32M_R000)
+PSP2_GXT_CONV_FORMAT(F32M_R111)
+PSP2_GXT_CONV_FORMAT(F32M_R)
+PSP2_GXT_CONV_FORMAT(X8S8S8U8_1BGR)
+PSP2_GXT_CONV_FORMAT(X8U8S8S8_1RGB)
+PSP2_GXT_CONV_FORMAT(X8U24_SD)
+PSP2_GXT_CONV_FORMAT(U24X8_DS)
+PSP2_GXT_CONV_FORMAT(U32_000R)
+PSP2_GXT_CONV_FORMAT(U32_111R)
+PSP2_GXT_CONV_FORMAT(U32_RRRR)
+PSP2_GXT_CONV_FORMAT(U32_0RRR)
+PSP2_GXT_CONV_FORMAT(U32_1RRR)
+PSP2_GXT_CONV_FORMAT(U32_R000)
+PSP2_GXT_CONV_FORMAT(U32_R111)
+PSP2_GXT_CONV_FORMAT(U32_R)
+PSP2_GXT_CONV_FORMAT(S32_000R)
+PSP2_GXT_CONV_FORMAT(S32_111R)
+PSP2_GXT_CONV_FORMAT(S32_RRRR)
+PSP2_GXT_CONV_FORMAT(S32_0RRR)
+PSP2_GXT_CONV_FORMAT(S32_1RRR)
+PSP2_GXT_CONV_FORMAT(S32_R000)
+PSP2_GXT_CONV_FORMAT(S32_R111)
+PSP2_GXT_CONV_FORMAT(S32_R)
+PSP2_GXT_CONV_FORMAT(SE5M9M9M9_BGR)
+PSP2_GXT_CONV_FORMAT(SE5M9M9M9_RGB)
+PSP2_GXT_CONV_FORMAT(F10F11F11_BGR)
+PSP2_GXT_CONV_FORMAT(F11F11F10_RGB)
+PSP2_GXT_CONV_FORMAT(F16F16F16F16_ABGR)
+PSP2_GXT_CONV_FORMAT(F16F16F16F16_ARGB)
+PSP2_GXT_CONV_FORMAT(F16F16F16F16_RGBA)
+PSP2_GXT_CONV_FORMAT(F16F16F16F16_BGRA)
+PSP2_GXT_CONV_FORMAT(X16F16F16F16_1BGR)
+PSP2_GXT_CONV_FORMAT(X16F16F16F16_1RGB)
+PSP2_GXT_CONV_FORMAT(F16F16F16X16_RGB1)
+PSP2_GXT_CONV_FORMAT(F16F16F16X16_BGR1)
+PSP2_GXT_CONV_FORMAT(U16U16U16U16_ABGR)
+PSP2_GXT_CONV_FORMAT(U16U16U16U16_ARGB)
+PSP2_GXT_CONV_FORMAT(U16U16U16U16_RGBA)
+PSP2_GXT_CONV_FORMAT(U16U16U16U16_BGRA)
+PSP2_GXT_CONV_FORMAT(X16U16U16U16_1BGR)
+PSP2_GXT_CONV_FORMAT(X16U16U16U16_1RGB)
+PSP2_GXT_CONV_FORMAT(U16U16U16X16_RGB1)
+PSP2_GXT_CONV_FORMAT(U16U16U16X16_BGR1)
+PSP2_GXT_CONV_FORMAT(S16S16S16S16_ABGR)
+PSP2_GXT_CONV_FORMAT(S16S16S16S16_ARGB)
+PSP2_GXT_CONV_FORMAT(S16S16S16S16_RGBA)
+PSP2_GXT_CONV_FORMAT(S16S16S16S16_BGRA)
+PSP2_GXT_CONV_FORMAT(X16S16S16S16_1BGR)
+PSP2_GXT_CONV_FORMAT(X16S16S16S16_1RGB)
+PSP2_GXT_CONV_FORMAT(S16S16S16X16_RGB1)
+PSP2_GXT_CONV_FORMAT(S16S16S16X16_BGR1)
+PSP2_GXT_CONV_FORMAT(F32F32_00GR)
+PSP2_GXT_CONV_FORMAT(F32F32_GRRR)
+PSP2_GXT_CONV_FORMAT(F32F32_RGGG)
+PSP2_GXT_CONV_FORMAT(F32F32_GRGR)
+PSP2_GXT_CONV_FORMAT(F32F32_00RG)
+PSP2_GXT_CONV_FORMAT(F32F32_GR)
+PSP2_GXT_CONV_FORMAT(U32U32_00GR)
+PSP2_GXT_CONV_FORMAT(U32U32_GRRR)
+PSP2_GXT_CONV_FORMAT(U32U32_RGGG)
+PSP2_GXT_CONV_FORMAT(U32U32_GRGR)
+PSP2_GXT_CONV_FORMAT(U32U32_00RG)
+PSP2_GXT_CONV_FORMAT(U32U32_GR)
+PSP2_GXT_CONV_FORMAT(PVRT2BPP_ABGR)
+PSP2_GXT_CONV_FORMAT(PVRT2BPP_1BGR)
+PSP2_GXT_CONV_FORMAT(PVRT4BPP_ABGR)
+PSP2_GXT_CONV_FORMAT(PVRT4BPP_1BGR)
+PSP2_GXT_CONV_FORMAT(PVRTII2BPP_ABGR)
+PSP2_GXT_CONV_FORMAT(PVRTII2BPP_1BGR)
+PSP2_GXT_CONV_FORMAT(PVRTII4BPP_ABGR)
+PSP2_GXT_CONV_FORMAT(PVRTII4BPP_1BGR)
+PSP2_GXT_CONV_FORMAT(UBC1_ABGR)
+PSP2_GXT_CONV_FORMAT(UBC1_1BGR)
+PSP2_GXT_CONV_FORMAT(UBC2_ABGR)
+PSP2_GXT_CONV_FORMAT(UBC2_1BGR)
+PSP2_GXT_CONV_FORMAT(UBC3_ABGR)
+PSP2_GXT_CONV_FORMAT(UBC3_1BGR)
+PSP2_GXT_CONV_FORMAT(UBC4_000R)
+PSP2_GXT_CONV_FORMAT(UBC4_111R)
+PSP2_GXT_CONV_FORMAT(UBC4_RRRR)
+PSP2_GXT_CONV_FORMAT(UBC4_0RRR)
+PSP2_GXT_CONV_FORMAT(UBC4_1RRR)
+PSP2_GXT_CONV_FORMAT(UBC4_R000)
+PSP2_GXT_CONV_FORMAT(UBC4_R111)
+PSP2_GXT_CONV_FORMAT(UBC4_R)
+PSP2_GXT_CONV_FORMAT(SBC4_000R)
+PSP2_GXT_CONV_FORMAT(SBC4_111R)
+PSP2_GXT_CONV_FORMAT(SBC4_RRRR)
+PSP2_GXT_CONV_FORMAT(SBC4_0RRR)
+PSP2_GXT_CONV_FORMAT(SBC4_1RRR)
+PSP2_GXT_CONV_FORMAT(SBC4_R000)
+PSP2_GXT_CONV_FORMAT(SBC4_R111)
+PSP2_GXT_CONV_FORMAT(SBC4_R)
+PSP2_GXT_CONV_FORMAT(UBC5_00GR)
+PSP2_GXT_CONV_FORMAT(UBC5_GRRR)
+PSP2_GXT_CONV_FORMAT(UBC5_RGGG)
+PSP2_GXT_CONV_FORMAT(UBC5_GRGR)
+PSP2_GXT_CONV_FORMAT(UBC5_00RG)
+PSP2_GXT_CONV_FORMAT(UBC5_GR)
+PSP2_GXT_CONV_FORMAT(SBC5_00GR)
+PSP2_GXT_CONV_FORMAT(SBC5_GRRR)
+PSP2_GXT_CONV_FORMAT(SBC5_RGGG)
+PSP2_GXT_CONV_FORMAT(SBC5_GRGR)
+PSP2_GXT_CONV_FORMAT(SBC5_00RG)
+PSP2_GXT_CONV_FORMAT(SBC5_GR)
+PSP2_GXT_CONV_FORMAT(YUV420P2_CSC0)
+PSP2_GXT_CONV_FORMAT(YVU420P2_CSC0)
+PSP2_GXT_CONV_FORMAT(YUV420P2_CSC1)
+PSP2_GXT_CONV_FORMAT(YVU420P2_CSC1)
+PSP2_GXT_CONV_FORMAT(YUV420P3_CSC0)
+PSP2_GXT_CONV_FORMAT(YVU420P3_CSC0)
+PSP2_GXT_CONV_FORMAT(YUV420P3_CSC1)
+PSP2_GXT_CONV_FORMAT(YVU420P3_CSC1)
+PSP2_GXT_CONV_FORMAT(YUYV422_CSC0)
+PSP2_GXT_CONV_FORMAT(YVYU422_CSC0)
+PSP2_GXT_CONV_FORMAT(UYVY422_CSC0)
+PSP2_GXT_CONV_FORMAT(VYUY422_CSC0)
+PSP2_GXT_CONV_FORMAT(YUYV422_CSC1)
+PSP2_GXT_CONV_FORMAT(YVYU422_CSC1)
+PSP2_GXT_CONV_FORMAT(UYVY422_CSC1)
+PSP2_GXT_CONV_FORMAT(VYUY422_CSC1)
+PSP2_GXT_CONV_FORMAT(P4_ABGR)
+PSP2_GXT_CONV_FORMAT(P4_ARGB)
+PSP2_GXT_CONV_FORMAT(P4_RGBA)
+PSP2_GXT_CONV_FORMAT(P4_BGRA)
+PSP2_GXT_CONV_FORMAT(P4_1BGR)
+PSP2_GXT_CONV_FORMAT(P4_1RGB)
+PSP2_GXT_CONV_FORMAT(P4_RGB1)
+PSP2_GXT_CONV_FORMAT(P4_BGR1)
+PSP2_GXT_CONV_FORMAT(P8_ABGR)
+PSP2_GXT_CONV_FORMAT(P8_ARGB)
+PSP2_GXT_CONV_FORMAT(P8_RGBA)
+PSP2_GXT_CONV_FORMAT(P8_BGRA)
+PSP2_GXT_CONV_FORMAT(P8_1BGR)
+PSP2_GXT_CONV_FORMAT(P8_1RGB)
+PSP2_GXT_CONV_FORMAT(P8_RGB1)
+PSP2_GXT_CONV_FORMAT(P8_BGR1)
+PSP2_GXT_CONV_FORMAT(U8U8U8_BGR)
+PSP2_GXT_CONV_FORMAT(U8U8U8_RGB)
+PSP2_GXT_CONV_FORMAT(S8S8S8_BGR)
+PSP2_GXT_CONV_FORMAT(S8S8S8_RGB)
+PSP2_GXT_CONV_FORMAT(U2F10F10F10_ABGR)
+PSP2_GXT_CONV_FORMAT(U2F10F10F10_ARGB)
+PSP2_GXT_CONV_FORMAT(F10F10F10U2_RGBA)
+PSP2_GXT_CONV_FORMAT(F10F10F10U2_BGRA)
+PSP2_GXT_CONV_FORMAT(X2F10F10F10_1BGR)
+PSP2_GXT_CONV_FORMAT(X2F10F10F10_1RGB)
+PSP2_GXT_CONV_FORMAT(F10F10F10X2_RGB1)
+PSP2_GXT_CONV_FORMAT(F10F10F10X2_BGR1)
+PSP2_GXT_CONV_FORMAT(L8)
+PSP2_GXT_CONV_FORMAT(A8)
+PSP2_GXT_CONV_FORMAT(R8)
+PSP2_GXT_CONV_FORMAT(A4R4G4B4)
+PSP2_GXT_CONV_FORMAT(A1R5G5B5)
+PSP2_GXT_CONV_FORMAT(R5G6B5)
+PSP2_GXT_CONV_FORMAT(A8L8)
+PSP2_GXT_CONV_FORMAT(L8A8)
+PSP2_GXT_CONV_FORMAT(G8R8)
+PSP2_GXT_CONV_FORMAT(L16)
+PSP2_GXT_CONV_FORMAT(A16)
+PSP2_GXT_CONV_FORMAT(R16)
+PSP2_GXT_CONV_FORMAT(D16)
+PSP2_GXT_CONV_FORMAT(LF16)
+PSP2_GXT_CONV_FORMAT(AF16)
+PSP2_GXT_CONV_FORMAT(RF16)
+PSP2_GXT_CONV_FORMAT(A8R8G8B8)
+PSP2_GXT_CONV_FORMAT(A8B8G8R8)
+PSP2_GXT_CONV_FORMAT(AF16LF16)
+PSP2_GXT_CONV_FORMAT(LF16AF16)
+PSP2_GXT_CONV_FORMAT(GF16RF16)
+PSP2_GXT_CONV_FORMAT(LF32M)
+PSP2_GXT_CONV_FORMAT(AF32M)
+PSP2_GXT_CONV_FORMAT(RF32M)
+PSP2_GXT_CONV_FORMAT(DF32M)
+PSP2_GXT_CONV_FORMAT(VYUY)
+PSP2_GXT_CONV_FORMAT(YVYU)
+PSP2_GXT_CONV_FORMAT(UBC1)
+PSP2_GXT_CONV_FORMAT(UBC2)
+PSP2_GXT_CONV_FORMAT(UBC3)
+PSP2_GXT_CONV_FORMAT(PVRT2BPP)
+PSP2_GXT_CONV_FORMAT(PVRT4BPP)
+PSP2_GXT_CONV_FORMAT(PVRTII2BPP)
+PSP2_GXT_CONV_FORMAT(PVRTII4BPP)
@@ -0,0 +1,707 @@
+/**
+ * \file gxtconv.c
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <psp2/gxt.h>
+#include "gxtconv.h"
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/* The element of a format: a pixel or a compressed block */
+typedef struct Psp2GxtConvElement {
+	uint32_t bits;
+	uint32_t blockWidth;
+	uint32_t blockHeight;
+	int copy;		/* The data is copied unchanged */
+} Psp2GxtConvElement;
+
+/* A level being converted, and the rows a thread converts */
+typedef struct Psp2GxtConvJob {
+	uint8_t *dst;
+	const uint8_t *src;
+	uint32_t type;
+	uint32_t bits;
+	uint32_t width;			/* In elements */
+	uint32_t height;
+	uint32_t dstWidth;		/* In elements, padded */
+	uint32_t dstHeight;
+	const uint32_t *tableX;
+	const uint32_t *tableY;
+	uint32_t y0;
+	uint32_t y1;
+} Psp2GxtConvJob;
+
+static int psp2GxtConvGetElement(uint32_t format, Psp2GxtConvElement *element)
+{
+	uint32_t base;
+
+	base = format & SCE_GXM_TEXTURE_BASE_FORMAT_MASK;
+	element->blockWidth = 1;
+	element->blockHeight = 1;
+	element->copy = 0;
+
+	if (base < SCE_GXM_TEXTURE_BASE_FORMAT_U4U4U4U4)
+		element->bits = 8;
+	else if (base < SCE_GXM_TEXTURE_BASE_FORMAT_U8U8U8U8)
+		element->bits = 16;
+	else if (base < SCE_GXM_TEXTURE_BASE_FORMAT_F16F16F16F16)
+		element->bits = 32;
+	else if (base <= SCE_GXM_TEXTURE_BASE_FORMAT_U32U32)
+		element->bits = 64;
+	else
+		switch (base) {
+		case SCE_GXM_TEXTURE_BASE_FORMAT_PVRT2BPP:
+		case SCE_GXM_TEXTURE_BASE_FORMAT_PVRTII2BPP:
+			element->bits = 2;
+			element->copy = 1;
+			break;
+		case SCE_GXM_TEXTURE_BASE_FORMAT_PVRT4BPP:
+		case SCE_GXM_TEXTURE_BASE_FORMAT_PVRTII4BPP:
+			element->bits = 4;
+			element->copy = 1;
+			break;
+		case SCE_GXM_TEXTURE_BASE_FORMAT_UBC1:
+		case SCE_GXM_TEXTURE_BASE_FORMAT_UBC4:
+		case SCE_GXM_TEXTURE_BASE_FORMAT_SBC4:
+			element->bits = 64;
+			element->blockWidth = 4;
+			element->blockHeight = 4;
+			break;
+		case SCE_GXM_TEXTURE_BASE_FORMAT_UBC2:
+		case SCE_GXM_TEXTURE_BASE_FORMAT_UBC3:
+		case SCE_GXM_TEXTURE_BASE_FORMAT_UBC5:
+		case SCE_GXM_TEXTURE_BASE_FORMAT_SBC5:
+			element->bits = 128;
+			element->blockWidth = 4;
+			element->blockHeight = 4;
+			break;
+		case SCE_GXM_TEXTURE_BASE_FORMAT_P4:
+			element->bits = 4;
+			break;
+		case SCE_GXM_TEXTURE_BASE_FORMAT_P8:
+			element->bits = 8;
+			break;
+		case SCE_GXM_TEXTURE_BASE_FORMAT_U8U8U8:
+		case SCE_GXM_TEXTURE_BASE_FORMAT_S8S8S8:
+			element->bits = 24;
+			break;
+		case SCE_GXM_TEXTURE_BASE_FORMAT_U2F10F10F10:
+			element->bits = 32;
+			break;
+		default:
+			return -1;
+		}
+
+	return 0;
+}
+
+static uint32_t psp2GxtConvPow2(uint32_t x)
+{
+	uint32_t p;
+
+	for (p = 1; p < x; p <<= 1)
+		;
+
+	return p;
+}
+
+/* Spread the low 16 bits of x to the even bits */
+static uint32_t psp2GxtConvSpread(uint32_t x)
+{
+	x &= 0xFFFF;
+	x = (x | (x << 8)) & 0x00FF00FF;
+	x = (x | (x << 4)) & 0x0F0F0F0F;
+	x = (x | (x << 2)) & 0x33333333;
+	x = (x | (x << 1)) & 0x55555555;
+
+	return x;
+}
+
+/*
+ * Get the layout of a level: its size in elements, its padded size in the
+ * destination, and its size in bytes in the source and the destination.
+ */
+static int psp2GxtConvGetLevel(const Psp2GxtConvImage *image, uint32_t level,
+	Psp2GxtConvJob *job, size_t *srcSize, size_t *dstSize)
+{
+	Psp2GxtConvElement element;
+	uint32_t width, height, pw, ph;
+
+	if (psp2GxtConvGetElement(image->format, &element) < 0
+		|| image->width == 0 || image->height == 0 || level >= 32)
+		return -1;
+
+	width = image->width >> level;
+	height = image->height >> level;
+	if (width == 0)
+		width = 1;
+	if (height == 0)
+		height = 1;
+
+	job->type = image->type;
+	job->bits = element.bits;
+	job->width = (width + element.blockWidth - 1) / element.blockWidth;
+	job->height = (height + element.blockHeight - 1) / element.blockHeight;
+	*srcSize = ((size_t)job->width * element.bits + 7) / 8 * job->height;
+
+	if (element.copy) {
+		// PVRT levels are at least 16x8 or 8x8 pixels, as for the GPU.
+		pw = psp2GxtConvPow2(image->width) >> level;
+		ph = psp2GxtConvPow2(image->height) >> level;
+		if (pw < 32 / element.bits)
+			pw = 32 / element.bits;
+		if (ph < 8)
+			ph = 8;
+		job->type = (uint32_t)-1;
+		*srcSize = *dstSize = (size_t)pw * ph * element.bits / 8;
+		return 0;
+	}
+
+	switch (image->type) {
+	case SCE_GXM_TEXTURE_SWIZZLED:
+		// The levels are halved from the padded size of the first one.
+		pw = psp2GxtConvPow2(image->width) >> level;
+		ph = psp2GxtConvPow2(image->height) >> level;
+		if (pw < element.blockWidth)
+			pw = element.blockWidth;
+		if (ph < element.blockHeight)
+			ph = element.blockHeight;
+		job->dstWidth = pw / element.blockWidth;
+		job->dstHeight = ph / element.blockHeight;
+		break;
+	case SCE_GXM_TEXTURE_TILED:
+		job->dstWidth = (job->width + 31) & ~31U;
+		job->dstHeight = (job->height + 31) & ~31U;
+		break;
+	case SCE_GXM_TEXTURE_LINEAR:
+		job->dstWidth = (job->width + 7) & ~7U;
+		job->dstHeight = job->height;
+		break;
+	default:
+		return -1;
+	}
+
+	*dstSize = ((size_t)job->dstWidth * job->dstHeight * element.bits + 7) / 8;
+
+	return 0;
+}
+
+static void psp2GxtConvCopyGroupScalar(uint8_t *d, const uint8_t *a,
+	const uint8_t *b, uint32_t e)
+{
+	memcpy(d, a, 2 * e);
+	memcpy(d + 2 * e, b, 2 * e);
+	memcpy(d + 4 * e, a + 2 * e, 2 * e);
+	memcpy(d + 6 * e, b + 2 * e, 2 * e);
+}
+
+/*
+ * Swizzle the groups of 4x2 elements of a pair of rows from x0, and return
+ * the first element not converted.  The elements of a group are contiguous
+ * in Morton order: x0 y0 x1.
+ */
+typedef uint32_t (*Psp2GxtConvGroupFunc)(const Psp2GxtConvJob *job,
+	uint32_t y, uint32_t x0);
+
+static uint32_t psp2GxtConvGroupsScalar(const Psp2GxtConvJob *job,
+	uint32_t y, uint32_t x)
+{
+	const uint8_t *a, *b;
+	uint32_t e, row;
+
+	e = job->bits / 8;
+	a = job->src + (size_t)y * job->width * e;
+	b = a + (size_t)job->width * e;
+	row = job->tableY[y];
+	for (; x + 4 <= job->width; x += 4)
+		psp2GxtConvCopyGroupScalar(
+			job->dst + (size_t)(job->tableX[x] | row) * e,
+			a + (size_t)x * e, b + (size_t)x * e, e);
+
+	return x;
+}
+
+#if defined(__SSE2__)
+static uint32_t psp2GxtConvGroupsSse2(const Psp2GxtConvJob *job,
+	uint32_t y, uint32_t x)
+{
+	const uint8_t *a, *b;
+	uint8_t *dst;
+	__m128i va, vb, lo, hi;
+	uint32_t e, row;
+
+	e = job->bits / 8;
+	a = job->src + (size_t)y * job->width * e;
+	b = a + (size_t)job->width * e;
+	row = job->tableY[y];
+	dst = job->dst;
+
+#define PSP2_GXT_CONV_DST(x)	(dst + (size_t)(job->tableX[x] | row) * e)
+	switch (e) {
+	case 1:
+		for (; x + 16 <= job->width; x += 16) {
+			va = _mm_loadu_si128((const __m128i *)(a + x));
+			vb = _mm_loadu_si128((const __m128i *)(b + x));
+			lo = _mm_unpacklo_epi16(va, vb);
+			hi = _mm_unpackhi_epi16(va, vb);
+			_mm_storel_epi64((__m128i *)PSP2_GXT_CONV_DST(x), lo);
+			_mm_storel_epi64((__m128i *)PSP2_GXT_CONV_DST(x + 4),
+				_mm_srli_si128(lo, 8));
+			_mm_storel_epi64((__m128i *)PSP2_GXT_CONV_DST(x + 8), hi);
+			_mm_storel_epi64((__m128i *)PSP2_GXT_CONV_DST(x + 12),
+				_mm_srli_si128(hi, 8));
+		}
+		break;
+	case 2:
+		for (; x + 8 <= job->width; x += 8) {
+			va = _mm_loadu_si128((const __m128i *)(a + x * 2));
+			vb = _mm_loadu_si128((const __m128i *)(b + x * 2));
+			_mm_storeu_si128((__m128i *)PSP2_GXT_CONV_DST(x),
+				_mm_unpacklo_epi32(va, vb));
+			_mm_storeu_si128((__m128i *)PSP2_GXT_CONV_DST(x + 4),
+				_mm_unpackhi_epi32(va, vb));
+		}
+		break;
+	case 4:
+		for (; x + 4 <= job->width; x += 4) {
+			va = _mm_loadu_si128((const __m128i *)(a + x * 4));
+			vb = _mm_loadu_si128((const __m128i *)(b + x * 4));
+			_mm_storeu_si128((__m128i *)PSP2_GXT_CONV_DST(x),
+				_mm_unpacklo_epi64(va, vb));
+			_mm_storeu_si128((__m128i *)PSP2_GXT_CONV_DST(x) + 1,
+				_mm_unpackhi_epi64(va, vb));
+		}
+		break;
+	case 8:
+	case 16:
+		for (; x + 4 <= job->width; x += 4) {
+			const __m128i *sa, *sb;
+			__m128i *d;
+			uint32_t i, n;
+
+			// The pairs of elements of a row are already 16-byte units.
+			sa = (const __m128i *)(a + (size_t)x * e);
+			sb = (const __m128i *)(b + (size_t)x * e);
+			d = (__m128i *)PSP2_GXT_CONV_DST(x);
+			n = e / 8;
+			for (i = 0; i < n; i++) {
+				_mm_storeu_si128(d + i, _mm_loadu_si128(sa + i));
+				_mm_storeu_si128(d + n + i, _mm_loadu_si128(sb + i));
+				_mm_storeu_si128(d + 2 * n + i, _mm_loadu_si128(sa + n + i));
+				_mm_storeu_si128(d + 3 * n + i, _mm_loadu_si128(sb + n + i));
+			}
+		}
+		break;
+	default:
+		break;
+	}
+#undef PSP2_GXT_CONV_DST
+
+	return psp2GxtConvGroupsScalar(job, y, x);
+}
+#endif
+
+#if defined(__SSE2__) && defined(__GNUC__)
+#define PSP2_GXT_CONV_AVX2
+
+__attribute__((target("avx2")))
+static uint32_t psp2GxtConvGroupsAvx2(const Psp2GxtConvJob *job,
+	uint32_t y, uint32_t x)
+{
+	const uint8_t *a, *b;
+	uint8_t *dst;
+	__m256i va, vb, lo, hi;
+	uint32_t e, row;
+
+	e = job->bits / 8;
+	a = job->src + (size_t)y * job->width * e;
+	b = a + (size_t)job->width * e;
+	row = job->tableY[y];
+	dst = job->dst;
+
+#define PSP2_GXT_CONV_DST(x)	(dst + (size_t)(job->tableX[x] | row) * e)
+	switch (e) {
+	case 2:
+		for (; x + 16 <= job->width; x += 16) {
+			va = _mm256_loadu_si256((const __m256i *)(a + x * 2));
+			vb = _mm256_loadu_si256((const __m256i *)(b + x * 2));
+			lo = _mm256_unpacklo_epi32(va, vb);
+			hi = _mm256_unpackhi_epi32(va, vb);
+			_mm_storeu_si128((__m128i *)PSP2_GXT_CONV_DST(x),
+				_mm256_castsi256_si128(lo));
+			_mm_storeu_si128((__m128i *)PSP2_GXT_CONV_DST(x + 4),
+				_mm256_castsi256_si128(hi));
+			_mm_storeu_si128((__m128i *)PSP2_GXT_CONV_DST(x + 8),
+				_mm256_extracti128_si256(lo, 1));
+			_mm_storeu_si128((__m128i *)PSP2_GXT_CONV_DST(x + 12),
+				_mm256_extracti128_si256(hi, 1));
+		}
+		break;
+	case 4:
+		for (; x + 8 <= job->width; x += 8) {
+			va = _mm256_loadu_si256((const __m256i *)(a + x * 4));
+			vb = _mm256_loadu_si256((const __m256i *)(b + x * 4));
+			lo = _mm256_unpacklo_epi64(va, vb);
+			hi = _mm256_unpackhi_epi64(va, vb);
+			_mm256_storeu_si256((__m256i *)PSP2_GXT_CONV_DST(x),
+				_mm256_permute2x128_si256(lo, hi, 0x20));
+			_mm256_storeu_si256((__m256i *)PSP2_GXT_CONV_DST(x + 4),
+				_mm256_permute2x128_si256(lo, hi, 0x31));
+		}
+		break;
+	default:
+		break;
+	}
+#undef PSP2_GXT_CONV_DST
+
+	return psp2GxtConvGroupsSse2(job, y, x);
+}
+#endif
+
+static Psp2GxtConvGroupFunc psp2GxtConvGetGroupFunc(void)
+{
+#ifdef PSP2_GXT_CONV_AVX2
+	if (__builtin_cpu_supports("avx2"))
+		return psp2GxtConvGroupsAvx2;
+#endif
+#if defined(__SSE2__)
+	return psp2GxtConvGroupsSse2;
+#else
+	return psp2GxtConvGroupsScalar;
+#endif
+}
+
+static void psp2GxtConvSwizzleRows(const Psp2GxtConvJob *job)
+{
+	Psp2GxtConvGroupFunc groups;
+	const uint8_t *src;
+	uint32_t x, y, e, nibble, address;
+
+	if (job->bits == 4) {
+		// Pixels of palettized 4-bit formats share bytes.
+		for (y = job->y0; y < job->y1; y++) {
+			src = job->src + (size_t)y * ((job->width + 1) / 2);
+			for (x = 0; x < job->width; x++) {
+				nibble = (src[x / 2] >> (x % 2 * 4)) & 0xF;
+				address = job->tableX[x] | job->tableY[y];
+				job->dst[address / 2] |= nibble << (address % 2 * 4);
+			}
+		}
+		return;
+	}
+
+	e = job->bits / 8;
+	groups = NULL;
+	if (job->dstWidth >= 4 && job->dstHeight >= 4
+		&& (e == 1 || e == 2 || e == 4 || e == 8 || e == 16))
+		groups = psp2GxtConvGetGroupFunc();
+
+	for (y = job->y0; y < job->y1; y++) {
+		x = 0;
+		if (groups != NULL && y % 2 == 0 && y + 1 < job->y1) {
+			x = groups(job, y, 0);
+			// Convert the rest of both rows.
+			for (; x < job->width; x++) {
+				memcpy(job->dst
+						+ (size_t)(job->tableX[x] | job->tableY[y]) * e,
+					job->src + ((size_t)y * job->width + x) * e, e);
+				memcpy(job->dst
+						+ (size_t)(job->tableX[x] | job->tableY[y + 1]) * e,
+					job->src + ((size_t)(y + 1) * job->width + x) * e, e);
+			}
+			y++;
+			continue;
+		}
+
+		for (; x < job->width; x++)
+			memcpy(job->dst + (size_t)(job->tableX[x] | job->tableY[y]) * e,
+				job->src + ((size_t)y * job->width + x) * e, e);
+	}
+}
+
+static void psp2GxtConvTileRows(const Psp2GxtConvJob *job)
+{
+	size_t srcPitch, tileSize;
+	uint32_t x, y, n;
+
+	srcPitch = ((size_t)job->width * job->bits + 7) / 8;
+	tileSize = 32 * 32 * job->bits / 8;
+	for (y = job->y0; y < job->y1; y++)
+		for (x = 0; x < job->width; x += 32) {
+			n = job->width - x < 32 ? job->width - x : 32;
+			memcpy(job->dst
+					+ ((size_t)(y / 32) * (job->dstWidth / 32) + x / 32)
+						* tileSize
+					+ (size_t)(y % 32) * 32 * job->bits / 8,
+				job->src + y * srcPitch + (size_t)x * job->bits / 8,
+				((size_t)n * job->bits + 7) / 8);
+		}
+}
+
+static void psp2GxtConvLinearRows(const Psp2GxtConvJob *job)
+{
+	size_t srcPitch, dstPitch;
+	uint32_t y;
+
+	srcPitch = ((size_t)job->width * job->bits + 7) / 8;
+	dstPitch = (size_t)job->dstWidth * job->bits / 8;
+	for (y = job->y0; y < job->y1; y++)
+		memcpy(job->dst + y * dstPitch, job->src + y * srcPitch, srcPitch);
+}
+
+static void *psp2GxtConvThread(void *arg)
+{
+	const Psp2GxtConvJob *job;
+
+	job = (const Psp2GxtConvJob *)arg;
+	switch (job->type) {
+	case SCE_GXM_TEXTURE_SWIZZLED:
+		psp2GxtConvSwizzleRows(job);
+		break;
+	case SCE_GXM_TEXTURE_TILED:
+		psp2GxtConvTileRows(job);
+		break;
+	default:
+		psp2GxtConvLinearRows(job);
+		break;
+	}
+
+	return NULL;
+}
+
+/* Convert a level, splitting its rows between threads */
+static int psp2GxtConvLevel(Psp2GxtConvJob *job, size_t srcSize,
+	unsigned threadCount)
+{
+	Psp2GxtConvJob jobs[64];
+	pthread_t threads[64];
+	uint32_t *tables, x, y, k, mask, rows, align;
+	unsigned i, n;
+
+	tables = NULL;
+	if (job->type == SCE_GXM_TEXTURE_SWIZZLED) {
+		tables = malloc((job->dstWidth + job->dstHeight) * sizeof(*tables));
+		if (tables == NULL)
+			return -1;
+
+		// Interleave the bits of the square of the smaller dimension.
+		mask = (job->dstWidth < job->dstHeight ?
+			job->dstWidth : job->dstHeight) - 1;
+		k = __builtin_popcount(mask);
+		for (x = 0; x < job->dstWidth; x++)
+			tables[x] = psp2GxtConvSpread(x & mask)
+				| (x & ~mask) << k;
+		for (y = 0; y < job->dstHeight; y++)
+			tables[job->dstWidth + y] = psp2GxtConvSpread(y & mask) << 1
+				| (y & ~mask) << k;
+		job->tableX = tables;
+		job->tableY = tables + job->dstWidth;
+	}
+
+	// Share out the rows by bands of at least 256 KiB.
+	align = job->type == SCE_GXM_TEXTURE_SWIZZLED ? 2 : 1;
+	n = srcSize / (256 * 1024);
+	if (n > threadCount)
+		n = threadCount;
+	if (n > 64)
+		n = 64;
+	if (n < 1)
+		n = 1;
+	rows = (job->height / n + align - 1) / align * align;
+
+	for (i = 0; i < n; i++) {
+		jobs[i] = *job;
+		jobs[i].y0 = i * rows < job->height ? i * rows : job->height;
+		jobs[i].y1 = i + 1 == n || (i + 1) * rows > job->height ?
+			job->height : (i + 1) * rows;
+		if (i > 0 && pthread_create(threads + i, NULL, psp2GxtConvThread,
+				jobs + i) != 0)
+			jobs[i].y0 = (uint32_t)-1;
+	}
+
+	psp2GxtConvThread(jobs);
+	for (i = 1; i < n; i++) {
+		if (jobs[i].y0 == (uint32_t)-1) {
+			// The thread was not created, so convert its rows here.
+			jobs[i].y0 = i * rows < job->height ? i * rows : job->height;
+			psp2GxtConvThread(jobs + i);
+		} else
+			pthread_join(threads[i], NULL);
+	}
+
+	free(tables);
+
+	return 0;
+}
+
+size_t psp2GxtConvGetLinearSize(const Psp2GxtConvImage *image)
+{
+	Psp2GxtConvJob job;
+	size_t size, srcSize, dstSize;
+	uint32_t level;
+
+	size = 0;
+	for (level = 0; level < (image->mipCount ? image->mipCount : 1); level++) {
+		if (psp2GxtConvGetLevel(image, level, &job, &srcSize, &dstSize) < 0)
+			return 0;
+		size += srcSize;
+	}
+
+	return size;
+}
+
+size_t psp2GxtConvGetSize(const Psp2GxtConvImage *image)
+{
+	Psp2GxtConvJob job;
+	size_t size, srcSize, dstSize;
+	uint32_t level;
+
+	size = 0;
+	for (level = 0; level < (image->mipCount ? image->mipCount : 1); level++) {
+		if (psp2GxtConvGetLevel(image, level, &job, &srcSize, &dstSize) < 0)
+			return 0;
+		size += dstSize;
+	}
+
+	return size;
+}
+
+int psp2GxtConvConvert(void *dst, const Psp2GxtConvImage *image,
+	unsigned threadCount)
+{
+	Psp2GxtConvJob job;
+	const uint8_t *src;
+	uint8_t *d;
+	size_t srcSize, dstSize;
+	uint32_t level;
+	long n;
+
+	if (threadCount == 0) {
+		n = sysconf(_SC_NPROCESSORS_ONLN);
+		threadCount = n > 0 ? n : 1;
+	}
+
+	src = (const uint8_t *)image->data;
+	d = (uint8_t *)dst;
+	for (level = 0; level < (image->mipCount ? image->mipCount : 1); level++) {
+		if (psp2GxtConvGetLevel(image, level, &job, &srcSize, &dstSize) < 0)
+			return -1;
+
+		if (job.type == (uint32_t)-1)
+			memcpy(d, src, srcSize);
+		else {
+			memset(d, 0, dstSize);
+			job.dst = d;
+			job.src = src;
+			if (psp2GxtConvLevel(&job, srcSize, threadCount) < 0)
+				return -1;
+		}
+
+		src += srcSize;
+		d += dstSize;
+	}
+
+	return 0;
+}
+
+int psp2GxtConvWriteGxt(FILE *fp, const Psp2GxtConvImage *images,
+	uint32_t imageCount, unsigned threadCount)
+{
+	static const uint8_t zeros[SCE_GXM_TEXTURE_ALIGNMENT];
+	SceGxtHeader header;
+	SceGxtTextureInfo *infos;
+	uint8_t *data;
+	size_t size, max, offset;
+	uint32_t i;
+	int ret;
+
+	infos = calloc(imageCount ? imageCount : 1, sizeof(*infos));
+	if (infos == NULL)
+		return -1;
+
+	memset(&header, 0, sizeof(header));
+	header.tag = SCE_GXT_TAG;
+	header.version = SCE_GXT_VERSION;
+	header.numTextures = imageCount;
+	header.dataOffset = (sizeof(header) + imageCount * sizeof(*infos)
+		+ SCE_GXM_TEXTURE_ALIGNMENT - 1) & ~(SCE_GXM_TEXTURE_ALIGNMENT - 1);
+
+	offset = header.dataOffset;
+	max = 0;
+	for (i = 0; i < imageCount; i++) {
+		size = psp2GxtConvGetSize(images + i);
+		if (size == 0 || size > UINT32_MAX || images[i].width > 0xFFFF
+			|| images[i].height > 0xFFFF || images[i].mipCount > 0xFF) {
+			free(infos);
+			errno = EINVAL;
+			return -1;
+		}
+
+		offset = (offset + SCE_GXM_TEXTURE_ALIGNMENT - 1)
+			& ~(size_t)(SCE_GXM_TEXTURE_ALIGNMENT - 1);
+		infos[i].dataOffset = offset;
+		infos[i].dataSize = size;
+		infos[i].paletteIndex = ~0U;
+		infos[i].type = images[i].type;
+		infos[i].format = images[i].format;
+		infos[i].width = images[i].width;
+		infos[i].height = images[i].height;
+		infos[i].mipCount = images[i].mipCount ? images[i].mipCount : 1;
+		offset += size;
+		if (max < size)
+			max = size;
+	}
+
+	if (offset > UINT32_MAX) {
+		free(infos);
+		errno = EFBIG;
+		return -1;
+	}
+	header.dataSize = offset - header.dataOffset;
+
+	data = malloc(max ? max : 1);
+	if (data == NULL) {
+		free(infos);
+		return -1;
+	}
+
+	ret = -1;
+	if (fwrite(&header, sizeof(header), 1, fp) != 1
+		|| fwrite(infos, sizeof(*infos), imageCount, fp) != imageCount
+		|| fwrite(zeros, header.dataOffset - sizeof(header)
+			- imageCount * sizeof(*infos), 1, fp) > 1)
+		goto done;
+
+	offset = header.dataOffset;
+	for (i = 0; i < imageCount; i++) {
+		if (fwrite(zeros, infos[i].dataOffset - offset, 1, fp) > 1)
+			goto done;
+		if (psp2GxtConvConvert(data, images + i, threadCount) < 0) {
+			errno = EINVAL;
+			goto done;
+		}
+		if (fwrite(data, infos[i].dataSize, 1, fp) != 1)
+			goto done;
+		offset = infos[i].dataOffset + infos[i].dataSize;
+	}
+
+	ret = 0;
+done:
+	free(data);
+	free(infos);
+
+	return ret;
+}
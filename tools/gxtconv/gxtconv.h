@@ -0,0 +1,107 @@
+/**
+ * \file gxtconv.h
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+
+#ifndef _PSP2_GXTCONV_H_
+#define _PSP2_GXTCONV_H_
+
+/**
+ * @file
+ *
+ * Host library that converts linear images to the memory layouts of the GPU
+ * and writes GXT files.
+ *
+ * The layouts are those of the texture types of #sceGxmTextureInitSwizzled(),
+ * #sceGxmTextureInitTiled() and #sceGxmTextureInitLinear():
+ *
+ * - Swizzled: the dimensions are rounded up to powers of two, and the
+ *   elements are in Morton order over the square of the smaller dimension,
+ *   with the bits of x below those of y.  The remaining bits of the larger
+ *   dimension are above.
+ * - Tiled: the dimensions are rounded up to 32, and tiles of 32x32 elements
+ *   are stored in row order, with the elements of a tile in row order.
+ * - Linear: the rows are padded to 8 elements.
+ *
+ * An element is a pixel, or a 4x4 block of the UBC and SBC formats.  The data
+ * of the PVRT formats is already in the layout of the GPU and is copied
+ * unchanged, and the YUV formats are not supported.  Each mip level is
+ * converted on its own, its dimensions halved from the previous one.
+ *
+ * Swizzling uses SSE2, or AVX2 where the processor has it, and a conversion
+ * is split between threads by rows.
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef	__cplusplus
+extern "C" {
+#endif	// def __cplusplus
+
+/**
+ * An image to convert.
+ */
+typedef struct Psp2GxtConvImage {
+	const void *data;					//!< The linear levels, the largest first, with tightly packed rows.
+	uint32_t format;					//!< The #SceGxmTextureFormat.
+	uint32_t type;						//!< #SCE_GXM_TEXTURE_SWIZZLED, #SCE_GXM_TEXTURE_TILED or #SCE_GXM_TEXTURE_LINEAR.
+	uint32_t width;
+	uint32_t height;
+	uint32_t mipCount;					//!< The number of levels, at least 1.
+} Psp2GxtConvImage;
+
+/**
+ * Returns the size of the linear data of an image, or 0 if its format or
+ * type is not supported.
+ */
+size_t psp2GxtConvGetLinearSize(const Psp2GxtConvImage *image);
+
+/**
+ * Returns the size of the converted data of an image, or 0 if its format or
+ * type is not supported.
+ */
+size_t psp2GxtConvGetSize(const Psp2GxtConvImage *image);
+
+/**
+ * Converts an image.
+ *
+ * @param[out]	dst				The converted data, of #psp2GxtConvGetSize() bytes.
+ * @param[in]	image			The image.
+ * @param[in]	threadCount		The number of threads to use, or 0 for the number of
+ * 								processors.
+ *
+ * @return
+ * 0 on success, or -1 if the format or type of the image is not supported.
+ */
+int psp2GxtConvConvert(void *dst, const Psp2GxtConvImage *image,
+	unsigned threadCount);
+
+/**
+ * Converts images and writes them to a GXT file.  The data of each texture
+ * is aligned to #SCE_GXM_TEXTURE_ALIGNMENT.  Palettes are not written, so
+ * palettized textures have no palette index.
+ *
+ * @param[in]	fp				The file.
+ * @param[in]	images			The images.
+ * @param[in]	imageCount		The number of images.
+ * @param[in]	threadCount		The number of threads to use, or 0 for the number of
+ * 								processors.
+ *
+ * @return
+ * 0 on success, or -1 with errno set on failure.
+ */
+int psp2GxtConvWriteGxt(FILE *fp, const Psp2GxtConvImage *images,
+	uint32_t imageCount, unsigned threadCount);
+
+#ifdef	__cplusplus
+}
+#endif	// def __cplusplus
+
+#endif /* _PSP2_GXTCONV_H_ */
@@ -0,0 +1,249 @@
+/**
+ * \file main.c
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+/*
+ * psp2-gxtconv: converts raw linear images and writes them to a GXT file.
+ *
+ * The options before an input apply to it and to the following ones, so
+ * that several images of the same format take a single -f.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <psp2/gxm/constants.h>
+#include "gxtconv.h"
+
+static const struct {
+	const char *name;
+	uint32_t format;
+} formats[] = {
+#define PSP2_GXT_CONV_FORMAT(name)	{ #name, SCE_GXM_TEXTURE_FORMAT_##name },
+#include "formats.h"
+#undef PSP2_GXT_CONV_FORMAT
+};
+
+static void usage(const char *argv0)
+{
+	fprintf(stderr, "usage: %s [-j threads] -o output.gxt"
+		" {[-f format] [-t swizzled|tiled|linear] [-m mips] -s WxH input}...\n"
+		"\n"
+		"Each input is a raw image with its levels, the largest first, and\n"
+		"tightly packed rows.  The format is the name of a texture format\n"
+		"without its SCE_GXM_TEXTURE_FORMAT_ prefix, or its value.\n"
+		"The default is U8U8U8U8_ABGR, swizzled, with one level.\n",
+		argv0);
+}
+
+static int parseFormat(const char *s, uint32_t *format)
+{
+	char *end;
+	size_t i;
+
+	for (i = 0; i < sizeof(formats) / sizeof(*formats); i++)
+		if (strcmp(s, formats[i].name) == 0) {
+			*format = formats[i].format;
+			return 0;
+		}
+
+	*format = strtoul(s, &end, 0);
+
+	return *end == '\0' && end != s ? 0 : -1;
+}
+
+static int parseType(const char *s, uint32_t *type)
+{
+	if (strcmp(s, "swizzled") == 0)
+		*type = SCE_GXM_TEXTURE_SWIZZLED;
+	else if (strcmp(s, "tiled") == 0)
+		*type = SCE_GXM_TEXTURE_TILED;
+	else if (strcmp(s, "linear") == 0)
+		*type = SCE_GXM_TEXTURE_LINEAR;
+	else
+		return -1;
+
+	return 0;
+}
+
+static void *readInput(const char *path, size_t size)
+{
+	FILE *fp;
+	void *data;
+	long length;
+
+	fp = fopen(path, "rb");
+	if (fp == NULL) {
+		perror(path);
+		return NULL;
+	}
+
+	if (fseek(fp, 0, SEEK_END) != 0 || (length = ftell(fp)) < 0
+		|| fseek(fp, 0, SEEK_SET) != 0) {
+		perror(path);
+		fclose(fp);
+		return NULL;
+	}
+
+	if ((size_t)length < size) {
+		fprintf(stderr, "%s: %ld bytes, expected %zu\n", path, length, size);
+		fclose(fp);
+		return NULL;
+	}
+
+	data = malloc(size ? size : 1);
+	if (data == NULL) {
+		perror(path);
+		fclose(fp);
+		return NULL;
+	}
+
+	if (fread(data, 1, size, fp) != size) {
+		fprintf(stderr, "%s: short read\n", path);
+		free(data);
+		data = NULL;
+	}
+
+	fclose(fp);
+
+	return data;
+}
+
+int main(int argc, char *argv[])
+{
+	Psp2GxtConvImage *images, current;
+	const char *output;
+	unsigned threadCount;
+	uint32_t count, i;
+	size_t size;
+	FILE *fp;
+	char *end;
+	int arg, ret;
+
+	images = calloc(argc, sizeof(*images));
+	if (images == NULL) {
+		perror(argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	memset(&current, 0, sizeof(current));
+	current.format = SCE_GXM_TEXTURE_FORMAT_U8U8U8U8_ABGR;
+	current.type = SCE_GXM_TEXTURE_SWIZZLED;
+	current.mipCount = 1;
+	output = NULL;
+	threadCount = 0;
+	count = 0;
+	ret = EXIT_FAILURE;
+
+	for (arg = 1; arg < argc; arg++) {
+		if (argv[arg][0] != '-') {
+			if (current.width == 0 || current.height == 0) {
+				fprintf(stderr, "%s: no size\n", argv[arg]);
+				goto done;
+			}
+
+			size = psp2GxtConvGetLinearSize(&current);
+			if (size == 0) {
+				fprintf(stderr, "%s: format 0x%08X is not supported\n",
+					argv[arg], current.format);
+				goto done;
+			}
+
+			current.data = readInput(argv[arg], size);
+			if (current.data == NULL)
+				goto done;
+
+			images[count++] = current;
+			continue;
+		}
+
+		if (argv[arg][1] == '\0' || argv[arg][2] != '\0'
+			|| arg + 1 >= argc) {
+			usage(argv[0]);
+			goto done;
+		}
+
+		arg++;
+		switch (argv[arg - 1][1]) {
+		case 'f':
+			if (parseFormat(argv[arg], &current.format) < 0) {
+				fprintf(stderr, "%s: unknown format\n", argv[arg]);
+				goto done;
+			}
+			break;
+		case 't':
+			if (parseType(argv[arg], &current.type) < 0) {
+				fprintf(stderr, "%s: unknown type\n", argv[arg]);
+				goto done;
+			}
+			break;
+		case 'm':
+			current.mipCount = strtoul(argv[arg], &end, 0);
+			if (*end != '\0' || current.mipCount == 0) {
+				fprintf(stderr, "%s: bad mip count\n", argv[arg]);
+				goto done;
+			}
+			break;
+		case 's':
+			current.width = strtoul(argv[arg], &end, 0);
+			if (*end == 'x')
+				current.height = strtoul(end + 1, &end, 0);
+			if (*end != '\0' || current.width == 0 || current.height == 0) {
+				fprintf(stderr, "%s: bad size\n", argv[arg]);
+				goto done;
+			}
+			break;
+		case 'j':
+			threadCount = strtoul(argv[arg], &end, 0);
+			if (*end != '\0') {
+				fprintf(stderr, "%s: bad thread count\n", argv[arg]);
+				goto done;
+			}
+			break;
+		case 'o':
+			output = argv[arg];
+			break;
+		default:
+			usage(argv[0]);
+			goto done;
+		}
+	}
+
+	if (output == NULL || count == 0) {
+		usage(argv[0]);
+		goto done;
+	}
+
+	fp = fopen(output, "wb");
+	if (fp == NULL) {
+		perror(output);
+		goto done;
+	}
+
+	if (psp2GxtConvWriteGxt(fp, images, count, threadCount) < 0) {
+		perror(output);
+		fclose(fp);
+		remove(output);
+		goto done;
+	}
+
+	if (fclose(fp) != 0) {
+		perror(output);
+		remove(output);
+		goto done;
+	}
+
+	ret = EXIT_SUCCESS;
+done:
+	for (i = 0; i < count; i++)
+		free((void *)images[i].data);
+	free(images);
+
+	return ret;
+}
@@ -0,0 +1,89 @@
+/**
+ * \file arm_neon.h
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+/*
+ * A portable stand-in for the NEON intrinsics used by the neon_cpp
+ * vectormath backend, so that psp2-vmcheck can run it on the build machine.
+ * Each intrinsic is computed lane by lane in plain C++.  The reciprocal
+ * square root estimates are exact here, where the hardware gives 8 bits, so
+ * the check covers the refinement steps and lane shuffles of the backend
+ * but not the precision of the estimate instructions.
+ */
+
+#ifndef _PSP2_VMCHECK_ARM_NEON_H_
+#define _PSP2_VMCHECK_ARM_NEON_H_
+
+#include <stdint.h>
+#include <math.h>
+
+struct float32x2_t { float v[2]; };
+struct float32x4_t { float v[4]; };
+struct uint32x4_t { uint32_t v[4]; };
+struct float32x4x2_t { float32x4_t val[2]; };
+
+#define PSP2_VMCHECK_LANES2(expr)	\
+	float32x2_t r; for (int i = 0; i < 2; i++) r.v[i] = (expr); return r;
+#define PSP2_VMCHECK_LANES4(expr)	\
+	float32x4_t r; for (int i = 0; i < 4; i++) r.v[i] = (expr); return r;
+#define PSP2_VMCHECK_LANES4U(expr)	\
+	uint32x4_t r; for (int i = 0; i < 4; i++) r.v[i] = (expr); return r;
+
+static inline float32x4_t vld1q_f32(const float *p) { PSP2_VMCHECK_LANES4(p[i]) }
+static inline void vst1q_f32(float *p, float32x4_t a) { for (int i = 0; i < 4; i++) p[i] = a.v[i]; }
+static inline void vst1q_u32(uint32_t *p, uint32x4_t a) { for (int i = 0; i < 4; i++) p[i] = a.v[i]; }
+
+static inline float32x4_t vdupq_n_f32(float a) { PSP2_VMCHECK_LANES4(a) }
+static inline uint32x4_t vdupq_n_u32(uint32_t a) { PSP2_VMCHECK_LANES4U(a) }
+static inline float32x4_t vdupq_lane_f32(float32x2_t a, int l) { PSP2_VMCHECK_LANES4(a.v[l]) }
+static inline float32x2_t vdup_lane_f32(float32x2_t a, int l) { PSP2_VMCHECK_LANES2(a.v[l]) }
+static inline float vget_lane_f32(float32x2_t a, int l) { return a.v[l]; }
+static inline float32x4_t vsetq_lane_f32(float x, float32x4_t a, int l) { a.v[l] = x; return a; }
+static inline float32x2_t vget_low_f32(float32x4_t a) { PSP2_VMCHECK_LANES2(a.v[i]) }
+static inline float32x2_t vget_high_f32(float32x4_t a) { PSP2_VMCHECK_LANES2(a.v[i + 2]) }
+static inline float32x4_t vcombine_f32(float32x2_t a, float32x2_t b) { PSP2_VMCHECK_LANES4(i < 2 ? a.v[i] : b.v[i - 2]) }
+static inline float32x4_t vrev64q_f32(float32x4_t a) { PSP2_VMCHECK_LANES4(a.v[i ^ 1]) }
+
+static inline float32x4x2_t vtrnq_f32(float32x4_t a, float32x4_t b)
+{
+	float32x4x2_t r;
+
+	for (int i = 0; i < 4; i += 2) {
+		r.val[0].v[i] = a.v[i];
+		r.val[0].v[i + 1] = b.v[i];
+		r.val[1].v[i] = a.v[i + 1];
+		r.val[1].v[i + 1] = b.v[i + 1];
+	}
+
+	return r;
+}
+
+static inline float32x2_t vadd_f32(float32x2_t a, float32x2_t b) { PSP2_VMCHECK_LANES2(a.v[i] + b.v[i]) }
+static inline float32x2_t vmul_f32(float32x2_t a, float32x2_t b) { PSP2_VMCHECK_LANES2(a.v[i] * b.v[i]) }
+static inline float32x2_t vpadd_f32(float32x2_t a, float32x2_t b) { PSP2_VMCHECK_LANES2(i == 0 ? a.v[0] + a.v[1] : b.v[0] + b.v[1]) }
+static inline float32x4_t vaddq_f32(float32x4_t a, float32x4_t b) { PSP2_VMCHECK_LANES4(a.v[i] + b.v[i]) }
+static inline float32x4_t vsubq_f32(float32x4_t a, float32x4_t b) { PSP2_VMCHECK_LANES4(a.v[i] - b.v[i]) }
+static inline float32x4_t vmulq_f32(float32x4_t a, float32x4_t b) { PSP2_VMCHECK_LANES4(a.v[i] * b.v[i]) }
+static inline float32x4_t vmulq_n_f32(float32x4_t a, float b) { PSP2_VMCHECK_LANES4(a.v[i] * b) }
+static inline float32x4_t vmulq_lane_f32(float32x4_t a, float32x2_t b, int l) { PSP2_VMCHECK_LANES4(a.v[i] * b.v[l]) }
+static inline float32x4_t vmlaq_f32(float32x4_t a, float32x4_t b, float32x4_t c) { PSP2_VMCHECK_LANES4(a.v[i] + b.v[i] * c.v[i]) }
+static inline float32x4_t vmlaq_n_f32(float32x4_t a, float32x4_t b, float c) { PSP2_VMCHECK_LANES4(a.v[i] + b.v[i] * c) }
+static inline float32x4_t vmlaq_lane_f32(float32x4_t a, float32x4_t b, float32x2_t c, int l) { PSP2_VMCHECK_LANES4(a.v[i] + b.v[i] * c.v[l]) }
+static inline float32x4_t vmlsq_f32(float32x4_t a, float32x4_t b, float32x4_t c) { PSP2_VMCHECK_LANES4(a.v[i] - b.v[i] * c.v[i]) }
+static inline float32x4_t vnegq_f32(float32x4_t a) { PSP2_VMCHECK_LANES4(-a.v[i]) }
+
+static inline float32x2_t vrsqrte_f32(float32x2_t a) { PSP2_VMCHECK_LANES2(1.0f / sqrtf(a.v[i])) }
+static inline float32x4_t vrsqrteq_f32(float32x4_t a) { PSP2_VMCHECK_LANES4(1.0f / sqrtf(a.v[i])) }
+static inline float32x2_t vrsqrts_f32(float32x2_t a, float32x2_t b) { PSP2_VMCHECK_LANES2((3.0f - a.v[i] * b.v[i]) * 0.5f) }
+static inline float32x4_t vrsqrtsq_f32(float32x4_t a, float32x4_t b) { PSP2_VMCHECK_LANES4((3.0f - a.v[i] * b.v[i]) * 0.5f) }
+
+static inline uint32x4_t vcltq_f32(float32x4_t a, float32x4_t b) { PSP2_VMCHECK_LANES4U(a.v[i] < b.v[i] ? ~0U : 0) }
+static inline uint32x4_t vorrq_u32(uint32x4_t a, uint32x4_t b) { PSP2_VMCHECK_LANES4U(a.v[i] | b.v[i]) }
+
+#endif /* _PSP2_VMCHECK_ARM_NEON_H_ */
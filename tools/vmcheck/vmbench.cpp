@@ -0,0 +1,139 @@
+/**
+ * \file vmbench.cpp
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+/*
+ * psp2-vmbench: times the per-call cost of vectormath operations.
+ *
+ * Each operation is run over a workload of 10000 transforms, on the backend
+ * named by PSP2_VMBENCH_BACKEND (Scalar by default, Sse, or Neon through the
+ * stand-in arm_neon.h of tools/vmcheck/neon, which only tells whether the
+ * calls inline, not how fast the device runs them).  The best of ROUNDS runs
+ * is printed in nanoseconds per transform, with a checksum of the results
+ * that keeps the compiler from dropping them.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <psp2/vectormath.h>
+
+#ifndef PSP2_VMBENCH_BACKEND
+#define PSP2_VMBENCH_BACKEND	Scalar
+#endif
+
+namespace Vm = sce::Vectormath::PSP2_VMBENCH_BACKEND::Aos;
+
+#define TRANSFORMS	10000
+#define ROUNDS		200
+
+static Vm::Matrix4 view;
+static Vm::Matrix4 worlds[TRANSFORMS];
+static Vm::Transform3 transforms[TRANSFORMS];
+static Vm::Point3 points[TRANSFORMS];
+static Vm::Vector4 vectors[TRANSFORMS];
+static Vm::Vector3 normals[TRANSFORMS];
+static Vm::Vector4 results[TRANSFORMS];
+
+static float random1()
+{
+	return (float)rand() / RAND_MAX * 2.0f - 1.0f;
+}
+
+static double now()
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static __attribute__((noinline)) void viewWorldPoint()
+{
+	for (int i = 0; i < TRANSFORMS; i++)
+		results[i] = (view * worlds[i]) * points[i];
+}
+
+static __attribute__((noinline)) void matrixVector()
+{
+	for (int i = 0; i < TRANSFORMS; i++)
+		results[i] = worlds[i] * vectors[i];
+}
+
+static __attribute__((noinline)) void transformPoint()
+{
+	for (int i = 0; i < TRANSFORMS; i++)
+		results[i] = Vm::Vector4(transforms[i] * points[i]);
+}
+
+static __attribute__((noinline)) void normalizeVector()
+{
+	for (int i = 0; i < TRANSFORMS; i++)
+		results[i] = Vm::Vector4(normalize(normals[i]), 0.0f);
+}
+
+static const struct Bench {
+	const char *name;
+	void (*run)();
+} benches[] = {
+	{ "(Matrix4 * Matrix4) * Point3",	viewWorldPoint },
+	{ "Matrix4 * Vector4",				matrixVector },
+	{ "Transform3 * Point3",			transformPoint },
+	{ "normalize(Vector3)",				normalizeVector }
+};
+
+static Vm::Matrix4 randomMatrix4()
+{
+	Vm::Matrix4 m;
+
+	for (int i = 0; i < 4; i++)
+		m.setCol(i, Vm::Vector4(random1(), random1(), random1(), random1()));
+
+	return m;
+}
+
+int main()
+{
+	double start, best, time;
+	float checksum;
+	unsigned b;
+	int i, round;
+
+	srand(1);
+
+	view = randomMatrix4();
+	for (i = 0; i < TRANSFORMS; i++) {
+		worlds[i] = randomMatrix4();
+		transforms[i] = Vm::Transform3(Vm::Matrix3(worlds[i].getUpper3x3()),
+			Vm::Vector3(random1(), random1(), random1()));
+		points[i] = Vm::Point3(random1(), random1(), random1());
+		vectors[i] = Vm::Vector4(random1(), random1(), random1(), random1());
+		normals[i] = Vm::Vector3(random1(), random1(), random1() + 2.0f);
+	}
+
+	for (b = 0; b < sizeof(benches) / sizeof(benches[0]); b++) {
+		best = 0;
+		for (round = 0; round < ROUNDS; round++) {
+			start = now();
+			benches[b].run();
+			time = now() - start;
+			if (round == 0 || time < best)
+				best = time;
+		}
+
+		checksum = 0;
+		for (i = 0; i < TRANSFORMS; i++)
+			checksum += results[i].getX() + results[i].getW();
+
+		printf("%-36s %8.2f ns  %g\n", benches[b].name, best / TRANSFORMS,
+			checksum);
+	}
+
+	return 0;
+}
@@ -0,0 +1,435 @@
+/**
+ * \file vmcheck.cpp
+ *
+ * Copyright (C) 2015 PSP2SDK Project
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+/*
+ * psp2-vmcheck: compares a SIMD vectormath backend with the scalar one.
+ *
+ * Every operation that a backend implements with its own intrinsics is run
+ * on the same pseudo-random inputs by sce::Vectormath::Scalar and by the
+ * backend named by PSP2_VMCHECK_BACKEND (Sse, or Neon through the stand-in
+ * arm_neon.h of tools/vmcheck/neon).  A result matches when
+ *
+ * 	|simd - scalar| <= bound * FLT_EPSILON * max(|scalar|, 1)
+ *
+ * The inputs are scaled to about 1, so the floor of 1 covers the
+ * cancellation of sums of products that come out near 0.  The bound of each
+ * operation is its worst error seen on either backend, rounded up to a power
+ * of two and doubled, and at least 2 unless the result must be exact, so
+ * that other compilers and flags do not trip it.  The batch functions are
+ * also run on every count up to 37, to cover the tails, and must not write
+ * past the count.
+ *
+ * The exit status is 1 if any operation exceeds its bound.
+ */
+
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <psp2/vectormath.h>
+
+#ifndef PSP2_VMCHECK_BACKEND
+#error "PSP2_VMCHECK_BACKEND must name the backend to check: Sse or Neon"
+#endif
+
+namespace Ref = sce::Vectormath::Scalar::Aos;
+namespace RefSoa = sce::Vectormath::Scalar::Soa;
+namespace Simd = sce::Vectormath::PSP2_VMCHECK_BACKEND::Aos;
+namespace SimdSoa = sce::Vectormath::PSP2_VMCHECK_BACKEND::Soa;
+
+#define ITERATIONS	20000
+#define STREAM_SIZE	40
+#define SENTINEL	12345.0f
+
+struct Check {
+	const char *name;
+	double bound;		// In FLT_EPSILON relative to max(|scalar|, 1).
+	double worst;
+};
+
+static Check checks[] = {
+	{ "Matrix4 * Matrix4",			4,	0 },
+	{ "Matrix4 * Vector4",			4,	0 },
+	{ "Matrix4 * Vector3",			4,	0 },
+	{ "Matrix4 * Point3",			4,	0 },
+	{ "Matrix4 * Transform3",		4,	0 },
+	{ "Transform3 * Vector3",		4,	0 },
+	{ "Transform3 * Point3",		4,	0 },
+	{ "Transform3 * Transform3",	4,	0 },
+	{ "inverse(Matrix4)",			16,	0 },
+	{ "affineInverse(Matrix4)",		2,	0 },
+	{ "orthoInverse(Matrix4)",		2,	0 },
+	{ "orthoInverse(Transform3)",	2,	0 },
+	{ "determinant(Matrix4)",		2,	0 },
+	{ "transpose(Matrix4)",			0,	0 },
+	{ "Matrix4::rotation(Quat)",	2,	0 },
+	{ "Quat(Matrix3)",				2,	0 },
+	{ "Quat * Quat",				2,	0 },
+	{ "rotate(Quat, Vector3)",		2,	0 },
+	{ "normalize(Quat)",			4,	0 },
+	{ "normalize(Vector3)",			4,	0 },
+	{ "normalize(Vector4)",			4,	0 },
+	{ "length(Vector3)",			2,	0 },
+	{ "cross(Vector3)",				2,	0 },
+	{ "slerp(Quat)",				4,	0 },
+	{ "slerp(Vector3)",				2,	0 },
+	{ "slerp(Vector4)",				128,	0 },
+	{ "Soa::transformPoints(Matrix4)",		4,	0 },
+	{ "Soa::transformPoints(Transform3)",	4,	0 },
+	{ "Soa::transformVectors",		2,	0 },
+	{ "Soa::transformNormals",		2,	0 },
+	{ "Soa::cullSpheres",			0,	0 },
+	{ "Soa::normalizeQuats",		2,	0 },
+	{ "Soa::slerpQuats",			2,	0 },
+};
+
+enum {
+	MAT4_MUL_MAT4, MAT4_MUL_VEC4, MAT4_MUL_VEC3, MAT4_MUL_PNT3, MAT4_MUL_TFRM3,
+	TFRM3_MUL_VEC3, TFRM3_MUL_PNT3, TFRM3_MUL_TFRM3,
+	MAT4_INVERSE, MAT4_AFFINE_INVERSE, MAT4_ORTHO_INVERSE, TFRM3_ORTHO_INVERSE,
+	MAT4_DETERMINANT, MAT4_TRANSPOSE, MAT4_ROTATION, QUAT_FROM_MAT3,
+	QUAT_MUL, QUAT_ROTATE, QUAT_NORMALIZE, VEC3_NORMALIZE, VEC4_NORMALIZE,
+	VEC3_LENGTH, VEC3_CROSS, QUAT_SLERP, VEC3_SLERP, VEC4_SLERP,
+	SOA_TRANSFORM_POINTS4, SOA_TRANSFORM_POINTS3, SOA_TRANSFORM_VECTORS,
+	SOA_TRANSFORM_NORMALS, SOA_CULL_SPHERES, SOA_NORMALIZE_QUATS,
+	SOA_SLERP_QUATS
+};
+
+static float random1()
+{
+	return (float)rand() / RAND_MAX * 2.0f - 1.0f;
+}
+
+static void compare(int check, float ref, float simd)
+{
+	double scale, error;
+
+	scale = fabs(ref) > 1.0 ? fabs(ref) : 1.0;
+	error = fabs((double)simd - ref) / (scale * FLT_EPSILON);
+	if (error != error)
+		error = HUGE_VAL;
+	if (error > checks[check].worst)
+		checks[check].worst = error;
+}
+
+template <typename F>
+static float value(const F &x)
+{
+	return x.getAsFloat();
+}
+
+template <typename R, typename S>
+static void compare4(int check, const R &ref, const S &simd)
+{
+	for (int i = 0; i < 4; i++)
+		compare(check, value(ref.getElem(i)), value(simd.getElem(i)));
+}
+
+template <typename R, typename S>
+static void compare3(int check, const R &ref, const S &simd)
+{
+	for (int i = 0; i < 3; i++)
+		compare(check, value(ref.getElem(i)), value(simd.getElem(i)));
+}
+
+template <typename R, typename S>
+static void compareMatrix4(int check, const R &ref, const S &simd)
+{
+	for (int i = 0; i < 4; i++)
+		compare4(check, ref.getCol(i), simd.getCol(i));
+}
+
+template <typename R, typename S>
+static void compareTransform3(int check, const R &ref, const S &simd)
+{
+	for (int i = 0; i < 4; i++)
+		compare3(check, ref.getCol(i), simd.getCol(i));
+}
+
+/* The same matrix, vector or quaternion in both backends */
+struct Inputs {
+	Ref::Matrix4 refMat4, refMat4b, refGeneral;
+	Simd::Matrix4 simdMat4, simdMat4b, simdGeneral;
+	Ref::Transform3 refTfrm3;
+	Simd::Transform3 simdTfrm3;
+	Ref::Quat refQuat0, refQuat1;
+	Simd::Quat simdQuat0, simdQuat1;
+	float vec[4], unit0[4], unit1[4], t;
+};
+
+static void randomInputs(Inputs *in)
+{
+	float a[16], b[16], q0[4], q1[4], scale[3], perturb[4];
+	int i;
+
+	for (i = 0; i < 16; i++) {
+		a[i] = random1();
+		b[i] = random1();
+	}
+	for (i = 0; i < 4; i++) {
+		in->vec[i] = random1();
+		q0[i] = random1();
+		q1[i] = random1();
+		perturb[i] = random1() * 0.1f;
+	}
+	for (i = 0; i < 3; i++)
+		scale[i] = 0.5f + (random1() + 1.0f) * 0.75f;
+	in->t = (random1() + 1.0f) * 0.5f;
+
+#define PSP2_VMCHECK_MATRIX4(ns, m)	\
+	ns::Matrix4(ns::Vector4(m[0], m[1], m[2], m[3]),	\
+		ns::Vector4(m[4], m[5], m[6], m[7]),	\
+		ns::Vector4(m[8], m[9], m[10], m[11]),	\
+		ns::Vector4(m[12], m[13], m[14], m[15]))
+
+	in->refMat4 = PSP2_VMCHECK_MATRIX4(Ref, a);
+	in->simdMat4 = PSP2_VMCHECK_MATRIX4(Simd, a);
+	in->refMat4b = PSP2_VMCHECK_MATRIX4(Ref, b);
+	in->simdMat4b = PSP2_VMCHECK_MATRIX4(Simd, b);
+
+#undef PSP2_VMCHECK_MATRIX4
+
+	in->refQuat0 = normalize(Ref::Quat(q0[0], q0[1], q0[2], q0[3]));
+	in->refQuat1 = normalize(Ref::Quat(q1[0], q1[1], q1[2], q1[3]));
+	in->simdQuat0 = Simd::Quat(in->refQuat0.getX(), in->refQuat0.getY(),
+		in->refQuat0.getZ(), in->refQuat0.getW());
+	in->simdQuat1 = Simd::Quat(in->refQuat1.getX(), in->refQuat1.getY(),
+		in->refQuat1.getZ(), in->refQuat1.getW());
+	for (i = 0; i < 4; i++) {
+		in->unit0[i] = value(in->refQuat0.getElem(i));
+		in->unit1[i] = value(in->refQuat1.getElem(i));
+	}
+
+	in->refTfrm3 = Ref::Transform3(Ref::Matrix3(in->refQuat0),
+		Ref::Vector3(in->vec[0], in->vec[1], in->vec[2]));
+	in->simdTfrm3 = Simd::Transform3(Simd::Matrix3(in->simdQuat0),
+		Simd::Vector3(in->vec[0], in->vec[1], in->vec[2]));
+
+	/* A rotation, a scale of 0.5 to 2, a translation, and a small projective
+	   row, so that the general inverse is well conditioned */
+	in->refGeneral = Ref::Matrix4(in->refTfrm3)
+		* Ref::Matrix4::scale(Ref::Vector3(scale[0], scale[1], scale[2]));
+	in->refGeneral.setRow(3, in->refGeneral.getRow(3)
+		+ Ref::Vector4(perturb[0], perturb[1], perturb[2], perturb[3]));
+	for (i = 0; i < 4; i++)
+		in->simdGeneral.setCol(i, Simd::Vector4(
+			in->refGeneral.getElem(i, 0), in->refGeneral.getElem(i, 1),
+			in->refGeneral.getElem(i, 2), in->refGeneral.getElem(i, 3)));
+}
+
+static void checkAos(const Inputs &in)
+{
+	const float *v = in.vec;
+	Ref::Vector3 refVec3(v[0], v[1], v[2]);
+	Simd::Vector3 simdVec3(v[0], v[1], v[2]);
+	Ref::Vector4 refVec4(v[0], v[1], v[2], v[3]);
+	Simd::Vector4 simdVec4(v[0], v[1], v[2], v[3]);
+	Ref::Point3 refPnt3(v[0], v[1], v[2]);
+	Simd::Point3 simdPnt3(v[0], v[1], v[2]);
+	Ref::Vector3 refUnit3a = normalize(Ref::Vector3(in.unit0[0], in.unit0[1], in.unit0[2]));
+	Ref::Vector3 refUnit3b = normalize(Ref::Vector3(in.unit1[0], in.unit1[1], in.unit1[2]));
+	Simd::Vector3 simdUnit3a(refUnit3a.getX(), refUnit3a.getY(), refUnit3a.getZ());
+	Simd::Vector3 simdUnit3b(refUnit3b.getX(), refUnit3b.getY(), refUnit3b.getZ());
+	Ref::Vector4 refUnit4a(in.unit0[0], in.unit0[1], in.unit0[2], in.unit0[3]);
+	Ref::Vector4 refUnit4b(in.unit1[0], in.unit1[1], in.unit1[2], in.unit1[3]);
+	Simd::Vector4 simdUnit4a(in.unit0[0], in.unit0[1], in.unit0[2], in.unit0[3]);
+	Simd::Vector4 simdUnit4b(in.unit1[0], in.unit1[1], in.unit1[2], in.unit1[3]);
+
+	compareMatrix4(MAT4_MUL_MAT4, in.refMat4 * in.refMat4b,
+		in.simdMat4 * in.simdMat4b);
+	compare4(MAT4_MUL_VEC4, in.refMat4 * refVec4, in.simdMat4 * simdVec4);
+	compare4(MAT4_MUL_VEC3, in.refMat4 * refVec3, in.simdMat4 * simdVec3);
+	compare4(MAT4_MUL_PNT3, in.refMat4 * refPnt3, in.simdMat4 * simdPnt3);
+	compareMatrix4(MAT4_MUL_TFRM3, in.refMat4 * in.refTfrm3,
+		in.simdMat4 * in.simdTfrm3);
+
+	compare3(TFRM3_MUL_VEC3, in.refTfrm3 * refVec3, in.simdTfrm3 * simdVec3);
+	compare3(TFRM3_MUL_PNT3, in.refTfrm3 * refPnt3, in.simdTfrm3 * simdPnt3);
+	compareTransform3(TFRM3_MUL_TFRM3, in.refTfrm3 * inverse(in.refTfrm3),
+		in.simdTfrm3 * inverse(in.simdTfrm3));
+
+	compareMatrix4(MAT4_INVERSE, inverse(in.refGeneral),
+		inverse(in.simdGeneral));
+	compareMatrix4(MAT4_AFFINE_INVERSE, affineInverse(Ref::Matrix4(in.refTfrm3)),
+		affineInverse(Simd::Matrix4(in.simdTfrm3)));
+	compareMatrix4(MAT4_ORTHO_INVERSE, orthoInverse(Ref::Matrix4(in.refTfrm3)),
+		orthoInverse(Simd::Matrix4(in.simdTfrm3)));
+	compareTransform3(TFRM3_ORTHO_INVERSE, orthoInverse(in.refTfrm3),
+		orthoInverse(in.simdTfrm3));
+	compare(MAT4_DETERMINANT, value(determinant(in.refMat4)),
+		value(determinant(in.simdMat4)));
+	compareMatrix4(MAT4_TRANSPOSE, transpose(in.refMat4),
+		transpose(in.simdMat4));
+	compareMatrix4(MAT4_ROTATION, Ref::Matrix4::rotation(in.refQuat0),
+		Simd::Matrix4::rotation(in.simdQuat0));
+	compare4(QUAT_FROM_MAT3, Ref::Quat(Ref::Matrix3(in.refQuat0)),
+		Simd::Quat(Simd::Matrix3(in.simdQuat0)));
+
+	compare4(QUAT_MUL, in.refQuat0 * in.refQuat1,
+		in.simdQuat0 * in.simdQuat1);
+	compare3(QUAT_ROTATE, rotate(in.refQuat0, refVec3),
+		rotate(in.simdQuat0, simdVec3));
+	compare4(QUAT_NORMALIZE, normalize(Ref::Quat(v[0], v[1], v[2], v[3])),
+		normalize(Simd::Quat(v[0], v[1], v[2], v[3])));
+	compare3(VEC3_NORMALIZE, normalize(refVec3), normalize(simdVec3));
+	compare4(VEC4_NORMALIZE, normalize(refVec4), normalize(simdVec4));
+	compare(VEC3_LENGTH, value(length(refVec3)), value(length(simdVec3)));
+	compare3(VEC3_CROSS, cross(refUnit3a, refUnit3b),
+		cross(simdUnit3a, simdUnit3b));
+
+	compare4(QUAT_SLERP, slerp(in.t, in.refQuat0, in.refQuat1),
+		slerp(in.t, in.simdQuat0, in.simdQuat1));
+	compare4(QUAT_SLERP, slerp(in.t, in.refQuat0, -in.refQuat0),
+		slerp(in.t, in.simdQuat0, -in.simdQuat0));
+	compare4(QUAT_SLERP, slerp(in.t, in.refQuat0, in.refQuat0),
+		slerp(in.t, in.simdQuat0, in.simdQuat0));
+	compare3(VEC3_SLERP, slerp(in.t, refUnit3a, refUnit3b),
+		slerp(in.t, simdUnit3a, simdUnit3b));
+	compare4(VEC4_SLERP, slerp(in.t, refUnit4a, refUnit4b),
+		slerp(in.t, simdUnit4a, simdUnit4b));
+}
+
+/* The output streams of both backends, filled with a sentinel */
+struct Streams {
+	float ref[4][STREAM_SIZE];
+	float simd[4][STREAM_SIZE];
+
+	void reset()
+	{
+		for (int c = 0; c < 4; c++)
+			for (int i = 0; i < STREAM_SIZE; i++)
+				ref[c][i] = simd[c][i] = SENTINEL;
+	}
+
+	void compare(int check, int components)
+	{
+		for (int c = 0; c < components; c++)
+			for (int i = 0; i < STREAM_SIZE; i++)
+				::compare(check, ref[c][i], simd[c][i]);
+	}
+};
+
+static void checkSoa(const Inputs &in, uint32_t count)
+{
+	float x[STREAM_SIZE], y[STREAM_SIZE], z[STREAM_SIZE], w[STREAM_SIZE];
+	float ax[STREAM_SIZE], ay[STREAM_SIZE], az[STREAM_SIZE], aw[STREAM_SIZE];
+	float bx[STREAM_SIZE], by[STREAM_SIZE], bz[STREAM_SIZE], bw[STREAM_SIZE];
+	uint8_t refVisible[STREAM_SIZE], simdVisible[STREAM_SIZE];
+	Ref::Vector4 refPlanes[6];
+	Simd::Vector4 simdPlanes[6];
+	Streams out;
+	float length;
+	int i;
+
+	for (i = 0; i < STREAM_SIZE; i++) {
+		x[i] = random1();
+		y[i] = random1();
+		z[i] = random1();
+		w[i] = (random1() + 1.0f) * 0.5f;
+	}
+	for (i = 0; i < 6; i++) {
+		float p[4] = { random1(), random1(), random1(), random1() };
+		refPlanes[i] = Ref::Vector4(p[0], p[1], p[2], p[3]);
+		simdPlanes[i] = Simd::Vector4(p[0], p[1], p[2], p[3]);
+	}
+
+	RefSoa::Stream3 in3 = { x, y, z };
+	SimdSoa::Stream3 simdIn3 = { x, y, z };
+	RefSoa::Stream4 in4 = { x, y, z, w };
+	SimdSoa::Stream4 simdIn4 = { x, y, z, w };
+	RefSoa::Stream3 refOut3 = { out.ref[0], out.ref[1], out.ref[2] };
+	SimdSoa::Stream3 simdOut3 = { out.simd[0], out.simd[1], out.simd[2] };
+	RefSoa::Stream4 refOut4 = { out.ref[0], out.ref[1], out.ref[2], out.ref[3] };
+	SimdSoa::Stream4 simdOut4 = { out.simd[0], out.simd[1], out.simd[2], out.simd[3] };
+
+	out.reset();
+	RefSoa::transformPoints(in.refMat4, in3, refOut4, count);
+	SimdSoa::transformPoints(in.simdMat4, simdIn3, simdOut4, count);
+	out.compare(SOA_TRANSFORM_POINTS4, 4);
+
+	out.reset();
+	RefSoa::transformPoints(in.refTfrm3, in3, refOut3, count);
+	SimdSoa::transformPoints(in.simdTfrm3, simdIn3, simdOut3, count);
+	out.compare(SOA_TRANSFORM_POINTS3, 3);
+
+	out.reset();
+	RefSoa::transformVectors(in.refMat4.getUpper3x3(), in3, refOut3, count);
+	SimdSoa::transformVectors(in.simdMat4.getUpper3x3(), simdIn3, simdOut3,
+		count);
+	out.compare(SOA_TRANSFORM_VECTORS, 3);
+
+	out.reset();
+	RefSoa::transformNormals(in.refGeneral.getUpper3x3(), in3, refOut3, count);
+	SimdSoa::transformNormals(in.simdGeneral.getUpper3x3(), simdIn3, simdOut3,
+		count);
+	out.compare(SOA_TRANSFORM_NORMALS, 3);
+
+	memset(refVisible, 0xA5, sizeof(refVisible));
+	memset(simdVisible, 0xA5, sizeof(simdVisible));
+	compare(SOA_CULL_SPHERES,
+		RefSoa::cullSpheres(refPlanes, 6, in4, refVisible, count),
+		SimdSoa::cullSpheres(simdPlanes, 6, simdIn4, simdVisible, count));
+	for (i = 0; i < STREAM_SIZE; i++)
+		compare(SOA_CULL_SPHERES, refVisible[i], simdVisible[i]);
+
+	out.reset();
+	RefSoa::normalizeQuats(in4, refOut4, count);
+	SimdSoa::normalizeQuats(simdIn4, simdOut4, count);
+	out.compare(SOA_NORMALIZE_QUATS, 4);
+
+	for (i = 0; i < STREAM_SIZE; i++) {
+		length = sqrtf(x[i] * x[i] + y[i] * y[i] + z[i] * z[i] + w[i] * w[i]);
+		ax[i] = x[i] / length;
+		ay[i] = y[i] / length;
+		az[i] = z[i] / length;
+		aw[i] = w[i] / length;
+		bx[i] = ay[i];
+		by[i] = -ax[i];
+		bz[i] = aw[i];
+		bw[i] = -az[i];
+	}
+	RefSoa::Stream4 refA = { ax, ay, az, aw }, refB = { bx, by, bz, bw };
+	SimdSoa::Stream4 simdA = { ax, ay, az, aw }, simdB = { bx, by, bz, bw };
+
+	out.reset();
+	RefSoa::slerpQuats(in.t, refA, refB, refOut4, count);
+	SimdSoa::slerpQuats(in.t, simdA, simdB, simdOut4, count);
+	out.compare(SOA_SLERP_QUATS, 4);
+}
+
+int main()
+{
+	Inputs in;
+	unsigned i;
+	int failed;
+
+	srand(1);
+
+	for (i = 0; i < ITERATIONS; i++) {
+		randomInputs(&in);
+		checkAos(in);
+	}
+	for (i = 0; i < ITERATIONS / 100; i++) {
+		randomInputs(&in);
+		checkSoa(in, i % (STREAM_SIZE - 2));
+	}
+
+	failed = 0;
+	for (i = 0; i < sizeof(checks) / sizeof(checks[0]); i++) {
+		printf("%-36s %10.2f %6.0f  %s\n", checks[i].name, checks[i].worst,
+			checks[i].bound,
+			checks[i].worst <= checks[i].bound ? "ok" : "FAILED");
+		if (checks[i].worst > checks[i].bound)
+			failed = 1;
+	}
+
+	return failed;
+}